@@ -150,6 +150,14 @@ ApplicationWindow {
                         orgTreeLayout.layout(graphView.treeRoot);
                     }
                 }
+                Button {
+                    text: 'Indented'
+                    Material.roundedScale: Material.SmallScale
+                    onClicked: {
+                        orgTreeLayout.layoutOrientation = Qan.OrgTreeLayout.IndentedVertical
+                        orgTreeLayout.layout(graphView.treeRoot);
+                    }
+                }
             }
         }
     }  // Qan.GraphView
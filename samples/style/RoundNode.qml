@@ -43,6 +43,7 @@ Qan.NodeItem {
     id: roundNode
     width: 60; height: 60
     minimumSize: Qt.size(60,60)
+    boundingShapeType: Qan.NodeItem.Ellipse
     x: 15;      y: 15
     Rectangle {
         id: background
@@ -41,9 +41,14 @@ Qan.EdgeItem {
 
     // Private hack for visual connector edge color dynamic modification
     property color color: style?.lineColor ?? Qt.rgba(0.,0.,0.,1.)
-    EdgeTemplate {
+    Loader {
+        id: edgeTemplateLoader
         anchors.fill: parent
-        edgeItem: parent
-        color: parent.color
+        active: !edgeItem.batchRendered &&   // Edge is drawn by graph edge batch renderer
+                edgeItem.lod !== Qan.NodeItem.Minimal
+        sourceComponent: EdgeTemplate {
+            edgeItem: edgeTemplateLoader.parent
+            color: edgeTemplateLoader.parent.color
+        }
     }
 }
@@ -46,7 +46,7 @@ Item {
     property var    lineType: edgeItem?.style?.lineType ?? Qan.EdgeStyle.Straight
     property var    dashed  : edgeItem?.style?.dashed ? ShapePath.DashLine : ShapePath.SolidLine
 
-    visible: edgeItem.visible && !edgeItem.hidden
+    visible: edgeItem.visible && !edgeItem.hidden && !edgeItem.batchRendered
 
     Shape {
         id: dstShape
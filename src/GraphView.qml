@@ -56,6 +56,8 @@ Qan.AbstractGraphView {
     property real   resizeHandlerRadius: 4.0
     property real   resizeHandlerWidth: 4.0
     property size   resizeHandlerSize: "9x9"
+    //! Show a resize outline while dragging a resize handler, node or group is resized once on release (default to false).
+    property bool   resizePreview: false
 
     //! Shortcut to set scrollbar policy or visibility (default to always visible).
     property alias  vScrollBar: vbar
@@ -156,6 +158,7 @@ Qan.AbstractGraphView {
     Qan.BottomRightResizer {
         id: nodeResizer
         parent: graph.containerItem
+        preview: resizePreview
         visible: false
         z: 10
 
@@ -166,44 +169,53 @@ Qan.AbstractGraphView {
         handlerWidth: resizeHandlerWidth
         handlerSize: resizeHandlerSize
         onResizeStart: {
+            graph.beginResizeSelection(target)
             if (target && target.node)
                 graph.nodeAboutToBeResized(target.node);
         }
         onResizeEnd: {
             if (target && target.node)
                 graph.nodeResized(target.node);
+            graph.endResizeSelection(target)
         }
     }
     Qan.RightResizer {
         id: nodeRightResizer
         parent: graph.containerItem
+        preview: resizePreview
 
         enabled: target && target.node && target.node.commitStatus !== 2
         onResizeStart: {
+            graph.beginResizeSelection(target)
             if (target && target.node)
                 graph.nodeAboutToBeResized(target.node);
         }
         onResizeEnd: {
             if (target && target.node)
                 graph.nodeResized(target.node);
+            graph.endResizeSelection(target)
         }
     }
     Qan.BottomResizer {
         id: nodeBottomResizer
         parent: graph.containerItem
+        preview: resizePreview
         enabled: target && target.node && target.node.commitStatus !== 2
         onResizeStart: {
+            graph.beginResizeSelection(target)
             if (target && target.node)
                 graph.nodeAboutToBeResized(target.node);
         }
         onResizeEnd: {
             if (target && target.node)
                 graph.nodeResized(target.node);
+            graph.endResizeSelection(target)
         }
     }
     Qan.BottomRightResizer {
         id: groupResizer
         parent: graph.containerItem
+        preview: resizePreview
         visible: false
         enabled: target && target.node && target.node.commitStatus !== 2    // Disable for locked nodes
         z: 5
@@ -215,38 +227,46 @@ Qan.AbstractGraphView {
         handlerSize: resizeHandlerSize
 
         onResizeStart: {
+            graph.beginResizeSelection(target)
             if (target && target.group)
                 graph.groupAboutToBeResized(target.group)
         }
         onResizeEnd: {
             if (target && target.group)
                 graph.groupResized(target.group)
+            graph.endResizeSelection(target)
         }
     }
     Qan.RightResizer {
         id: groupRightResizer
         parent: graph.containerItem
+        preview: resizePreview
         enabled: target && target.node && target.node.commitStatus !== 2    // Disable for locked nodes
         onResizeStart: {
+            graph.beginResizeSelection(target)
             if (target && target.group)
                 graph.groupAboutToBeResized(target.group);
         }
         onResizeEnd: {
             if (target && target.group)
                 graph.groupResized(target.group);
+            graph.endResizeSelection(target)
         }
     }
     Qan.BottomResizer {
         id: groupBottomResizer
         parent: graph.containerItem
+        preview: resizePreview
         enabled: target && target.node && target.node.commitStatus !== 2    // Disable for locked nodes
         onResizeStart: {
+            graph.beginResizeSelection(target)
             if (target && target.group)
                 graph.groupAboutToBeResized(target.group);
         }
         onResizeEnd: {
             if (target && target.group)
                 graph.groupResized(target.group);
+            graph.endResizeSelection(target)
         }
     }
 
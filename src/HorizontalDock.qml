@@ -77,6 +77,8 @@ RowLayout {
     ]
 
     property var hostNodeItem: undefined
+    // Docks and ports are hidden in simplified and minimal level of detail
+    visible: (hostNodeItem?.lod ?? Qan.NodeItem.Full) === Qan.NodeItem.Full
     property int dockType: -1
     property int topMargin: 7
     property int bottomMargin: 7
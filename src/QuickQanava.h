@@ -45,6 +45,8 @@
 #include "./qanEdgeItem.h"
 #include "./qanNode.h"
 #include "./qanNodeItem.h"
+#include "./qanNativeNodeItem.h"
+#include "./qanNativeEdgeItem.h"
 #include "./qanPortItem.h"
 #include "./qanConnector.h"
 #include "./qanGroup.h"
@@ -57,6 +59,8 @@
 #include "./qanLineGrid.h"
 #include "./qanGraphView.h"
 #include "./qanStyle.h"
+#include "./qanEffectAtlas.h"
+#include "./qanRectEffect.h"
 #include "./qanStyleManager.h"
 #include "./qanBottomRightResizer.h"
 #include "./qanRightResizer.h"
@@ -64,6 +68,9 @@
 #include "./qanNavigablePreview.h"
 #include "./qanAnalysisTimeHeatMap.h"
 #include "./qanTreeLayouts.h"
+#include "./qanSugiyamaLayout.h"
+#include "./qanForceDirectedLayout.h"
+#include "./qanLayoutRunner.h"
 
 struct QuickQanava {
     static void initialize(QQmlEngine* engine) {
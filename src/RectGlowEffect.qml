@@ -33,11 +33,12 @@
 //-----------------------------------------------------------------------------
 
 import QtQuick
-import QtQuick.Effects
 
 import QuickQanava as Qan
 
 /*! \brief Node or group background glow effect with transparent mask for node content.
+ *
+ * Glow is drawn with a nine-patch texture shared by all nodes with the same style (see qan::RectEffect).
  */
 Item {
     id: glowEffect
@@ -46,49 +47,9 @@ Item {
     property var    style: undefined
 
     // PRIVATE ////////////////////////////////////////////////////////////////
-    readonly property real   glowRadius: style?.effectRadius ?? 3.
-    readonly property real   backRadius: style?.backRadius ?? 4.
-
-    Rectangle {         // Hidden item used to generate shadow
-        id: border
+    Qan.RectEffect {
         anchors.fill: parent
-        anchors.margins: 1
-        radius: backRadius
-        color: style?.effectColor ?? Qt.rgba(0.7, 0.7, 0.7, 0.7)
-        clip: true
-        visible: false
-    }
-
-    MultiEffect {
-        source: border
-        visible: glowEffect.visible
-        anchors.centerIn: parent
-        width: border.width + (glowRadius * 2)
-        height: border.height + (glowRadius * 2)
-        blurEnabled: glowEffect.visible && (glowEffect.style?.effectEnabled || false)
-        blurMax: 30
-        blur: 1.
-        colorization: 1.0
-        colorizationColor: style?.effectColor ?? Qt.rgba(0.7, 0.7, 0.7, 0.7)
-
-        maskEnabled: true && glowEffect.visible
-        maskThresholdMin: 0.29      // Should be just below border.color
-        maskSpreadAtMin: 1.0
-        maskSource: ShaderEffectSource {
-            live: true
-            width: border.width
-            height: border.height
-            smooth: false
-            sourceItem: Rectangle {
-                x: 1
-                y: 1
-                width: border.width - 2
-                height: border.height - 2
-                border.width: 1
-                border.color: Qt.rgba(1, 1, 1, 0.3)
-                color: Qt.rgba(0, 0, 0, 0)
-                radius: backRadius
-            }
-        }
+        style: glowEffect.style ?? null
+        effectType: Qan.NodeStyle.EffectGlow
     }
 }  // Item: glowEffect
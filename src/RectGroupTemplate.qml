@@ -75,7 +75,8 @@ Item {
         id: groupBackground
         anchors.fill: parent
         style: template.groupItem?.style
-        visible: !groupItem.collapsed
+        visible: !groupItem.collapsed &&
+                 groupItem.lod !== Qan.NodeItem.Minimal  // Minimal group is drawn by graph batch renderer
         headerHeight: Math.max(35, groupLabel.implicitHeight)
         antialiasing: template.antialiasing
     }
@@ -89,6 +90,7 @@ Item {
             Layout.preferredHeight:  Math.max(35, groupLabel.implicitHeight)
             Layout.alignment: Qt.AlignTop | Qt.AlignLeft
             z: 2
+            opacity: groupItem?.lod === Qan.NodeItem.Minimal ? 0. : 1.  // Keep header layout space
             spacing: 0
             ToolButton {
                 id: collapser
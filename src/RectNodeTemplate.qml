@@ -62,6 +62,11 @@ Item {
     }
 
     readonly property real   backRadius: nodeItem?.style?.backRadius ?? 4.
+    // Minimal level of detail is drawn by graph batch renderer, simplified disable effects
+    readonly property int    lod: nodeItem?.lod ?? Qan.NodeItem.Full
+    visible: lod !== Qan.NodeItem.Minimal
+    readonly property int    effectType: lod === Qan.NodeItem.Full ? (nodeItem?.style?.effectType ?? Qan.NodeStyle.EffectNone) :
+                                                                    Qan.NodeStyle.EffectNone
     Loader {
         id: delegateLoader
         anchors.fill: parent
@@ -70,14 +75,14 @@ Item {
                 return "qrc:/QuickQanava/RectSolidBackground.qml";
             switch (nodeItem.style.fillType) {  // Otherwise, select the delegate according to current style configuration
             case Qan.NodeStyle.FillSolid:
-                switch (nodeItem.style.effectType) {
+                switch (template.effectType) {
                 case Qan.NodeStyle.EffectNone:   return "qrc:/QuickQanava/RectSolidBackground.qml";
                 case Qan.NodeStyle.EffectShadow: return "qrc:/QuickQanava/RectSolidShadowBackground.qml";
                 case Qan.NodeStyle.EffectGlow:   return "qrc:/QuickQanava/RectSolidGlowBackground.qml";
                 }
                 break;
             case Qan.NodeStyle.FillGradient:
-                switch (nodeItem.style.effectType) {
+                switch (template.effectType) {
                 case Qan.NodeStyle.EffectNone:   return "qrc:/QuickQanava/RectGradientBackground.qml";
                 case Qan.NodeStyle.EffectShadow: return "qrc:/QuickQanava/RectGradientShadowBackground.qml";
                 case Qan.NodeStyle.EffectGlow:   return "qrc:/QuickQanava/RectGradientGlowBackground.qml";
@@ -106,7 +111,7 @@ Item {
             text: nodeItem && nodeItem.node ? nodeItem.node.label : ''
             horizontalAlignment: Qt.AlignHCenter
             verticalAlignment: Qt.AlignVCenter
-            maximumLineCount: 3 // Must be set, otherwise elide don't work and we end up with single line text
+            maximumLineCount: lod === Qan.NodeItem.Full ? 3 : 1 // Must be set, otherwise elide don't work and we end up with single line text
             elide: Text.ElideRight
             wrapMode: Text.Wrap
         }
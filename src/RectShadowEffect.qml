@@ -33,12 +33,12 @@
 //-----------------------------------------------------------------------------
 
 import QtQuick
-import QtQuick.Effects
 
 import QuickQanava as Qan
 
-/*! \brief Node or group background component with solid fill, shadow effect and backOpacity style support
+/*! \brief Node or group background drop shadow effect, node content is knocked out from shadow.
  *
+ * Shadow is drawn with a nine-patch texture shared by all nodes with the same style (see qan::RectEffect).
  */
 Item {
     id: shadowEffect
@@ -47,51 +47,9 @@ Item {
     property var    style: undefined
 
     // PRIVATE ////////////////////////////////////////////////////////////////
-    readonly property real   shadowOffset:  style?.effectOffset ?? 3.
-    readonly property real   backRadius:    style?.backRadius ?? 4.
-
-    Rectangle {         // Hidden item used to generate shadow
-        id: border
+    Qan.RectEffect {
         anchors.fill: parent
-        anchors.margins: 1
-        visible: false
-        opacity: 0
-        radius: backRadius - 1      // -1 to avoid margin issue
-        color: Qt.rgba(1, 1, 1, 1)
-    }
-
-    MultiEffect {
-        anchors.fill: parent
-        anchors.margins: 1
-        source: border
-        autoPaddingEnabled: false
-        paddingRect: Qt.rect(shadowOffset, shadowOffset,
-                             parent.width + shadowOffset,
-                             parent.height + shadowOffset)
-        shadowEnabled: shadowEffect.style?.effectEnabled || false
-        shadowColor: style?.effectColor ?? Qt.rgba(0.7, 0.7, 0.7, 0.7)
-        shadowBlur: 0.9
-        blurMax: style?.effectRadius ?? 3.
-        shadowHorizontalOffset: shadowOffset
-        shadowVerticalOffset: shadowOffset
-
-        maskEnabled: true
-        maskThresholdMin: 0.29      // Should be just below border.color
-        maskSpreadAtMin: 1.0
-        maskSource: ShaderEffectSource {
-            live: true
-            width: border.width
-            height: border.height
-            sourceItem: Rectangle {
-                x: 1
-                y: 1
-                width: border.width - 2
-                height: border.height - 2
-                border.width: 1
-                border.color: Qt.rgba(1,1,1,0.3)
-                color: 'transparent'
-                radius: backRadius
-            }
-        }
+        style: shadowEffect.style ?? null
+        effectType: Qan.NodeStyle.EffectShadow
     }
 }  // Item: shadowEffect
@@ -38,6 +38,7 @@
 
 // QuickQanava headers
 #include "./qanBottomResizer.h"
+#include "./qanUtils.h"
 
 namespace qan {  // ::qan
 
@@ -162,6 +163,22 @@ void    BottomResizer::setRatio(qreal ratio) noexcept
         emit ratioChanged();
     }
 }
+
+void    BottomResizer::setCoalesceMoves(bool coalesceMoves) noexcept
+{
+    if (coalesceMoves != _coalesceMoves) {
+        _coalesceMoves = coalesceMoves;
+        emit coalesceMovesChanged();
+    }
+}
+
+void    BottomResizer::setPreview(bool preview) noexcept
+{
+    if (preview != _preview) {
+        _preview = preview;
+        emit previewChanged();
+    }
+}
 //-----------------------------------------------------------------------------
 
 /* Resizer Management *///-----------------------------------------------------
@@ -182,40 +199,85 @@ void    BottomResizer::mouseMoveEvent(QMouseEvent* event)
     const auto mePos = event->scenePosition();
     if (event->buttons() |  Qt::LeftButton &&
             !_dragInitialPos.isNull() &&
-            !_targetInitialSize.isEmpty()) {
-        const QPointF startLocalPos = parentItem() != nullptr ? parentItem()->mapFromScene(_dragInitialPos) :
-                                                                QPointF{.0, 0.};
-        const QPointF curLocalPos = parentItem() != nullptr ? parentItem()->mapFromScene(mePos) :
-                                                              QPointF{0., 0.};
-        const QPointF delta{curLocalPos - startLocalPos};
-        if (_target != nullptr) {
-            const qreal targetHeight = _targetInitialSize.height() + delta.y();
-
-            auto childrenRect = _targetContent ? _targetContent->childrenRect() : QRectF{};
-            if (childrenRect.size().isEmpty())  // Note 20231208: Fix a nasty bug (Qt 5.15.13 ?) where size() is empty when there
-                childrenRect = QRectF{};   // is no longer any childs but rect position is left with invalid value.
-            const auto targetContentMinHeight = _targetContent ? childrenRect.y() + childrenRect.height() : 0;
-            const auto minimumTargetHeight = qMax(_minimumTargetSize.height(), targetContentMinHeight);
-            const auto targetContentMinWidth = _targetContent ? childrenRect.x() + childrenRect.width() : 0;
-            const auto minimumTargetWidth = qMax(_minimumTargetSize.width(), targetContentMinWidth);
-
-            if (targetHeight > minimumTargetHeight) {   // Do not resize below minimumTargetSize
-                _target->setHeight(targetHeight);
-                if (_preserveRatio) {
-                    const qreal targetWidth = targetHeight / getRatio();
-                    if (targetWidth > minimumTargetWidth)
-                        _target->setWidth(targetWidth);
-                }
+            !_targetInitialSize.isEmpty() &&
+            _target != nullptr) {
+        _moveCoalescer.move(mePos, _coalesceMoves ? window() : nullptr);  // Coalesce moves to one resize per frame
+        event->setAccepted(true);
+    }
+}
+
+void    BottomResizer::resizeTo(const QPointF& scenePos)
+{
+    if (_dragInitialPos.isNull() ||
+        _targetInitialSize.isEmpty())
+        return;
+    const QPointF startLocalPos = parentItem() != nullptr ? parentItem()->mapFromScene(_dragInitialPos) :
+                                                            QPointF{.0, 0.};
+    const QPointF curLocalPos = parentItem() != nullptr ? parentItem()->mapFromScene(scenePos) :
+                                                          QPointF{0., 0.};
+    const QPointF delta{curLocalPos - startLocalPos};
+    if (_target != nullptr) {
+        auto size = _preview && _previewSize.isValid() ? _previewSize :
+                                                         QSizeF{_target->width(), _target->height()};
+        const qreal targetHeight = _targetInitialSize.height() + delta.y();
+
+        auto childrenRect = _targetContent ? _targetContent->childrenRect() : QRectF{};
+        if (childrenRect.size().isEmpty())  // Note 20231208: Fix a nasty bug (Qt 5.15.13 ?) where size() is empty when there
+            childrenRect = QRectF{};   // is no longer any childs but rect position is left with invalid value.
+        const auto targetContentMinHeight = _targetContent ? childrenRect.y() + childrenRect.height() : 0;
+        const auto minimumTargetHeight = qMax(_minimumTargetSize.height(), targetContentMinHeight);
+        const auto targetContentMinWidth = _targetContent ? childrenRect.x() + childrenRect.width() : 0;
+        const auto minimumTargetWidth = qMax(_minimumTargetSize.width(), targetContentMinWidth);
+
+        if (targetHeight > minimumTargetHeight) {   // Do not resize below minimumTargetSize
+            size.setHeight(targetHeight);
+            if (_preserveRatio) {
+                const qreal targetWidth = targetHeight / getRatio();
+                if (targetWidth > minimumTargetWidth)
+                    size.setWidth(targetWidth);
             }
-            event->setAccepted(true);
         }
+        applyTargetSize(size);
     }
 }
+
+void    BottomResizer::applyTargetSize(const QSizeF& size)
+{
+    if (!_target)
+        return;
+    if (!_preview) {
+        _target->setSize(size);
+        return;
+    }
+    _previewSize = size;
+    if (!_previewItem)
+        _previewItem = qan::createResizePreview(this, Qt::darkBlue);
+    if (_previewItem && parentItem() != nullptr) {
+        _previewItem->setParentItem(parentItem());
+        _previewItem->setPosition(_target->mapToItem(parentItem(), QPointF{0., 0.}));
+        _previewItem->setSize(size);
+        _previewItem->setZ(z() - 1.);
+        _previewItem->setVisible(true);
+    }
+}
+
+void    BottomResizer::commitPreview()
+{
+    if (_target &&
+        _previewSize.isValid())
+        _target->setSize(_previewSize);     // Target is resized once with final size
+    _previewSize = QSizeF{};
+    if (_previewItem)
+        _previewItem->setVisible(false);
+}
+
 void    BottomResizer::mousePressEvent(QMouseEvent* event)
 {
     if (!isVisible())
         return;
     if (_target) {
+        _moveCoalescer.cancel();
+        _previewSize = QSizeF{};
         _dragInitialPos = event->windowPos();
         _targetInitialSize = {_target->width(), _target->height()};
         emit resizeStart(_target ? QSizeF{_target->width(), _target->height()} :  // Use of target ok.
@@ -226,6 +288,10 @@ void    BottomResizer::mousePressEvent(QMouseEvent* event)
 void    BottomResizer::mouseReleaseEvent(QMouseEvent* event)
 {
     Q_UNUSED(event)
+    _moveCoalescer.flush();           // Apply last coalesced move, final size match last pointer position
+    if (_preview ||
+        _previewSize.isValid())       // Preview might have been disabled while dragging
+        commitPreview();
     _dragInitialPos = {0., 0.};       // Invalid all cached coordinates when button is released
     _targetInitialSize = {0., 0.};
     if (_target)
@@ -38,6 +38,9 @@
 #include <QtQml>
 #include <QQuickItem>
 
+// QuickQanava headers
+#include "./qanMoveCoalescer.h"
+
 namespace qan {  // ::qan
 
 /*! \brief Add a resize handler ont the right of a target QML Item.
@@ -139,11 +142,49 @@ protected:
     virtual void    mouseMoveEvent(QMouseEvent* event) override;
     virtual void    mousePressEvent(QMouseEvent* event) override;
     virtual void    mouseReleaseEvent(QMouseEvent* event) override;
+    //! Resize target for an handler drag to \c scenePos (called at most once per frame with last pointer position).
+    void            resizeTo(const QPointF& scenePos);
 private:
     //! Initial global mouse position at the beginning of a resizing handler drag.
     QPointF     _dragInitialPos{0., 0.};
     //! Target item size at the beginning of a resizing handler drag.
     QSizeF      _targetInitialSize{0., 0.};
+    //! Coalesce handler moves to one resizeTo() per frame.
+    qan::MoveCoalescer  _moveCoalescer{[this](const QPointF& scenePos) { resizeTo(scenePos); }};
+
+public:
+    //! Coalesce handler drag moves to a single resize per frame (default to \c true), final size always match last pointer position.
+    Q_PROPERTY(bool coalesceMoves READ getCoalesceMoves WRITE setCoalesceMoves NOTIFY coalesceMovesChanged FINAL)
+    void        setCoalesceMoves(bool coalesceMoves) noexcept;
+    bool        getCoalesceMoves() const noexcept { return _coalesceMoves; }
+signals:
+    void        coalesceMovesChanged();
+private:
+    bool        _coalesceMoves = true;
+
+public:
+    /*! \brief Show a resize outline during handler drag and commit target size once on release (default to \c false).
+     *
+     * In preview mode, target is not resized while dragging: \c resizeEnd() is emitted after the final size
+     * has been set, with target size.
+     */
+    Q_PROPERTY(bool preview READ getPreview WRITE setPreview NOTIFY previewChanged FINAL)
+    void        setPreview(bool preview) noexcept;
+    bool        getPreview() const noexcept { return _preview; }
+    //! Pending preview size (invalid when no preview resize is in progress).
+    QSizeF      getPreviewSize() const noexcept { return _previewSize; }
+signals:
+    void        previewChanged();
+private:
+    bool        _preview = false;
+    QSizeF      _previewSize{};
+    QPointer<QQuickItem>    _previewItem = nullptr;
+
+protected:
+    //! Resize target to \c size, or update the preview outline in preview mode.
+    void        applyTargetSize(const QSizeF& size);
+    //! Commit pending preview size to target and hide the preview outline.
+    void        commitPreview();
     //@}
     //-------------------------------------------------------------------------
 };
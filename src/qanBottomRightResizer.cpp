@@ -41,6 +41,7 @@
 
 // QuickQanava headers
 #include "./qanBottomRightResizer.h"
+#include "./qanUtils.h"
 
 namespace qan {  // ::qan
 
@@ -308,6 +309,22 @@ void    BottomRightResizer::setRatio(qreal ratio) noexcept
         emit ratioChanged();
     }
 }
+
+void    BottomRightResizer::setCoalesceMoves(bool coalesceMoves) noexcept
+{
+    if (coalesceMoves != _coalesceMoves) {
+        _coalesceMoves = coalesceMoves;
+        emit coalesceMovesChanged();
+    }
+}
+
+void    BottomRightResizer::setPreview(bool preview) noexcept
+{
+    if (preview != _preview) {
+        _preview = preview;
+        emit previewChanged();
+    }
+}
 //-----------------------------------------------------------------------------
 
 /* Resizer Management *///-----------------------------------------------------
@@ -330,53 +347,96 @@ void    BottomRightResizer::mouseMoveEvent(QMouseEvent* event)
     const auto mePos = event->scenePosition();
     if (event->buttons() |  Qt::LeftButton &&
             !_dragInitialPos.isNull() &&
-            !_targetInitialSize.isEmpty()) {
-
-        // Inspired by void QQuickMouseArea::mouseMoveEvent(QMouseEvent *event)
-        // https://code.woboq.org/qt5/qtdeclarative/src/quick/items/qquickmousearea.cpp.html#47curLocalPos
-        // Coordinate mapping in qt quick is even more a nightmare than with graphics view...
-        // BTW, this code is probably buggy for deep quick item hierarchy.
-        const QPointF startLocalPos = parentItem() != nullptr ? parentItem()->mapFromScene(_dragInitialPos) :
-                                                                QPointF{.0, 0.};
-        const QPointF curLocalPos = parentItem() != nullptr ? parentItem()->mapFromScene(mePos) :
-                                                              QPointF{0., 0.};
-        const QPointF delta{curLocalPos - startLocalPos};
-
-        if (_target) {
-            auto childrenRect = _targetContent ? _targetContent->childrenRect() : QRectF{};
-            if (childrenRect.size().isEmpty())  // Note 20231208: Fix a nasty bug (Qt 5.15.13 ?) where size() is empty when there
-                childrenRect = QRectF{};   // is no longer any childs but rect position is left with invalid value.
-            const auto targetContentMinHeight = _targetContent ? childrenRect.y() + childrenRect.height() : 0;
-            const auto minimumTargetHeight = qMax(_minimumTargetSize.height(), targetContentMinHeight);
-            const auto targetContentMinWidth = _targetContent ? childrenRect.x() + childrenRect.width() : 0;
-            const auto minimumTargetWidth = qMax(_minimumTargetSize.width(), targetContentMinWidth);
-
-            const qreal targetWidth = _targetInitialSize.width() + delta.x();
-
-            if (targetWidth > minimumTargetWidth)       // Do not resize below minimumSize
-                _target->setWidth(targetWidth);
-            if (_preserveRatio) {
-                const qreal finalTargetWidth = targetWidth > minimumTargetWidth ? targetWidth :
-                                                                                  minimumTargetWidth;
-                const qreal targetHeight = finalTargetWidth * getRatio();
-                if (targetHeight > minimumTargetHeight)
-                    _target->setHeight(targetHeight);
-            } else {
-                const qreal targetHeight = _targetInitialSize.height() + delta.y();
-                if (targetHeight > minimumTargetHeight)
-                    _target->setHeight(targetHeight);
-            }
-            event->setAccepted(true);
+            !_targetInitialSize.isEmpty() &&
+            _target) {
+        _moveCoalescer.move(mePos, _coalesceMoves ? window() : nullptr);  // Coalesce moves to one resize per frame
+        event->setAccepted(true);
+    }
+}
+
+void    BottomRightResizer::resizeTo(const QPointF& scenePos)
+{
+    if (_dragInitialPos.isNull() ||
+        _targetInitialSize.isEmpty())
+        return;
+    // Inspired by void QQuickMouseArea::mouseMoveEvent(QMouseEvent *event)
+    // https://code.woboq.org/qt5/qtdeclarative/src/quick/items/qquickmousearea.cpp.html#47curLocalPos
+    // Coordinate mapping in qt quick is even more a nightmare than with graphics view...
+    // BTW, this code is probably buggy for deep quick item hierarchy.
+    const QPointF startLocalPos = parentItem() != nullptr ? parentItem()->mapFromScene(_dragInitialPos) :
+                                                            QPointF{.0, 0.};
+    const QPointF curLocalPos = parentItem() != nullptr ? parentItem()->mapFromScene(scenePos) :
+                                                          QPointF{0., 0.};
+    const QPointF delta{curLocalPos - startLocalPos};
+
+    if (_target) {
+        auto size = _preview && _previewSize.isValid() ? _previewSize :
+                                                         QSizeF{_target->width(), _target->height()};
+        auto childrenRect = _targetContent ? _targetContent->childrenRect() : QRectF{};
+        if (childrenRect.size().isEmpty())  // Note 20231208: Fix a nasty bug (Qt 5.15.13 ?) where size() is empty when there
+            childrenRect = QRectF{};   // is no longer any childs but rect position is left with invalid value.
+        const auto targetContentMinHeight = _targetContent ? childrenRect.y() + childrenRect.height() : 0;
+        const auto minimumTargetHeight = qMax(_minimumTargetSize.height(), targetContentMinHeight);
+        const auto targetContentMinWidth = _targetContent ? childrenRect.x() + childrenRect.width() : 0;
+        const auto minimumTargetWidth = qMax(_minimumTargetSize.width(), targetContentMinWidth);
+
+        const qreal targetWidth = _targetInitialSize.width() + delta.x();
+
+        if (targetWidth > minimumTargetWidth)       // Do not resize below minimumSize
+            size.setWidth(targetWidth);
+        if (_preserveRatio) {
+            const qreal finalTargetWidth = targetWidth > minimumTargetWidth ? targetWidth :
+                                                                              minimumTargetWidth;
+            const qreal targetHeight = finalTargetWidth * getRatio();
+            if (targetHeight > minimumTargetHeight)
+                size.setHeight(targetHeight);
+        } else {
+            const qreal targetHeight = _targetInitialSize.height() + delta.y();
+            if (targetHeight > minimumTargetHeight)
+                size.setHeight(targetHeight);
         }
+        applyTargetSize(size);
     }
 }
 
+void    BottomRightResizer::applyTargetSize(const QSizeF& size)
+{
+    if (!_target)
+        return;
+    if (!_preview) {
+        _target->setSize(size);
+        return;
+    }
+    _previewSize = size;
+    if (!_previewItem)
+        _previewItem = qan::createResizePreview(this, Qt::darkBlue);
+    if (_previewItem && parentItem() != nullptr) {
+        _previewItem->setParentItem(parentItem());
+        _previewItem->setPosition(_target->mapToItem(parentItem(), QPointF{0., 0.}));
+        _previewItem->setSize(size);
+        _previewItem->setZ(z() - 1.);
+        _previewItem->setVisible(true);
+    }
+}
+
+void    BottomRightResizer::commitPreview()
+{
+    if (_target &&
+        _previewSize.isValid())
+        _target->setSize(_previewSize);     // Target is resized once with final size
+    _previewSize = QSizeF{};
+    if (_previewItem)
+        _previewItem->setVisible(false);
+}
+
 void    BottomRightResizer::mousePressEvent(QMouseEvent* event)
 {
     if (!isVisible())
         return;
     const auto mePos = event->scenePosition();
     if (_target) {
+        _moveCoalescer.cancel();
+        _previewSize = QSizeF{};
         _dragInitialPos = mePos;
         _targetInitialSize = QSizeF{_target->width(), _target->height()};
         emit resizeStart(_target ? QSizeF{_target->width(), _target->height()} :
@@ -388,6 +448,10 @@ void    BottomRightResizer::mousePressEvent(QMouseEvent* event)
 void    BottomRightResizer::mouseReleaseEvent(QMouseEvent* event)
 {
     Q_UNUSED(event)
+    _moveCoalescer.flush();           // Apply last coalesced move, final size match last pointer position
+    if (_preview ||
+        _previewSize.isValid())       // Preview might have been disabled while dragging
+        commitPreview();
     _dragInitialPos = {0., 0.};       // Invalid all cached coordinates when button is released
     _targetInitialSize = {0., 0.};
     if (_target)
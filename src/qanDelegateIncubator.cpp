@@ -0,0 +1,71 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanDelegateIncubator.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// QuickQanava headers
+#include "./qanDelegateIncubator.h"
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/* DelegateIncubator Object Management *///------------------------------------
+DelegateIncubator::DelegateIncubator(qan::Graph& graph, QQmlComponent& component, qan::Style& style,
+                                     qan::Node* node, qan::Edge* edge) noexcept :
+    QQmlIncubator{QQmlIncubator::Asynchronous},
+    _graph{&graph},
+    _component{&component},
+    _style{&style},
+    _node{node},
+    _edge{edge}
+{ }
+
+void    DelegateIncubator::setInitialState(QObject* object)
+{
+    if (_graph)
+        _graph->initializeIncubatedItem(*this, object);
+}
+
+void    DelegateIncubator::statusChanged(QQmlIncubator::Status status)
+{
+    if (status != QQmlIncubator::Ready &&
+        status != QQmlIncubator::Error)
+        return;
+    if (!_finished &&
+        _graph) {
+        _finished = true;
+        _graph->delegateIncubated(*this);
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
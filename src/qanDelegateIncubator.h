@@ -0,0 +1,95 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanDelegateIncubator.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QPointer>
+#include <QQmlIncubator>
+#include <QQmlComponent>
+
+// QuickQanava headers
+#include "./qanStyle.h"
+
+namespace qan { // ::qan
+
+class Graph;
+class Node;
+class Edge;
+
+/*! \brief Asynchronously create a node or edge delegate item for qan::Graph \c asynchronousInsertion mode.
+ *
+ * Incubator configure item graph, style and node in setInitialState() (before item bindings are evaluated), then
+ * notify graph once item is ready (or in error) with qan::Graph::delegateIncubated(). Incubation is driven by
+ * qan::Graph within a per frame time budget.
+ *
+ * Target node or edge is monitored: if it is destroyed during incubation, graph destroy the incubated item.
+ *
+ * \nosubgrouping
+ */
+class DelegateIncubator : public QQmlIncubator
+{
+    /*! \name DelegateIncubator Object Management *///-------------------------
+    //@{
+public:
+    explicit DelegateIncubator(qan::Graph& graph, QQmlComponent& component, qan::Style& style,
+                               qan::Node* node, qan::Edge* edge) noexcept;
+    virtual ~DelegateIncubator() override = default;
+    DelegateIncubator(const DelegateIncubator&) = delete;
+
+public:
+    inline QQmlComponent*   getComponent() const noexcept { return _component.data(); }
+    inline qan::Style*      getStyle() const noexcept { return _style.data(); }
+    inline qan::Node*       getNode() const noexcept { return _node.data(); }
+    inline qan::Edge*       getEdge() const noexcept { return _edge.data(); }
+
+    //! True once incubation is ready or in error and graph has been notified.
+    inline bool             isFinished() const noexcept { return _finished; }
+
+protected:
+    virtual void    setInitialState(QObject* object) override;
+    virtual void    statusChanged(QQmlIncubator::Status status) override;
+
+private:
+    QPointer<qan::Graph>    _graph;
+    QPointer<QQmlComponent> _component;
+    QPointer<qan::Style>    _style;
+    QPointer<qan::Node>     _node;
+    QPointer<qan::Edge>     _edge;
+    bool                    _finished = false;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
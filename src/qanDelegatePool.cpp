@@ -0,0 +1,153 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanDelegatePool.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// QuickQanava headers
+#include "./qanDelegatePool.h"
+
+namespace qan { // ::qan
+
+/* DelegatePool Object Management *///-----------------------------------------
+DelegatePool::~DelegatePool() { clear(); }
+
+void    DelegatePool::clear() noexcept
+{
+    for (auto& [key, bucket] : _buckets) {
+        for (auto& item : bucket.items)
+            if (item)
+                item->deleteLater();
+    }
+    _buckets.clear();
+}
+
+void    DelegatePool::purge() noexcept
+{
+    for (auto bucket = _buckets.begin(); bucket != _buckets.end(); ) {
+        if (bucket->second.isStale()) {
+            for (auto& item : bucket->second.items)
+                if (item)
+                    item->deleteLater();
+            bucket = _buckets.erase(bucket);
+        } else
+            ++bucket;
+    }
+}
+
+void    DelegatePool::setCapacity(std::size_t capacity) noexcept
+{
+    _capacity = capacity;
+    for (auto& [key, bucket] : _buckets) {
+        while (bucket.items.size() > _capacity) {
+            if (bucket.items.back())
+                bucket.items.back()->deleteLater();
+            bucket.items.pop_back();
+        }
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Pooling Management *///-----------------------------------------------------
+QQuickItem* DelegatePool::acquire(const QQmlComponent* component, const qan::Style* style) noexcept
+{
+    const auto bucket = _buckets.find(Key{component, style});
+    if (bucket != _buckets.end()) {
+        if (bucket->second.isStale()) {     // Component or style has been destroyed, items are stale
+            for (auto& item : bucket->second.items)
+                if (item)
+                    item->deleteLater();
+            _buckets.erase(bucket);
+        } else {
+            auto& items = bucket->second.items;
+            while (!items.empty()) {
+                QQuickItem* item = items.back().data();
+                items.pop_back();
+                if (item != nullptr) {      // Note: item might have been destroyed while pooled
+                    ++_hits;
+                    return item;
+                }
+            }
+        }
+    }
+    ++_misses;
+    return nullptr;
+}
+
+bool    DelegatePool::release(const QQmlComponent* component, const qan::Style* style, QQuickItem* item) noexcept
+{
+    if (item == nullptr ||
+        !canRelease(component, style))
+        return false;
+    auto& bucket = _buckets[Key{component, style}];
+    if (bucket.isStale()) {     // New bucket, or stale bucket for a destroyed component or style
+        for (auto& staleItem : bucket.items)
+            if (staleItem)
+                staleItem->deleteLater();
+        bucket.items.clear();
+        bucket.component = component;
+        bucket.style = style;
+    }
+    bucket.items.emplace_back(item);
+    ++_released;
+    return true;
+}
+
+bool    DelegatePool::canRelease(const QQmlComponent* component, const qan::Style* style) const noexcept
+{
+    if (component == nullptr ||
+        style == nullptr ||
+        _capacity == 0)
+        return false;
+    const auto bucket = _buckets.find(Key{component, style});
+    return bucket == _buckets.end() ||
+           bucket->second.items.size() < _capacity;
+}
+
+std::size_t DelegatePool::size() const noexcept
+{
+    std::size_t size = 0;
+    for (const auto& [key, bucket] : _buckets)
+        size += bucket.items.size();
+    return size;
+}
+//-----------------------------------------------------------------------------
+
+/* Pooling Statistics *///-----------------------------------------------------
+void    DelegatePool::resetStatistics() noexcept
+{
+    _hits = 0;
+    _misses = 0;
+    _released = 0;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,157 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanDelegatePool.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+// Qt headers
+#include <QPointer>
+#include <QQuickItem>
+#include <QQmlComponent>
+
+// QuickQanava headers
+#include "./qanStyle.h"
+
+namespace qan { // ::qan
+
+/*! \brief Recycle pool for graph primitives delegate items, pooled items are indexed by their delegate component and style.
+ *
+ * Pool is used by qan::Graph when \c delegatePooling is enabled: node and edge items of removed primitives are
+ * released to the pool instead of being destroyed, and acquired again by the next node or edge insertion
+ * using the same delegate component and style, avoiding a QQmlComponent::beginCreate()/completeCreate()
+ * round trip.
+ *
+ * Pool does not reset items, items are expected to be already detached and hidden when released (see
+ * qan::NodeItem::recycle() and qan::EdgeItem::recycle()). Pool own released items, they are destroyed
+ * with deleteLater() when the pool is cleared or destroyed.
+ *
+ * \nosubgrouping
+ */
+class DelegatePool
+{
+    /*! \name DelegatePool Object Management *///------------------------------
+    //@{
+public:
+    DelegatePool() = default;
+    ~DelegatePool();
+    DelegatePool(const DelegatePool&) = delete;
+    DelegatePool& operator=(const DelegatePool&) = delete;
+
+public:
+    //! Destroy all pooled items (statistics are not reset).
+    void            clear() noexcept;
+    //! Destroy pooled items whose component or style has been destroyed, other items are kept.
+    void            purge() noexcept;
+
+    //! Maximum number of items pooled for a given component and style (default to 256).
+    inline std::size_t  getCapacity() const noexcept { return _capacity; }
+    //! \copydoc getCapacity()
+    void                setCapacity(std::size_t capacity) noexcept;
+private:
+    std::size_t     _capacity = 256;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Pooling Management *///------------------------------------------
+    //@{
+public:
+    /*! \brief Take an item previously created from \c component with \c style out of the pool.
+     *
+     * \return A pooled item or nullptr if there is no item available (a miss), ownership goes to the caller.
+     */
+    QQuickItem*     acquire(const QQmlComponent* component, const qan::Style* style) noexcept;
+
+    /*! \brief Store \c item created from \c component with \c style in the pool.
+     *
+     * \return false if pool is full for \c component and \c style or arguments are invalid, \c item is
+     * then not owned by the pool.
+     */
+    bool            release(const QQmlComponent* component, const qan::Style* style, QQuickItem* item) noexcept;
+
+    //! Return true if an item created from \c component with \c style could be released in the pool.
+    bool            canRelease(const QQmlComponent* component, const qan::Style* style) const noexcept;
+
+    //! Number of pooled items.
+    std::size_t     size() const noexcept;
+
+private:
+    struct Key {
+        const QQmlComponent*    component = nullptr;
+        const qan::Style*       style = nullptr;
+        bool operator==(const Key& other) const noexcept {
+            return component == other.component && style == other.style;
+        }
+    };
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const noexcept {
+            const auto h1 = std::hash<const void*>{}(key.component);
+            const auto h2 = std::hash<const void*>{}(key.style);
+            return h1 ^ (h2 + 0x9e3779b9 + (h1 << 6) + (h1 >> 2));
+        }
+    };
+    struct Bucket {
+        //! Used to detect a component or style destroyed and reallocated at the same address.
+        QPointer<const QQmlComponent>       component;
+        QPointer<const qan::Style>          style;
+        std::vector<QPointer<QQuickItem>>   items;
+        inline bool isStale() const noexcept { return !component || !style; }
+    };
+    std::unordered_map<Key, Bucket, KeyHash>    _buckets;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Pooling Statistics *///------------------------------------------
+    //@{
+public:
+    //! Number of acquire() returning a pooled item.
+    inline std::size_t  getHits() const noexcept { return _hits; }
+    //! Number of acquire() returning nullptr.
+    inline std::size_t  getMisses() const noexcept { return _misses; }
+    //! Number of items successfully released in pool.
+    inline std::size_t  getReleased() const noexcept { return _released; }
+    //! Reset hits, misses and released counters.
+    void                resetStatistics() noexcept;
+private:
+    std::size_t         _hits = 0;
+    std::size_t         _misses = 0;
+    std::size_t         _released = 0;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
@@ -37,6 +37,10 @@
 #include "./qanNodeItem.h"
 #include "./qanGraph.h"
 
+// Std headers
+#include <unordered_map>
+#include <unordered_set>
+
 namespace qan { // ::qan
 
 /* Drag'nDrop Management *///--------------------------------------------------
@@ -137,8 +141,9 @@ bool    DraggableCtrl::handleMouseMoveEvent(QMouseEvent* event)
             // Project in scene rect (for example is a node is part of a group)
             beginDragMove(sceneDragPos, _targetItem->getSelected());
             return true;
-        } else {
-            dragMove(sceneDragPos, _targetItem->getSelected());
+        } else {    // Coalesce moves to one dragMove() per frame
+            _coalescedDragSelection = _targetItem->getSelected();
+            _moveCoalescer.move(sceneDragPos, graph->getCoalesceMoves() ? _targetItem->window() : nullptr);
             return true;
         }
     }
@@ -174,6 +179,7 @@ void    DraggableCtrl::beginDragMove(const QPointF& sceneDragPos, bool dragSelec
     if (graphContainerItem == nullptr)
         return;
 
+    _moveCoalescer.cancel();
     if (notify && _target->isGroup()) {
         const auto groupItem = qobject_cast<qan::GroupItem*>(_targetItem);
         const auto groupItemContainer = groupItem ? groupItem->getContainer() : nullptr;
@@ -235,22 +241,21 @@ void    DraggableCtrl::beginDragMove(const QPointF& sceneDragPos, bool dragSelec
         _initialTargetScenePos = rootItem->mapFromItem(_targetItem, QPointF{0,0});
 
     // If there is a selection, keep start position for all selected nodes.
+    _selectionDragItems.clear();
     if (dragSelection &&
         graph->hasMultipleSelection()) {
-            auto beginDragMoveSelected = [this, &sceneDragPos] (auto primitive) {    // Call beginDragMove() on a given node or group
+            auto beginDragMoveSelected = [this, &sceneDragPos] (auto primitive) {    // Call beginDragMove() on a given edge
                 if (primitive != nullptr &&
                     primitive->getItem() != nullptr &&
-                    static_cast<QQuickItem*>(primitive->getItem()) != static_cast<QQuickItem*>(this->_targetItem.data())/* &&
-                    primitive->get_group() == nullptr*/)      // Do not drag nodes that are inside a group
+                    static_cast<QQuickItem*>(primitive->getItem()) != static_cast<QQuickItem*>(this->_targetItem.data()))
                     // Note 20231029: Set notify to false since notyification is done "once" with nodesaboutToBeMoved() in
                     // the case of a multiple selection.
                     primitive->getItem()->draggableCtrl().beginDragMove(sceneDragPos, /*dragSelection*/false, /*notify*/false);
             };
 
-        // Call beginDragMove on all selected nodes and groups.
-        std::for_each(graph->getSelectedNodes().begin(), graph->getSelectedNodes().end(), beginDragMoveSelected);
+        // Selected nodes and groups are moved in batch by this controller, selected edges use their own controller.
+        beginDragMoveSelection(*graph);
         std::for_each(graph->getSelectedEdges().begin(), graph->getSelectedEdges().end(), beginDragMoveSelected);
-        std::for_each(graph->getSelectedGroups().begin(), graph->getSelectedGroups().end(), beginDragMoveSelected);
     }
 }
 
@@ -369,18 +374,16 @@ void    DraggableCtrl::dragMove(const QPointF& sceneDragPos, bool dragSelection,
 
     // 5.
     if (dragSelection) {
-        auto dragMoveSelected = [this, &sceneDragPos] (auto primitive) { // Call dragMove() on a given node or group
-            const auto primitiveIsNotSelf = static_cast<QQuickItem*>(primitive->getItem()) !=
-                                            static_cast<QQuickItem*>(this->_targetItem.data());
+        auto dragMoveSelected = [this, &sceneDragPos] (auto primitive) { // Call dragMove() on a given edge
             if (primitive != nullptr &&
                 primitive->getItem() != nullptr &&
-                primitiveIsNotSelf)       // Note: nodes inside a group or groups might be dragged too
+                static_cast<QQuickItem*>(primitive->getItem()) != static_cast<QQuickItem*>(this->_targetItem.data()))
                 primitive->getItem()->draggableCtrl().dragMove(sceneDragPos, /*dragSelection=*/false);
         };
 
-        std::for_each(graph->getSelectedNodes().begin(), graph->getSelectedNodes().end(), dragMoveSelected);
+        // Selection is moved rigidly with target delta (snap and orientation are resolved once for target)
+        dragMoveSelection(*graph, targetScenePos - _initialTargetScenePos, disableOrientation);
         std::for_each(graph->getSelectedEdges().begin(), graph->getSelectedEdges().end(), dragMoveSelected);
-        std::for_each(graph->getSelectedGroups().begin(), graph->getSelectedGroups().end(), dragMoveSelected);
     }
 
     // 6. Eventually, propose a node group drop after move
@@ -411,6 +414,7 @@ void    DraggableCtrl::dragMove(const QPointF& sceneDragPos, bool dragSelection,
 
 void    DraggableCtrl::endDragMove(bool dragSelection, bool notify)
 {
+    _moveCoalescer.flush();     // Apply last coalesced move, drag end position is last pointer position
     _initialSceneDragPos = QPointF{0., 0.};    // Invalid all cached coordinates when drag ends
     _initialTargetScenePos = QPointF{0., 0.};
     _lastProposedGroup = nullptr;
@@ -445,6 +449,7 @@ void    DraggableCtrl::endDragMove(bool dragSelection, bool notify)
     //qWarning() << "  notify=" << notify;
 
     bool nodeGrouped = false;
+    qan::Group* dropGroup = nullptr;
     if (_targetItem->getDroppable()) {
         const auto targetScenePos = _targetItem->mapToItem(graphContainerItem, QPointF{0., 0.});
         qan::Group* group = graph->groupAt(targetScenePos, { _targetItem->width(), _targetItem->height() }, _targetItem);
@@ -455,23 +460,24 @@ void    DraggableCtrl::endDragMove(bool dragSelection, bool notify)
                 !group->getLocked()) {
                 graph->groupNode(group, _target.data());
                 nodeGrouped = true;
+                dropGroup = group;
             }
         }
     }
 
     _targetItem->setDragged(false);
 
+    if (dragSelection)                 // End drag for batch dragged selection items (even if selection changed during drag)
+        endDragMoveSelection(*graph, dropGroup);
     if (dragSelection &&               // If there is a selection, end drag for the whole selection
         graph->hasMultipleSelection()) {
-        auto enDragMoveSelected = [this] (auto primitive) { // Call dragMove() on a given node or group
+        auto enDragMoveSelected = [this] (auto primitive) { // Call dragMove() on a given edge
             if ( primitive != nullptr &&
                  primitive->getItem() != nullptr &&
                  static_cast<QQuickItem*>(primitive->getItem()) != static_cast<QQuickItem*>(this->_targetItem.data()))
                 primitive->getItem()->draggableCtrl().endDragMove(/*dragSelection*/false, /*notify*/false);
         };
-        std::for_each(graph->getSelectedNodes().begin(), graph->getSelectedNodes().end(), enDragMoveSelected);
         std::for_each(graph->getSelectedEdges().begin(), graph->getSelectedEdges().end(), enDragMoveSelected);
-        std::for_each(graph->getSelectedGroups().begin(), graph->getSelectedGroups().end(), enDragMoveSelected);
     }
 
     // Note 20231029:
@@ -497,6 +503,157 @@ void    DraggableCtrl::endDragMove(bool dragSelection, bool notify)
         }
     }
 }
+
+void    DraggableCtrl::beginDragMoveSelection(qan::Graph& graph)
+{
+    // PRECONDITIONS:
+        // graph must have a container item for coordinate mapping
+        // _target must be configured (true)
+    _selectionDragItems.clear();
+    const auto graphContainerItem = graph.getContainerItem();
+    if (graphContainerItem == nullptr ||
+        !_target)
+        return;
+
+    // Algorithm:
+        // 1. Collect dragged groups (selected groups and target if it is a group).
+        // 2. Collect selected node and group items that are not inside a dragged group (they are moved
+        //    with their group), with their initial position in graph container CS.
+    std::unordered_set<const qan::Node*> draggedGroups;     // 1.
+    for (const auto& group : graph.getSelectedGroups())
+        if (group)
+            draggedGroups.insert(group.data());
+    if (_target->isGroup())
+        draggedGroups.insert(_target.data());
+    const auto isInDraggedGroup = [&draggedGroups](const qan::Node* node) {
+        for (const qan::Group* group = node->getGroup(); group != nullptr; group = group->getGroup())
+            if (draggedGroups.find(group) != draggedGroups.end())
+                return true;
+        return false;
+    };
+
+    const auto dragZ = graph.getMaxZ() + 10.;               // 2.
+    const auto collectSelected = [&](qan::Node* primitive) {
+        if (primitive == nullptr ||
+            primitive == _target.data())
+            return;
+        const auto item = primitive->getItem();
+        if (item == nullptr ||
+            primitive->getIsProtected() ||  // Prevent dragging of protected or locked objects
+            primitive->getLocked() ||
+            isInDraggedGroup(primitive))
+            return;
+        const auto scenePos = graphContainerItem->mapFromItem(item, QPointF{0., 0.});
+        _selectionDragItems.push_back(SelectionDragItem{item, scenePos, scenePos, item->z()});
+        item->setDragged(true);
+        if (!primitive->isGroup())   // Force maximum graph z when dragging a node, restored in endDragMoveSelection()
+            item->setZ(dragZ);
+    };
+    _selectionDragItems.reserve(static_cast<std::size_t>(graph.getSelectedNodes().size() +
+                                                         graph.getSelectedGroups().size()));
+    for (const auto& node : graph.getSelectedNodes())
+        collectSelected(node.data());
+    for (const auto& group : graph.getSelectedGroups())
+        collectSelected(group.data());
+}
+
+void    DraggableCtrl::dragMoveSelection(qan::Graph& graph, const QPointF& sceneDelta, bool disableOrientation)
+{
+    // PRECONDITIONS:
+        // graph must have a container item for coordinate mapping
+    const auto graphContainerItem = graph.getContainerItem();
+    if (graphContainerItem == nullptr ||
+        _selectionDragItems.empty())
+        return;
+
+    // Algorithm:
+        // For all collected items:
+        // 1. Apply target delta to item initial position (taking item drag orientation into account).
+        // 2. For grouped items, ungroup item if it is moved outside of its group.
+        // 3. Apply item position once, converted in an eventual parent group CS.
+        // Note: group items are never transformed, group origin in graph container CS is cached per
+        // group to avoid a full mapToItem() per item; groups hosting collected items are not dragged.
+    std::unordered_map<const QQuickItem*, QPointF> groupOrigins;
+    const auto groupOrigin = [&groupOrigins, graphContainerItem](const qan::GroupItem* groupItem) -> QPointF {
+        auto origin = groupOrigins.find(groupItem);
+        if (origin == groupOrigins.end())
+            origin = groupOrigins.emplace(groupItem, graphContainerItem->mapToItem(groupItem, QPointF{0., 0.})).first;
+        return origin->second;
+    };
+
+    for (auto& dragItem : _selectionDragItems) {
+        const auto item = dragItem.item.data();
+        const auto node = item != nullptr ? item->getNode() : nullptr;
+        if (node == nullptr)
+            continue;
+        // 1.
+        const auto orientation = item->getDragOrientation();
+        const auto dragHorizontally = disableOrientation ||
+                                      ((orientation == qan::NodeItem::DragOrientation::DragAll) ||
+                                       (orientation == qan::NodeItem::DragOrientation::DragHorizontal));
+        const auto dragVertically = disableOrientation ||
+                                    ((orientation == qan::NodeItem::DragOrientation::DragAll) ||
+                                     (orientation == qan::NodeItem::DragOrientation::DragVertical));
+        dragItem.scenePos = QPointF{dragItem.initialScenePos.x() + (dragHorizontally ? sceneDelta.x() : 0.),
+                                    dragItem.initialScenePos.y() + (dragVertically ? sceneDelta.y() : 0.)};
+        // 2.
+        auto groupItem = node->getGroup() != nullptr ? node->getGroup()->getGroupItem() : nullptr;
+        if (groupItem != nullptr) {
+            const QRectF itemRect{dragItem.scenePos + groupOrigin(groupItem),
+                                  QSizeF{item->width(), item->height()}};
+            const QRectF groupRect{QPointF{0., 0.},
+                                   QSizeF{groupItem->width(), groupItem->height()}};
+            if (!groupRect.contains(itemRect)) {
+                graph.ungroupNode(node, node->get_group());
+                groupItem = node->getGroup() != nullptr ? node->getGroup()->getGroupItem() : nullptr;
+            }
+        }
+        // 3.
+        item->setPosition(groupItem != nullptr ? dragItem.scenePos + groupOrigin(groupItem) :
+                                                 dragItem.scenePos);
+    }
+}
+
+void    DraggableCtrl::endDragMoveSelection(qan::Graph& graph, qan::Group* dropGroup)
+{
+    // Algorithm:
+        // Drop group has been queried once for target in endDragMove(): collected items that are
+        // contained in target drop group are grouped too (no per item groupAt() query).
+    const auto graphContainerItem = graph.getContainerItem();
+    const auto dropGroupItem = dropGroup != nullptr ? dropGroup->getGroupItem() : nullptr;
+    QRectF dropRect;
+    if (graphContainerItem != nullptr &&
+        dropGroupItem != nullptr)
+        dropRect = QRectF{graphContainerItem->mapFromItem(dropGroupItem, QPointF{0., 0.}),
+                          QSizeF{dropGroupItem->width(), dropGroupItem->height()}};
+    const auto isDropGroupOrParent = [dropGroup](const qan::Node* node) {  // Do not drop a group in itself or in a sub group
+        for (const qan::Group* group = dropGroup; group != nullptr; group = group->getGroup())
+            if (static_cast<const qan::Node*>(group) == node)
+                return true;
+        return false;
+    };
+
+    for (const auto& dragItem : _selectionDragItems) {
+        const auto item = dragItem.item.data();
+        const auto node = item != nullptr ? item->getNode() : nullptr;
+        if (node == nullptr)
+            continue;
+        if (!node->isGroup())
+            item->setZ(dragItem.initialZ);
+        item->setDragged(false);
+        if (!dropRect.isValid() ||
+            !item->getDroppable() ||
+            node->getGroup() == dropGroup ||
+            isDropGroupOrParent(node))
+            continue;
+        const QRectF itemRect{dragItem.scenePos, QSizeF{item->width(), item->height()}};
+        const auto dropped = dropGroupItem->getStrictDrop() ? dropRect.contains(itemRect) :
+                                                              dropRect.contains(itemRect.topLeft());
+        if (dropped)
+            graph.groupNode(dropGroup, node);
+    }
+    _selectionDragItems.clear();
+}
 //-----------------------------------------------------------------------------
 
 } // ::qan
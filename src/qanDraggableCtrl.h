@@ -41,9 +41,13 @@
 #include <QDrag>
 #include <QPointer>
 
+// Std headers
+#include <vector>
+
 // QuickQanava headers
 #include "./qanAbstractDraggableCtrl.h"
 #include "./qanGroup.h"
+#include "./qanMoveCoalescer.h"
 
 namespace qan { // ::qan
 
@@ -113,11 +117,42 @@ private:
     QPointF                 _initialSceneDragPos{0., 0.};
     //! Internal (target) initial dragging position.
     QPointF                 _initialTargetScenePos{0., 0.};
+
+    //! Coalesce mouse drag moves to one dragMove() per frame (see qan::Graph::coalesceMoves).
+    qan::MoveCoalescer      _moveCoalescer{[this](const QPointF& sceneDragPos) {
+                                dragMove(sceneDragPos, _coalescedDragSelection);
+                            }};
+    //! \c dragSelection argument for coalesced dragMove().
+    bool                    _coalescedDragSelection = true;
     //! Internal (target) initial dragging z.
     double                  _initialTargetZ = 0.;
 
     //! Last group hovered during a node drag (cached to generate a dragLeave signal on qan::Group).
     QPointer<qan::Group>    _lastProposedGroup{nullptr};
+
+private:
+    //! Node or group item dragged along with target in a multiple selection drag.
+    struct SelectionDragItem {
+        QPointer<qan::NodeItem> item;
+        //! Item position in graph container CS when drag started.
+        QPointF     initialScenePos;
+        //! Item position in graph container CS after last dragMove().
+        QPointF     scenePos;
+        double      initialZ = 0.;
+    };
+    /*! \brief Selected node and group items moved in batch with target during a multiple selection drag.
+     *
+     * Collected once in beginDragMove(): items that are inside a dragged group are not collected
+     * (they move with their group). Selected edges are still dragged with their own controller.
+     */
+    std::vector<SelectionDragItem>  _selectionDragItems;
+
+    //! Collect selected node and group items in _selectionDragItems and mark them as dragged.
+    void    beginDragMoveSelection(qan::Graph& graph);
+    //! Move all collected items by target \c sceneDelta (target delta, including snap and orientation).
+    void    dragMoveSelection(qan::Graph& graph, const QPointF& sceneDelta, bool disableOrientation);
+    //! End selection drag, eventually grouping selected items in \c dropGroup (target drop group).
+    void    endDragMoveSelection(qan::Graph& graph, qan::Group* dropGroup);
     //@}
     //-------------------------------------------------------------------------
 };
@@ -68,6 +68,13 @@ void    Edge::setItem(qan::EdgeItem* edgeItem) noexcept
             edgeItem->setEdge(this);
     }
 }
+
+qan::EdgeItem*  Edge::takeItem() noexcept
+{
+    const auto item = _item.data();
+    _item.clear();
+    return item;
+}
 //-----------------------------------------------------------------------------
 
 /* Edge Static Factories *///--------------------------------------------------
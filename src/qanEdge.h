@@ -79,6 +79,8 @@ public:
     Q_PROPERTY(qan::EdgeItem* item READ getItem CONSTANT)
     qan::EdgeItem*   getItem() noexcept;
     virtual void     setItem(qan::EdgeItem* edgeItem) noexcept;
+    //! Detach and return edge item without destroying it (item is no longer destroyed with this edge).
+    qan::EdgeItem*   takeItem() noexcept;
 private:
     QPointer<qan::EdgeItem> _item;
     //@}
@@ -0,0 +1,630 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeBatchRenderer.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <unordered_set>
+
+// Qt headers
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+#include <QtMath>
+
+// QuickQanava headers
+#include "./qanEdgeBatchRenderer.h"
+#include "./qanGraph.h"
+#include "./qanEdgeItem.h"
+#include "./qanGroupItem.h"
+#include "./qanUtils.h"
+
+namespace qan { // ::qan
+
+namespace impl { // qan::impl
+
+using Vertex = QSGGeometry::ColoredPoint2D;
+
+struct VertexColor {
+    uchar r = 0, g = 0, b = 0, a = 255;
+};
+
+//! QSGVertexColorMaterial expect premultiplied colors.
+VertexColor premultiplied(const QColor& color) noexcept
+{
+    const auto a = color.alphaF();
+    return VertexColor{static_cast<uchar>(qRound(color.redF() * a * 255.)),
+                       static_cast<uchar>(qRound(color.greenF() * a * 255.)),
+                       static_cast<uchar>(qRound(color.blueF() * a * 255.)),
+                       static_cast<uchar>(qRound(a * 255.))};
+}
+
+inline void appendTriangle(std::vector<Vertex>& vertices,
+                           const QPointF& a, const QPointF& b, const QPointF& c,
+                           const VertexColor& color)
+{
+    for (const auto& p : {a, b, c}) {
+        Vertex v;
+        v.set(static_cast<float>(p.x()), static_cast<float>(p.y()),
+              color.r, color.g, color.b, color.a);
+        vertices.push_back(v);
+    }
+}
+
+//! Append a \c width wide quad for segment \c ab, segment is extended by \c extension at both ends.
+void    appendSegment(std::vector<Vertex>& vertices,
+                      const QPointF& a, const QPointF& b,
+                      qreal width, qreal extension, const VertexColor& color)
+{
+    const QPointF d = b - a;
+    const auto length = std::hypot(d.x(), d.y());
+    if (length < 0.0001)
+        return;
+    const QPointF u = d / length;
+    const QPointF n{-u.y() * width / 2., u.x() * width / 2.};
+    const QPointF a2 = a - (u * extension);
+    const QPointF b2 = b + (u * extension);
+    appendTriangle(vertices, a2 + n, b2 + n, a2 - n, color);
+    appendTriangle(vertices, b2 + n, b2 - n, a2 - n, color);
+}
+
+/*! \brief Append \c points polyline triangles, line is dashed when \c dashPattern is non null.
+ *
+ * \c dashPattern follow ShapePath.dashPattern semantic: alternate dash and space length expressed
+ * in line \c width units.
+ */
+void    appendPolyline(std::vector<Vertex>& vertices, const std::vector<QPointF>& points,
+                       qreal width, qreal extension, const QVector<qreal>* dashPattern,
+                       const VertexColor& color)
+{
+    if (points.size() < 2)
+        return;
+    if (dashPattern == nullptr ||
+        dashPattern->size() < 2) {
+        for (std::size_t p = 1; p < points.size(); p++)
+            appendSegment(vertices, points[p - 1], points[p], width, extension, color);
+        return;
+    }
+    // Walk the polyline, consuming dash and space lengths
+    const auto dashLength = [&](int d) { return std::max(dashPattern->at(d) * width, 0.5); };
+    int dash = 0;
+    auto remaining = dashLength(dash);
+    for (std::size_t p = 1; p < points.size(); p++) {
+        QPointF a = points[p - 1];
+        const QPointF b = points[p];
+        auto length = QLineF{a, b}.length();
+        while (length > 0.0001) {
+            const auto step = std::min(length, remaining);
+            const QPointF c = a + ((b - a) * (step / length));
+            if ((dash % 2) == 0)
+                appendSegment(vertices, a, c, width, 0., color);
+            a = c;
+            length -= step;
+            remaining -= step;
+            if (remaining <= 0.0001) {
+                dash = (dash + 1) % static_cast<int>(dashPattern->size());
+                remaining = dashLength(dash);
+            }
+        }
+    }
+}
+
+//! Append \c rect as two triangles.
+void    appendRect(std::vector<Vertex>& vertices, const QRectF& rect, const VertexColor& color)
+{
+    appendTriangle(vertices, rect.topLeft(), rect.topRight(), rect.bottomLeft(), color);
+    appendTriangle(vertices, rect.topRight(), rect.bottomRight(), rect.bottomLeft(), color);
+}
+
+//! Append cubic bezier \c p1 \c c1 \c c2 \c p2 tessellation to \c points.
+void    flattenCubic(std::vector<QPointF>& points,
+                     const QPointF& p1, const QPointF& c1, const QPointF& c2, const QPointF& p2)
+{
+    const auto hull = QLineF{p1, c1}.length() + QLineF{c1, c2}.length() + QLineF{c2, p2}.length();
+    const int steps = std::clamp(static_cast<int>(hull / 8.), 4, 64);
+    points.push_back(p1);
+    for (int s = 1; s <= steps; s++) {
+        const qreal t = static_cast<qreal>(s) / steps;
+        const qreal mt = 1. - t;
+        points.push_back((p1 * (mt * mt * mt)) + (c1 * (3. * mt * mt * t)) +
+                         (c2 * (3. * mt * t * t)) + (p2 * (t * t * t)));
+    }
+}
+
+/*! \brief Append an edge end shape, \c a1, \c a2 and \c a3 are expressed in end shape local CS.
+ *
+ * Follow EdgeTemplate.qml end shapes: local CS origin is \c position, rotated by \c angle degrees.
+ */
+void    appendEndShape(std::vector<Vertex>& vertices, std::vector<QPointF>& buffer,
+                       qan::EdgeStyle::ArrowShape shape, const QPointF& position, qreal angle,
+                       const QPointF& a1, const QPointF& a2, const QPointF& a3,
+                       qreal lineWidth, const VertexColor& color)
+{
+    using ArrowShape = qan::EdgeStyle::ArrowShape;
+    if (shape == ArrowShape::None)
+        return;
+    const auto radians = qDegreesToRadians(angle);
+    const auto cos = std::cos(radians);
+    const auto sin = std::sin(radians);
+    const auto map = [&](const QPointF& p) {
+        return position + QPointF{(p.x() * cos) - (p.y() * sin), (p.x() * sin) + (p.y() * cos)};
+    };
+    buffer.clear();
+    switch (shape) {
+    case ArrowShape::None: return;
+    case ArrowShape::Arrow:      // [[fallthrough]]
+    case ArrowShape::ArrowOpen: {
+        const auto hw = lineWidth / 2.;  // See EdgeDstArrowPath.qml
+        buffer = {map(QPointF{a1.x(), a1.y() - hw}), map(QPointF{a3.x(), a3.y() + hw}), map(a2)};
+    } break;
+    case ArrowShape::Rect:       // [[fallthrough]]
+    case ArrowShape::RectOpen:
+        buffer = {map(a1), map(QPointF{0., 0.}), map(a3), map(a2)};
+        break;
+    case ArrowShape::Circle:     // [[fallthrough]]
+    case ArrowShape::CircleOpen: {  // Circle go from local origin to a2 with a1.x radius
+        constexpr int segments = 16;
+        const QPointF center = a2 / 2.;
+        const auto radius = std::abs(a1.x());
+        for (int s = 0; s < segments; s++) {
+            const auto t = (2. * M_PI * s) / segments;
+            buffer.push_back(map(center + QPointF{radius * std::cos(t), radius * std::sin(t)}));
+        }
+    } break;
+    }
+    const auto open = shape == ArrowShape::ArrowOpen ||
+                      shape == ArrowShape::RectOpen ||
+                      shape == ArrowShape::CircleOpen;
+    if (open) {
+        buffer.push_back(buffer.front());   // Close the outline
+        appendPolyline(vertices, buffer, shape == ArrowShape::ArrowOpen ? 2. : lineWidth,
+                       0., nullptr, color);
+    } else {                                // Fill convex polygon with a fan
+        for (std::size_t p = 2; p < buffer.size(); p++)
+            appendTriangle(vertices, buffer[0], buffer[p - 1], buffer[p], color);
+    }
+}
+
+} // ::qan::impl
+
+/* EdgeBatchRenderer Object Management *///-----------------------------------
+EdgeBatchRenderer::EdgeBatchRenderer(QQuickItem* parent) :
+    QQuickItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+    setEnabled(false);      // Mouse events are handled in qan::EdgeItem
+}
+
+EdgeBatchRenderer::~EdgeBatchRenderer()
+{
+    for (const auto& layer : _layers)   // Layers are siblings in container, not children
+        delete layer.data();
+}
+
+void    EdgeBatchRenderer::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph != _graph) {
+        if (_graph)
+            disconnect(_graph, nullptr, this, nullptr);
+        _graph = graph;
+        if (_graph)     // Note: Edges selection changes are notified per edge (see qan::EdgeItem::requestBatchUpdate())
+            connect(_graph, &qan::Graph::selectionColorChanged,
+                    this,   &qan::EdgeBatchRenderer::requestUpdate);
+        requestUpdate();
+    }
+}
+
+void    EdgeBatchRenderer::requestUpdate() noexcept
+{
+    _allDirty = true;
+    _dirtyItems.clear();
+    polish();   // Coalesced by Qt Quick, updatePolish() is called at most once per frame
+}
+
+void    EdgeBatchRenderer::requestItemUpdate(QQuickItem* item) noexcept
+{
+    if (item == nullptr)
+        return;
+    if (!_allDirty)
+        _dirtyItems.push_back(item);
+    polish();
+}
+
+void    EdgeBatchRenderer::invalidateLayers() noexcept
+{
+    _layersValid = false;
+    requestUpdate();
+}
+
+void    EdgeBatchRenderer::setMinimal(bool minimal) noexcept
+{
+    if (minimal != _minimal) {
+        _minimal = minimal;
+        requestUpdate();
+    }
+}
+//-----------------------------------------------------------------------------
+
+/* Edges Rendering *///--------------------------------------------------------
+void    EdgeBatchRenderer::Batch::set(const QQuickItem* item, std::vector<Vertex>& vertices)
+{
+    auto slot = std::size_t{0};
+    const auto found = index.find(item);
+    if (found != index.end())
+        slot = found->second;
+    else if (!freeSlots.empty()) {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    } else {
+        slot = slots.size();
+        slots.emplace_back();
+        items.push_back(nullptr);
+        if (slot / itemsPerChunk >= dirtyChunks.size())
+            dirtyChunks.push_back(true);
+    }
+    index[item] = slot;
+    items[slot] = item;
+    vertexCount -= slots[slot].size();
+    vertexCount += vertices.size();
+    slots[slot].swap(vertices);
+    dirtyChunks[slot / itemsPerChunk] = true;
+}
+
+bool    EdgeBatchRenderer::Batch::remove(const QQuickItem* item)
+{
+    const auto found = index.find(item);
+    if (found == index.end())
+        return false;
+    const auto slot = found->second;
+    index.erase(found);
+    vertexCount -= slots[slot].size();
+    slots[slot].clear();
+    items[slot] = nullptr;
+    freeSlots.push_back(slot);
+    dirtyChunks[slot / itemsPerChunk] = true;
+    return true;
+}
+
+void    EdgeBatchRenderer::Batch::clear()
+{
+    slots.clear();
+    items.clear();
+    freeSlots.clear();
+    index.clear();
+    dirtyChunks.clear();
+    vertexCount = 0;
+}
+
+std::size_t EdgeBatchRenderer::getVertexCount() const noexcept
+{
+    std::size_t count = 0;
+    for (const auto& batch : _batches)
+        count += batch.vertexCount;
+    for (const auto& layer : _layers)
+        if (layer)
+            count += layer->getVertexCount();
+    return count;
+}
+
+std::size_t EdgeBatchRenderer::getUploadedVertexCount() const noexcept
+{
+    auto count = _uploadedVertexCount;
+    for (const auto& layer : _layers)
+        if (layer)
+            count += layer->getUploadedVertexCount();
+    return count;
+}
+
+void    EdgeBatchRenderer::updatePolish()
+{
+    // Algorithm:
+        // 1. When all items are dirty (container, level of detail, layers or selection color change),
+        //    release all slots and queue all graph edges (and nodes in minimal mode).
+        // 2. Tessellate queued items only, in their layer renderer batch slot.
+        // 3. Only chunks containing a modified slot are uploaded in updatePaintNode().
+    const auto container = _graph ? _graph->getContainerItem() : nullptr;
+    if (container == nullptr ||
+        !isVisible()) {
+        clearItems();
+        _allDirty = true;       // Everything is collected again once visible
+        _dirtyItems.clear();
+        return;
+    }
+    if (!_layersValid)
+        _allDirty = true;       // Edges might have changed layer
+    if (_allDirty) {            // 1.
+        clearItems();
+        if (!_layersValid)
+            updateLayers(*container);
+        _dirtyItems.clear();
+        for (const auto edge : _graph->get_edges())
+            if (edge != nullptr &&
+                edge->getItem() != nullptr)
+                _dirtyItems.push_back(edge->getItem());
+        if (_minimal)           // Note: groups are nodes
+            for (const auto node : _graph->get_nodes())
+                if (node != nullptr &&
+                    node->getItem() != nullptr)
+                    _dirtyItems.push_back(node->getItem());
+        _allDirty = false;
+    }
+    std::unordered_set<const QQuickItem*> collected;
+    collected.reserve(_dirtyItems.size());
+    for (const auto& item : _dirtyItems)                    // 2.
+        if (item &&
+            collected.insert(item.data()).second)
+            collectItem(*item, *container);
+    _dirtyItems.clear();
+}
+
+void    EdgeBatchRenderer::collectItem(QQuickItem& item, const QQuickItem& container)
+{
+    const auto itemRect = [&container, this](const QQuickItem& target) {
+        const auto rect = target.parentItem() == &container ? QRectF{target.position(), target.size()} :
+                                                              target.mapRectToItem(&container, QRectF{QPointF{0., 0.}, target.size()});
+        return rect.translated(-position());
+    };
+    // Note: Minimal lod is drawn in a single layer (delegates are hidden): groups rects, then straight
+    // edges, then nodes rects (see Category).
+    _itemVertices.clear();
+    auto category = Category::Edges;
+    auto renderer = this;
+    const auto edgeItem = qobject_cast<const qan::EdgeItem*>(&item);
+    const auto nodeItem = edgeItem == nullptr ? qobject_cast<const qan::NodeItem*>(&item) : nullptr;
+    if (edgeItem != nullptr) {
+        if (!_minimal)
+            renderer = &getLayer(layerOf(*edgeItem, container));
+        const auto visible = edgeItem->isVisible() &&
+                             !edgeItem->getHidden() &&
+                             !_graph->isCulled(edgeItem);
+        if (visible &&
+            !_minimal) {
+            const auto origin = edgeItem->parentItem() == &container ? edgeItem->position() :
+                                                                       edgeItem->mapToItem(&container, QPointF{0., 0.});
+            appendEdge(_itemVertices, _polyline, *edgeItem, origin - renderer->position(), _graph->getSelectionColor());
+        } else if (visible) {
+            const auto origin = itemRect(*edgeItem).topLeft();
+            const auto style = edgeItem->getStyle();
+            const auto lineWidth = style != nullptr ? style->getLineWidth() : 2.;
+            const auto color = edgeItem->getSelected() ? _graph->getSelectionColor() :
+                                                         style != nullptr ? style->getLineColor() : QColor{0, 0, 0};
+            impl::appendSegment(_itemVertices, origin + edgeItem->getP1(), origin + edgeItem->getP2(),
+                                lineWidth, 0., impl::premultiplied(color));
+        }
+    } else if (nodeItem != nullptr &&
+               _minimal) {
+        category = qobject_cast<const qan::GroupItem*>(nodeItem) != nullptr ? Category::Groups :
+                                                                              Category::Nodes;
+        if (nodeItem->isVisible() &&
+            !_graph->isCulled(nodeItem)) {
+            const auto style = nodeItem->getStyle();
+            auto color = style != nullptr ? style->getBackColor() : QColor{Qt::white};
+            if (style != nullptr)
+                color.setAlphaF(static_cast<float>(color.alphaF() * std::clamp(style->getBackOpacity(), 0., 1.)));
+            impl::appendRect(_itemVertices, itemRect(*nodeItem), impl::premultiplied(color));
+        }
+    } else
+        return;     // Nodes are not batch rendered outside of minimal mode
+
+    const auto tracked = _itemRenderers.find(&item);
+    if (tracked == _itemRenderers.end()) {  // Monitor item once, hidden items keep an empty slot (graph notify culling changes)
+        const auto itemPtr = &item;
+        connect(itemPtr,    &QQuickItem::visibleChanged,
+                this,       [this, itemPtr]() { requestItemUpdate(itemPtr); });
+        connect(itemPtr,    &QObject::destroyed,
+                this,       [this, itemPtr]() { removeItem(itemPtr); });
+    } else if (tracked->second != renderer) {   // Edge has moved to another layer
+        tracked->second->_batches[category].remove(&item);
+        tracked->second->update();
+    }
+    _itemRenderers[&item] = renderer;
+    renderer->_batches[category].set(&item, _itemVertices);
+    renderer->update();
+}
+
+void    EdgeBatchRenderer::removeItem(const QQuickItem* item)
+{
+    // Note: item is being destroyed, it must not be dereferenced.
+    const auto tracked = _itemRenderers.find(item);
+    if (tracked == _itemRenderers.end())
+        return;
+    for (auto& batch : tracked->second->_batches)
+        batch.remove(item);
+    tracked->second->update();
+    _itemRenderers.erase(tracked);
+}
+
+void    EdgeBatchRenderer::clearItems()
+{
+    for (const auto& tracked : _itemRenderers)
+        disconnect(tracked.first, nullptr, this, nullptr);
+    _itemRenderers.clear();
+    for (auto& batch : _batches)
+        batch.clear();
+    update();
+    for (const auto& layer : _layers)
+        if (layer) {
+            for (auto& batch : layer->_batches)
+                batch.clear();
+            layer->update();
+        }
+}
+
+void    EdgeBatchRenderer::updateLayers(const QQuickItem& container)
+{
+    _groupsZ.clear();
+    for (const auto group : _graph->get_groups()) {
+        const auto groupItem = group != nullptr ? group->getGroupItem() : nullptr;
+        if (groupItem != nullptr &&
+            groupItem->parentItem() == &container)  // Only root groups are stacked with edge items
+            _groupsZ.push_back(groupItem->z());
+    }
+    std::sort(_groupsZ.begin(), _groupsZ.end());
+    for (auto l = _groupsZ.size(); l < _layers.size(); l++)     // Groups have been removed
+        delete _layers[l].data();
+    _layers.resize(_groupsZ.size());
+    for (std::size_t l = 0; l < _layers.size(); l++)
+        if (_layers[l])     // Layer is just above it's lower group
+            _layers[l]->setZ(std::nextafter(_groupsZ[l], std::numeric_limits<qreal>::max()));
+    _layersValid = true;
+}
+
+std::size_t EdgeBatchRenderer::layerOf(const qan::EdgeItem& edgeItem, const QQuickItem& container) const
+{
+    // Note: Non batched edge items are stacked at their z in container, mimic the same behaviour
+    const auto z = edgeItem.parentItem() == &container ? edgeItem.z() :
+                                                         qan::getItemGlobalZ_rec(&edgeItem) - qan::getItemGlobalZ_rec(&container);
+    return static_cast<std::size_t>(std::lower_bound(_groupsZ.cbegin(), _groupsZ.cend(), z) - _groupsZ.cbegin());
+}
+
+EdgeBatchRenderer&  EdgeBatchRenderer::getLayer(std::size_t layer)
+{
+    if (layer == 0 ||
+        layer > _layers.size())
+        return *this;
+    auto& renderer = _layers[layer - 1];
+    if (!renderer) {
+        renderer = new EdgeBatchRenderer{parentItem()};
+        renderer->setZ(std::nextafter(_groupsZ[layer - 1], std::numeric_limits<qreal>::max()));
+    }
+    if (renderer->parentItem() != parentItem())     // Container item might have been modified
+        renderer->setParentItem(parentItem());
+    return *renderer;
+}
+
+
+void    EdgeBatchRenderer::appendEdge(std::vector<QSGGeometry::ColoredPoint2D>& vertices, std::vector<QPointF>& buffer,
+                                      const qan::EdgeItem& edgeItem, const QPointF& origin, const QColor& selectionColor)
+{
+    const auto style = edgeItem.getStyle();
+    const auto lineType = style != nullptr ? style->getLineType() : qan::EdgeStyle::LineType::Straight;
+    const auto lineWidth = style != nullptr ? style->getLineWidth() : 2.;
+    const auto color = impl::premultiplied(style != nullptr ? style->getLineColor() : QColor{0, 0, 0});
+
+    const QPointF p1 = origin + edgeItem.getP1();
+    const QPointF p2 = origin + edgeItem.getP2();
+    buffer.clear();
+    switch (lineType) {
+    case qan::EdgeStyle::LineType::Undefined:   // [[fallthrough]]
+    case qan::EdgeStyle::LineType::Straight:
+        buffer = {p1, p2};
+        break;
+    case qan::EdgeStyle::LineType::Ortho:
+        buffer = {p1, origin + edgeItem.getC1(), p2};
+        break;
+    case qan::EdgeStyle::LineType::Curved:
+        impl::flattenCubic(buffer, p1, origin + edgeItem.getC1(), origin + edgeItem.getC2(), p2);
+        break;
+    }
+    // Extend ortho segments by half line width to get square joins
+    const auto extension = lineType == qan::EdgeStyle::LineType::Ortho ? lineWidth / 2. : 0.;
+
+    if (edgeItem.getSelected())         // Selection is drawn under edge line, see EdgeTemplate.qml
+        impl::appendPolyline(vertices, buffer, lineWidth + 2., extension, nullptr,
+                             impl::premultiplied(selectionColor));
+    const auto dashPattern = style != nullptr &&
+                             style->getDashed() ? &style->getDashPattern() : nullptr;
+    impl::appendPolyline(vertices, buffer, lineWidth, extension, dashPattern, color);
+
+    impl::appendEndShape(vertices, buffer, edgeItem.getDstShape(), p2, edgeItem.getDstAngle(),
+                         edgeItem.getDstA1(), edgeItem.getDstA2(), edgeItem.getDstA3(), lineWidth, color);
+    impl::appendEndShape(vertices, buffer, edgeItem.getSrcShape(), p1, edgeItem.getSrcAngle(),
+                         edgeItem.getSrcA1(), edgeItem.getSrcA2(), edgeItem.getSrcA3(), lineWidth, color);
+}
+
+
+QSGNode*    EdgeBatchRenderer::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data);
+    const auto vertexCount = std::accumulate(_batches.cbegin(), _batches.cend(), std::size_t{0},
+                                             [](std::size_t count, const Batch& batch) { return count + batch.vertexCount; });
+    if (vertexCount == 0) {
+        delete oldNode;
+        for (auto& batch : _batches)    // All chunks must be uploaded in a new node
+            std::fill(batch.dirtyChunks.begin(), batch.dirtyChunks.end(), true);
+        return nullptr;
+    }
+    // Root node own one child node per batch, batch node own one geometry node per chunk
+    auto root = oldNode;
+    if (root == nullptr) {
+        root = new QSGNode{};
+        for (std::size_t b = 0; b < _batches.size(); b++)
+            root->appendChildNode(new QSGNode{});
+        for (auto& batch : _batches)
+            std::fill(batch.dirtyChunks.begin(), batch.dirtyChunks.end(), true);
+    }
+    auto batchNode = root->firstChild();
+    for (auto& batch : _batches) {
+        const auto chunkCount = static_cast<int>(batch.dirtyChunks.size());
+        while (batchNode->childCount() > chunkCount) {
+            auto child = batchNode->lastChild();
+            batchNode->removeChildNode(child);
+            delete child;
+        }
+        while (batchNode->childCount() < chunkCount) {
+            auto node = new QSGGeometryNode{};
+            auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_ColoredPoint2D(), 0};
+            geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+            node->setGeometry(geometry);
+            node->setFlag(QSGNode::OwnsGeometry);
+            node->setMaterial(new QSGVertexColorMaterial{});
+            node->setFlag(QSGNode::OwnsMaterial);
+            batchNode->appendChildNode(node);
+        }
+        auto child = batchNode->firstChild();
+        for (std::size_t c = 0; c < batch.dirtyChunks.size() && child != nullptr; c++, child = child->nextSibling()) {
+            if (!batch.dirtyChunks[c])
+                continue;
+            batch.dirtyChunks[c] = false;
+            const auto first = c * itemsPerChunk;
+            const auto last = std::min(first + itemsPerChunk, batch.slots.size());
+            std::size_t count = 0;
+            for (auto s = first; s < last; s++)
+                count += batch.slots[s].size();
+            auto node = static_cast<QSGGeometryNode*>(child);
+            node->geometry()->allocate(static_cast<int>(count));
+            auto vertex = node->geometry()->vertexDataAsColoredPoint2D();
+            for (auto s = first; s < last; s++)
+                vertex = std::copy(batch.slots[s].cbegin(), batch.slots[s].cend(), vertex);
+            node->markDirty(QSGNode::DirtyGeometry);
+            _uploadedVertexCount += count;
+        }
+        batchNode = batchNode->nextSibling();
+    }
+    return root;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,199 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeBatchRenderer.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <array>
+#include <vector>
+#include <unordered_map>
+
+// Qt headers
+#include <QQuickItem>
+#include <QPointer>
+#include <QSGGeometry>
+#include <QColor>
+
+namespace qan { // ::qan
+
+class Graph;
+class EdgeItem;
+
+/*! \brief Draw all graph edges with a few scene graph geometry nodes instead of per edge QML shapes.
+ *
+ * Renderer is created and owned by qan::Graph when \c edgeBatchRendering is enabled, it is parented
+ * to the graph \c containerItem under all nodes and groups. Edge geometry (p1, p2, c1, c2, arrows
+ * points and angles) is read from already computed qan::EdgeItem geometry: edge items are still used
+ * for hit testing and selection, only their visual delegate content is disabled (see
+ * qan::EdgeItem::batchRendered).
+ *
+ * Edges are stacked against root groups like non batched edge items (ie at their item z): an edge whose z
+ * is greater than \c n root groups z is drawn by a layer renderer created on top of the n-th group. Layer
+ * renderers are siblings of this renderer in \c containerItem, they are owned and filled by this renderer.
+ *
+ * Curves are tessellated, lines are rendered as triangles with per vertex color, style \c dashed and
+ * \c dashPattern are supported. Selected edges are drawn with graph \c selectionColor under the edge line.
+ *
+ * When \c minimal is set, groups and nodes are also drawn as solid rects with straight edges.
+ *
+ * Updates are incremental: each item vertices are stored in their own slot, slots are uploaded in chunks
+ * of \c itemsPerChunk items (one geometry node per chunk). Modifying an item (see requestItemUpdate())
+ * tessellate only this item and upload only its chunk.
+ *
+ * \note No antialiasing is applied, enable multisampling on the window for smooth edges.
+ * \nosubgrouping
+ */
+class EdgeBatchRenderer : public QQuickItem
+{
+    Q_OBJECT
+    /*! \name EdgeBatchRenderer Object Management *///-------------------------
+    //@{
+public:
+    explicit EdgeBatchRenderer(QQuickItem* parent = nullptr);
+    virtual ~EdgeBatchRenderer() override;
+    EdgeBatchRenderer(const EdgeBatchRenderer&) = delete;
+
+public:
+    void        setGraph(qan::Graph* graph) noexcept;
+private:
+    QPointer<qan::Graph>    _graph;
+
+public:
+    //! Schedule all items geometry collection before next frame (ie after a container, level of detail or selection color change).
+    Q_INVOKABLE void    requestUpdate() noexcept;
+    /*! \brief Schedule \c item geometry collection before next frame (ie after an edge geometry, style or selection change).
+     *
+     * \c item is an edge item, or a node or group item in \c minimal mode (other items are ignored). Item
+     * visibility changes and destruction are monitored once \c item has been collected.
+     */
+    void                requestItemUpdate(QQuickItem* item) noexcept;
+    //! Invalidate edges layers after a root group z modification, insertion or removal.
+    void                invalidateLayers() noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Edges Rendering *///---------------------------------------------
+    //@{
+public:
+    //! Item count in a geometry node chunk, only chunks containing modified items are uploaded.
+    static constexpr std::size_t    itemsPerChunk = 128;
+
+    //! Current vertex count, including layers (mainly used for benchmarking).
+    std::size_t             getVertexCount() const noexcept;
+    //! Vertex count uploaded to scene graph since this renderer creation, including layers (mainly used for benchmarking).
+    std::size_t             getUploadedVertexCount() const noexcept;
+
+    /*! \brief Draw groups and nodes as solid rects and edges as straight lines (default to false).
+     *
+     * Used by qan::Graph for qan::NodeItem::Lod::Minimal level of detail: the whole graph is then drawn with
+     * this renderer geometry, node, group and edge delegates content is hidden.
+     */
+    void                    setMinimal(bool minimal) noexcept;
+    inline bool             getMinimal() const noexcept { return _minimal; }
+private:
+    bool                    _minimal = false;
+
+protected:
+    //! Collect modified items geometry in graph container CS.
+    virtual void        updatePolish() override;
+    //! Tessellate \c item (edge, or node and group in \c minimal mode) in its layer renderer batch.
+    void                collectItem(QQuickItem& item, const QQuickItem& container);
+    //! Release \c item slot in its layer renderer batch.
+    void                removeItem(const QQuickItem* item);
+    //! Release all items slots in this renderer and its layers.
+    void                clearItems();
+    //! Rebuild root groups sorted z and layers renderers z.
+    void                updateLayers(const QQuickItem& container);
+    //! Return \c edgeItem layer: count of root groups whose z is less than edge z.
+    std::size_t         layerOf(const qan::EdgeItem& edgeItem, const QQuickItem& container) const;
+    //! Return layer renderer for \c layer, \c layer 0 is this renderer, upper layers are created on demand.
+    EdgeBatchRenderer&  getLayer(std::size_t layer);
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+public:
+    /*! \brief Append \c edgeItem line, selection and end shapes triangles to \c vertices, \c origin is edge item position in target CS.
+     *
+     * \c buffer is a temporary tessellation buffer, selection is drawn with \c selectionColor when edge is selected.
+     * \note Also used by qan::NativeEdgeItem to draw a single edge.
+     */
+    static void         appendEdge(std::vector<QSGGeometry::ColoredPoint2D>& vertices, std::vector<QPointF>& buffer,
+                                   const qan::EdgeItem& edgeItem, const QPointF& origin, const QColor& selectionColor);
+
+private:
+    using Vertex = QSGGeometry::ColoredPoint2D;
+
+    //! Items vertices, one slot per item, chunk \c c contains slots [c * itemsPerChunk, (c + 1) * itemsPerChunk[.
+    struct Batch {
+        //! Set \c item slot vertices (swapped with \c vertices), allocate a slot if necessary.
+        void    set(const QQuickItem* item, std::vector<Vertex>& vertices);
+        //! Release \c item slot, return false if \c item is not in this batch.
+        bool    remove(const QQuickItem* item);
+        void    clear();
+
+        std::vector<std::vector<Vertex>>                    slots;
+        //! Slot item, nullptr for a free slot.
+        std::vector<const QQuickItem*>                      items;
+        std::vector<std::size_t>                            freeSlots;
+        std::unordered_map<const QQuickItem*, std::size_t>  index;
+        std::vector<bool>                                   dirtyChunks;
+        std::size_t                                         vertexCount = 0;
+    };
+    //! Batches in drawing order: groups rects, edges, then nodes rects (only edges are used when not \c minimal).
+    enum Category : std::size_t { Groups = 0, Edges = 1, Nodes = 2 };
+    std::array<Batch, 3>                        _batches;
+    std::size_t                                 _uploadedVertexCount = 0;
+
+    //! Items waiting for tessellation (might contain duplicates).
+    std::vector<QPointer<QQuickItem>>           _dirtyItems;
+    //! All items must be collected on next update.
+    bool                                        _allDirty = true;
+    //! Renderer (this renderer or a layer) holding each collected item slot.
+    std::unordered_map<const QQuickItem*, EdgeBatchRenderer*>   _itemRenderers;
+    //! Temporary item vertices buffer (avoid allocations during update).
+    std::vector<Vertex>                         _itemVertices;
+    //! Temporary tessellation buffer (avoid allocations during update).
+    std::vector<QPointF>                        _polyline;
+
+    //! Root groups z in ascending order, edges layers are the intervals between them.
+    std::vector<qreal>                          _groupsZ;
+    bool                                        _layersValid = false;
+    //! Upper layers renderers (_layers[n - 1] draw layer n edges), nullptr until used.
+    std::vector<QPointer<EdgeBatchRenderer>>    _layers;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::EdgeBatchRenderer)
@@ -90,8 +90,9 @@ bool    EdgeDraggableCtrl::handleMouseMoveEvent(QMouseEvent* event)
         if (!_targetItem->getDragged()) {
             beginDragMove(sceneDragPos, _targetItem->getSelected());
             return true;
-        } else {
-            dragMove(sceneDragPos, _targetItem->getSelected());
+        } else {    // Coalesce moves to one dragMove() per frame
+            _coalescedDragSelection = _targetItem->getSelected();
+            _moveCoalescer.move(sceneDragPos, graph->getCoalesceMoves() ? _targetItem->window() : nullptr);
             return true;
         }
     }
@@ -140,6 +141,7 @@ void    EdgeDraggableCtrl::beginDragMove(const QPointF& sceneDragPos, bool dragS
         nodes.push_back(dst->getNode());
         emit graph->nodesAboutToBeMoved(nodes);
     }
+    _moveCoalescer.cancel();
     _targetItem->setDragged(true);
     _initialDragPos = sceneDragPos;
     const auto rootItem = getGraph()->getContainerItem();
@@ -236,6 +238,7 @@ void    EdgeDraggableCtrl::endDragMove(bool dragSelection, bool notify)
 {
     Q_UNUSED(dragSelection)
     Q_UNUSED(notify)
+    _moveCoalescer.flush();     // Apply last coalesced move, drag end position is last pointer position
     if (!_targetItem)
         return;
 
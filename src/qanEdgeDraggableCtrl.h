@@ -44,6 +44,7 @@
 // QuickQanava headers
 #include "./qanAbstractDraggableCtrl.h"
 #include "./qanGroup.h"
+#include "./qanMoveCoalescer.h"
 
 namespace qan { // ::qan
 
@@ -107,6 +108,13 @@ private:
     QPointF                 _initialDragPos{0., 0.};
     //! Internal (target) initial dragging position.
     QPointF                 _initialTargetPos{0., 0.};
+
+    //! Coalesce mouse drag moves to one dragMove() per frame (see qan::Graph::coalesceMoves).
+    qan::MoveCoalescer      _moveCoalescer{[this](const QPointF& sceneDragPos) {
+                                dragMove(sceneDragPos, _coalescedDragSelection);
+                            }};
+    //! \c dragSelection argument for coalesced dragMove().
+    bool                    _coalescedDragSelection = true;
     //@}
     //-------------------------------------------------------------------------
 };
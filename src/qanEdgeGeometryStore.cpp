@@ -0,0 +1,480 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeGeometryStore.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Note: SSE2 is baseline on x86-64 (no specific compiler flag required)
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define QUICKQANAVA_SSE2
+#include <emmintrin.h>
+#endif
+
+// QuickQanava headers
+#include "./qanEdgeGeometryStore.h"
+
+namespace qan { // ::qan
+
+namespace impl { // qan::impl
+
+//! Closed rect containment test with QRectF::contains(QRectF) semantic (null rects are never contained).
+inline bool     containsRect(double l1, double t1, double r1, double b1,
+                             double l2, double t2, double r2, double b2) noexcept
+{
+    return l1 < r1 && t1 < b1 &&
+           l2 < r2 && t2 < b2 &&
+           l2 >= l1 && r2 <= r1 &&
+           t2 >= t1 && b2 <= b1;
+}
+
+//! Same as qan::EdgeItem::lineAngle().
+inline double   lineAngle(double x1, double y1, double x2, double y2) noexcept
+{
+    static constexpr double Pi = 3.141592653;
+    static constexpr double TwoPi = 2. * Pi;
+    static constexpr double MinLength = 0.00001;
+    const double dx = x2 - x1;
+    const double dy = y2 - y1;
+    const double length = std::sqrt((dx * dx) + (dy * dy));
+    if (length < MinLength)
+        return -1.;
+    double angle = std::acos(dx / length);
+    if (dy < 0.)
+        angle = TwoPi - angle;
+    return angle * (360. / TwoPi);
+}
+
+//! Same as qan::EdgeItem::cubicCurveAngleAt().
+inline double   cubicCurveAngleAt(double pos,
+                                  double sx, double sy, double ex, double ey,
+                                  double c1x, double c1y, double c2x, double c2y) noexcept
+{
+    const double coeff3x = ex - (3. * c2x) + (3. * c1x) - sx;
+    const double coeff3y = ey - (3. * c2y) + (3. * c1y) - sy;
+    const double coeff2x = (3. * c2x) - (6. * c1x) + (3. * sx);
+    const double coeff2y = (3. * c2y) - (6. * c1y) + (3. * sy);
+    const double coeff1x = (3. * c1x) - (3. * sx);
+    const double coeff1y = (3. * c1y) - (3. * sy);
+    const double pos2 = pos * pos;
+    const double dxdt = (3. * coeff3x * pos2) + (2. * coeff2x * pos) + coeff1x;
+    const double dydt = (3. * coeff3y * pos2) + (2. * coeff2y * pos) + coeff1y;
+    static constexpr double Pi = 3.141592653;
+    const double degrees = std::atan2(dxdt, dydt) * 180. / Pi;
+    return degrees > 90. ? 450. - degrees : 90. - degrees;
+}
+
+//! Move (\c x2, \c y2) toward (\c x1, \c y1) by \c length, return (x1, y1)->(x2, y2) line angle (see qan::EdgeItem::generateStraightArrowAngle()).
+inline double   straightArrowAngle(double x1, double y1, double& x2, double& y2,
+                                   bool shape, double length) noexcept
+{
+    static constexpr double MinLength = 0.00001;
+    const double angle = lineAngle(x1, y1, x2, y2);
+    const double dx = x2 - x1;
+    const double dy = y2 - y1;
+    const double lineLength = std::sqrt((dx * dx) + (dy * dy));
+    if (lineLength > MinLength && shape) {
+        const double t = 1.0 - (length / lineLength);
+        x2 = x1 + (t * dx);
+        y2 = y1 + (t * dy);
+    }
+    return angle;
+}
+
+//! See qan::EdgeItem::generateCurvedArrowAngle().
+inline double   curvedArrowAngle(double x1, double y1, double& x2, double& y2,
+                                 double c1x, double c1y, double c2x, double c2y,
+                                 bool shape, double length) noexcept
+{
+    static constexpr double averageDstAngleFactor = 4.0;
+    const double lineLength = std::hypot(x2 - x1, y2 - y1);
+    const double curveAngle = cubicCurveAngleAt(0.99, x1, y1, x2, y2, c1x, c1y, c2x, c2y);
+    const double angle = lineLength > averageDstAngleFactor * length ?
+                             curveAngle :
+                             (0.4 * curveAngle) + (0.6 * lineAngle(x1, y1, x2, y2));
+    if (shape) {
+        const double vx = c2x - x2;
+        const double vy = c2y - y2;
+        const double vLength = std::sqrt((vx * vx) + (vy * vy));
+        if (vLength > 0.) {
+            x2 += (vx / vLength) * length;
+            y2 += (vy / vLength) * length;
+        }
+    }
+    return angle;
+}
+
+//! Generate straight ends and hidden flag of edge \c e (see EdgeGeometryStore::generateStraightEnds()).
+inline void     straightEnds(std::size_t e,
+                             const double* sx, const double* sy, const double* sw, const double* sh, const double* sr,
+                             const double* dx, const double* dy, const double* dw, const double* dh, const double* dr,
+                             const double* arrowLength,
+                             double* p1x, double* p1y, double* p2x, double* p2y, std::uint8_t* hidden) noexcept
+{
+    const double shw = sw[e] / 2.;
+    const double shh = sh[e] / 2.;
+    const double dhw = dw[e] / 2.;
+    const double dhh = dh[e] / 2.;
+    const double scx = sx[e] + shw;
+    const double scy = sy[e] + shh;
+    const double dcx = dx[e] + dhw;
+    const double dcy = dy[e] + dhh;
+    const double vx = dcx - scx;
+    const double vy = dcy - scy;
+
+    // Bounding shapes intersection exists only when exit point lays on (src center, dst center) segment
+    const double ts = roundedRectRayExit(vx, vy, shw, shh, sr[e]);
+    const double td = roundedRectRayExit(vx, vy, dhw, dhh, dr[e]);
+    const double x1 = ts < 1. ? scx + (vx * ts) : scx;
+    const double y1 = ts < 1. ? scy + (vy * ts) : scy;
+    const double x2 = td < 1. ? dcx - (vx * td) : dcx;
+    const double y2 = td < 1. ? dcy - (vy * td) : dcy;
+    p1x[e] = x1; p1y[e] = y1;
+    p2x[e] = x2; p2y[e] = y2;
+
+    // Edge is hidden if it is too short or if the whole line is inside src or dst bounding rect
+    const double length = std::sqrt(((x2 - x1) * (x2 - x1)) + ((y2 - y1) * (y2 - y1)));
+    const double ll = std::min(x1, x2);
+    const double lr = std::max(x1, x2);
+    const double lt = std::min(y1, y2);
+    const double lb = std::max(y1, y2);
+    const bool tooShort = length < 2.0 + arrowLength[e];
+    const bool inSrc = containsRect(sx[e], sy[e], sx[e] + sw[e], sy[e] + sh[e], ll, lt, lr, lb);
+    const bool inDst = containsRect(dx[e], dy[e], dx[e] + dw[e], dy[e] + dh[e], ll, lt, lr, lb);
+    hidden[e] = (tooShort || inSrc || inDst) ? 1 : 0;
+}
+
+#if defined(QUICKQANAVA_SSE2)
+//! Return \c mask ? \c a : \c b per lane.
+inline __m128d  select(__m128d mask, __m128d a, __m128d b) noexcept
+{
+    return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+}
+
+//! Two lanes roundedRectRayExit(), same operations order (results are bitwise identical).
+inline __m128d  roundedRectRayExit(__m128d dx, __m128d dy, __m128d hw, __m128d hh, __m128d r) noexcept
+{
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d inf = _mm_set1_pd(std::numeric_limits<double>::infinity());
+    const __m128d absMask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+    const __m128d adx = _mm_and_pd(dx, absMask);
+    const __m128d ady = _mm_and_pd(dy, absMask);
+    const __m128d tx = select(_mm_cmpgt_pd(adx, zero), _mm_div_pd(hw, adx), inf);
+    const __m128d ty = select(_mm_cmpgt_pd(ady, zero), _mm_div_pd(hh, ady), inf);
+    // Note: _mm_min_pd(b, a) == std::min(a, b) and _mm_max_pd(b, a) == std::max(a, b), NaN and signed zeros included
+    const __m128d t = _mm_min_pd(ty, tx);
+    const __m128d cr = _mm_min_pd(_mm_min_pd(hh, hw), r);
+    const __m128d kx = _mm_sub_pd(hw, cr);
+    const __m128d ky = _mm_sub_pd(hh, cr);
+    const __m128d a = _mm_add_pd(_mm_mul_pd(adx, adx), _mm_mul_pd(ady, ady));
+    const __m128d b = _mm_mul_pd(_mm_set1_pd(-2.), _mm_add_pd(_mm_mul_pd(adx, kx), _mm_mul_pd(ady, ky)));
+    const __m128d c = _mm_sub_pd(_mm_add_pd(_mm_mul_pd(kx, kx), _mm_mul_pd(ky, ky)), _mm_mul_pd(cr, cr));
+    const __m128d discriminant = _mm_sub_pd(_mm_mul_pd(b, b), _mm_mul_pd(_mm_mul_pd(_mm_set1_pd(4.), a), c));
+    const __m128d tc = _mm_div_pd(_mm_add_pd(_mm_sub_pd(zero, b), _mm_sqrt_pd(_mm_max_pd(zero, discriminant))),
+                                  _mm_mul_pd(_mm_set1_pd(2.), a));
+    const __m128d corner = _mm_and_pd(_mm_and_pd(_mm_cmpgt_pd(cr, zero),
+                                                 _mm_cmpgt_pd(_mm_mul_pd(adx, t), kx)),
+                                      _mm_and_pd(_mm_cmpgt_pd(_mm_mul_pd(ady, t), ky),
+                                                 _mm_cmpge_pd(discriminant, zero)));
+    return select(corner, tc, t);
+}
+
+//! Two lanes containsRect() mask.
+inline __m128d  containsRect(__m128d l1, __m128d t1, __m128d r1, __m128d b1,
+                             __m128d l2, __m128d t2, __m128d r2, __m128d b2) noexcept
+{
+    const __m128d valid = _mm_and_pd(_mm_and_pd(_mm_cmplt_pd(l1, r1), _mm_cmplt_pd(t1, b1)),
+                                     _mm_and_pd(_mm_cmplt_pd(l2, r2), _mm_cmplt_pd(t2, b2)));
+    const __m128d inside = _mm_and_pd(_mm_and_pd(_mm_cmpge_pd(l2, l1), _mm_cmple_pd(r2, r1)),
+                                      _mm_and_pd(_mm_cmpge_pd(t2, t1), _mm_cmple_pd(b2, b1)));
+    return _mm_and_pd(valid, inside);
+}
+#endif
+
+} // ::qan::impl
+
+/* EdgeGeometryStore Object Management *///-----------------------------------
+void    EdgeGeometryStore::clear() noexcept
+{
+    for (auto v : {&_sx, &_sy, &_sw, &_sh, &_sr, &_dx, &_dy, &_dw, &_dh, &_dr, &_arrowLength,
+                   &_p1x, &_p1y, &_p2x, &_p2y, &_c1x, &_c1y, &_c2x, &_c2y, &_srcAngle, &_dstAngle})
+        v->clear();
+    _lineType.clear();
+    _srcShape.clear();
+    _dstShape.clear();
+    _hidden.clear();
+}
+
+void    EdgeGeometryStore::reserve(std::size_t capacity)
+{
+    for (auto v : {&_sx, &_sy, &_sw, &_sh, &_sr, &_dx, &_dy, &_dw, &_dh, &_dr, &_arrowLength,
+                   &_p1x, &_p1y, &_p2x, &_p2y, &_c1x, &_c1y, &_c2x, &_c2y, &_srcAngle, &_dstAngle})
+        v->reserve(capacity);
+    _lineType.reserve(capacity);
+    _srcShape.reserve(capacity);
+    _dstShape.reserve(capacity);
+    _hidden.reserve(capacity);
+}
+
+EdgeGeometryStore::index_t  EdgeGeometryStore::add()
+{
+    const auto e = static_cast<index_t>(size());
+    for (auto v : {&_sx, &_sy, &_sw, &_sh, &_sr, &_dx, &_dy, &_dw, &_dh, &_dr, &_arrowLength,
+                   &_p1x, &_p1y, &_p2x, &_p2y, &_c1x, &_c1y, &_c2x, &_c2y, &_srcAngle, &_dstAngle})
+        v->push_back(0.);
+    _lineType.push_back(LineType::Straight);
+    _srcShape.push_back(0);
+    _dstShape.push_back(0);
+    _hidden.push_back(0);
+    return e;
+}
+
+void    EdgeGeometryStore::setEndpoints(index_t e, const QRectF& srcBr, qreal srcRadius,
+                                        const QRectF& dstBr, qreal dstRadius) noexcept
+{
+    _sx[e] = srcBr.x();     _sy[e] = srcBr.y();
+    _sw[e] = srcBr.width(); _sh[e] = srcBr.height();
+    _sr[e] = srcRadius;
+    _dx[e] = dstBr.x();     _dy[e] = dstBr.y();
+    _dw[e] = dstBr.width(); _dh[e] = dstBr.height();
+    _dr[e] = dstRadius;
+}
+
+void    EdgeGeometryStore::setStyle(index_t e, LineType lineType, qreal arrowLength,
+                                    bool srcShape, bool dstShape) noexcept
+{
+    _lineType[e] = lineType;
+    _arrowLength[e] = arrowLength;
+    _srcShape[e] = srcShape ? 1 : 0;
+    _dstShape[e] = dstShape ? 1 : 0;
+}
+//-----------------------------------------------------------------------------
+
+/* Batch Kernels *///----------------------------------------------------------
+void    EdgeGeometryStore::update() noexcept
+{
+    // Algorithm: same steps than qan::EdgeItem::updateItem()
+        // 1. Straight ends for all edges (ends of curved edges are refined in 3.)
+        // 2. Ortho ends for ortho edges
+        // 3. Curved control points for curved edges
+        // 4. Arrow angles and ends correction for all edges
+    generateStraightEnds();         // 1.
+    generateOrthoEnds();            // 2.
+    generateCurvedControlPoints();  // 3.
+    generateArrowAngles();          // 4.
+}
+
+void    EdgeGeometryStore::generateStraightEnds() noexcept
+{
+    const auto n = size();
+    const double* sx = _sx.data(); const double* sy = _sy.data();
+    const double* sw = _sw.data(); const double* sh = _sh.data(); const double* sr = _sr.data();
+    const double* dx = _dx.data(); const double* dy = _dy.data();
+    const double* dw = _dw.data(); const double* dh = _dh.data(); const double* dr = _dr.data();
+    const double* arrowLength = _arrowLength.data();
+    double* p1x = _p1x.data(); double* p1y = _p1y.data();
+    double* p2x = _p2x.data(); double* p2y = _p2y.data();
+    std::uint8_t* hidden = _hidden.data();
+    std::size_t e = 0;
+#if defined(QUICKQANAVA_SSE2)
+    // Note: Same operations than impl::straightEnds() on two edges per iteration, remaining edge use scalar code.
+    const __m128d half = _mm_set1_pd(0.5);
+    const __m128d one = _mm_set1_pd(1.);
+    for (; e + 2 <= n; e += 2) {
+        const __m128d ssx = _mm_loadu_pd(sx + e), ssy = _mm_loadu_pd(sy + e);
+        const __m128d ssw = _mm_loadu_pd(sw + e), ssh = _mm_loadu_pd(sh + e);
+        const __m128d dsx = _mm_loadu_pd(dx + e), dsy = _mm_loadu_pd(dy + e);
+        const __m128d dsw = _mm_loadu_pd(dw + e), dsh = _mm_loadu_pd(dh + e);
+        const __m128d shw = _mm_mul_pd(ssw, half);          // Note: x * 0.5 == x / 2. (exact)
+        const __m128d shh = _mm_mul_pd(ssh, half);
+        const __m128d dhw = _mm_mul_pd(dsw, half);
+        const __m128d dhh = _mm_mul_pd(dsh, half);
+        const __m128d scx = _mm_add_pd(ssx, shw);
+        const __m128d scy = _mm_add_pd(ssy, shh);
+        const __m128d dcx = _mm_add_pd(dsx, dhw);
+        const __m128d dcy = _mm_add_pd(dsy, dhh);
+        const __m128d vx = _mm_sub_pd(dcx, scx);
+        const __m128d vy = _mm_sub_pd(dcy, scy);
+
+        const __m128d ts = impl::roundedRectRayExit(vx, vy, shw, shh, _mm_loadu_pd(sr + e));
+        const __m128d td = impl::roundedRectRayExit(vx, vy, dhw, dhh, _mm_loadu_pd(dr + e));
+        const __m128d sExit = _mm_cmplt_pd(ts, one);
+        const __m128d dExit = _mm_cmplt_pd(td, one);
+        const __m128d x1 = impl::select(sExit, _mm_add_pd(scx, _mm_mul_pd(vx, ts)), scx);
+        const __m128d y1 = impl::select(sExit, _mm_add_pd(scy, _mm_mul_pd(vy, ts)), scy);
+        const __m128d x2 = impl::select(dExit, _mm_sub_pd(dcx, _mm_mul_pd(vx, td)), dcx);
+        const __m128d y2 = impl::select(dExit, _mm_sub_pd(dcy, _mm_mul_pd(vy, td)), dcy);
+        _mm_storeu_pd(p1x + e, x1); _mm_storeu_pd(p1y + e, y1);
+        _mm_storeu_pd(p2x + e, x2); _mm_storeu_pd(p2y + e, y2);
+
+        const __m128d lx = _mm_sub_pd(x2, x1);
+        const __m128d ly = _mm_sub_pd(y2, y1);
+        const __m128d length = _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(lx, lx), _mm_mul_pd(ly, ly)));
+        // Note: _mm_min_pd(b, a)/_mm_max_pd(b, a) match std::min(a, b)/std::max(a, b)
+        const __m128d ll = _mm_min_pd(x2, x1);
+        const __m128d lr = _mm_max_pd(x2, x1);
+        const __m128d lt = _mm_min_pd(y2, y1);
+        const __m128d lb = _mm_max_pd(y2, y1);
+        const __m128d tooShort = _mm_cmplt_pd(length, _mm_add_pd(_mm_set1_pd(2.0), _mm_loadu_pd(arrowLength + e)));
+        const __m128d inSrc = impl::containsRect(ssx, ssy, _mm_add_pd(ssx, ssw), _mm_add_pd(ssy, ssh), ll, lt, lr, lb);
+        const __m128d inDst = impl::containsRect(dsx, dsy, _mm_add_pd(dsx, dsw), _mm_add_pd(dsy, dsh), ll, lt, lr, lb);
+        const int hiddenMask = _mm_movemask_pd(_mm_or_pd(tooShort, _mm_or_pd(inSrc, inDst)));
+        hidden[e] = (hiddenMask & 1) != 0 ? 1 : 0;
+        hidden[e + 1] = (hiddenMask & 2) != 0 ? 1 : 0;
+    }
+#endif
+    for (; e < n; e++)
+        impl::straightEnds(e, sx, sy, sw, sh, sr, dx, dy, dw, dh, dr, arrowLength, p1x, p1y, p2x, p2y, hidden);
+}
+
+void    EdgeGeometryStore::generateOrthoEnds() noexcept
+{
+    // See qan::EdgeItem::generateOrthoEnds() for algorithm description.
+    const auto n = size();
+    for (std::size_t e = 0; e < n; e++) {
+        if (_lineType[e] != LineType::Ortho)
+            continue;
+        _hidden[e] = 0;     // Ortho edges are never hidden
+        const double srcLeft = _sx[e], srcTop = _sy[e];
+        const double srcRight = _sx[e] + _sw[e], srcBottom = _sy[e] + _sh[e];
+        const double dstLeft = _dx[e], dstTop = _dy[e];
+        const double dstRight = _dx[e] + _dw[e], dstBottom = _dy[e] + _dh[e];
+        const double scx = srcLeft + (_sw[e] / 2.), scy = srcTop + (_sh[e] / 2.);
+        const double dcx = dstLeft + (_dw[e] / 2.), dcy = dstTop + (_dh[e] / 2.);
+        double x1, y1, x2, y2, cx, cy;
+        if (scy > dstTop && scy < dstBottom) {              // Horizontal line
+            x1 = dcx < scx ? srcLeft : srcRight;
+            x2 = dcx < scx ? dstRight : dstLeft;
+            y1 = y2 = scy;
+            cx = (x1 + x2) / 2.; cy = scy;
+        } else if (scx < dstRight && scx > dstLeft) {       // Vertical line
+            y1 = dcy < scy ? srcTop : srcBottom;
+            y2 = dcy < scy ? dstBottom : dstTop;
+            x1 = x2 = scx;
+            cx = scx; cy = (y1 + y2) / 2.;
+        } else {
+            const bool top = dcy < srcTop;
+            const bool right = dcx > srcLeft;
+            const bool horiz = 0.50 * std::fabs(dcx - scx) > std::fabs(dcy - scy);
+            if (!horiz) {   // Vertical edge
+                x1 = scx;  y1 = top ? srcTop : srcBottom;
+                x2 = right ? dstLeft : dstRight;  y2 = dcy;
+                cx = scx;  cy = dcy;
+            } else {        // Horizontal edge
+                x1 = right ? srcRight : srcLeft;  y1 = scy;
+                x2 = dcx;  y2 = top ? dstBottom : dstTop;
+                cx = dcx;  cy = scy;
+            }
+        }
+        _p1x[e] = x1; _p1y[e] = y1;
+        _p2x[e] = x2; _p2y[e] = y2;
+        _c1x[e] = cx; _c1y[e] = cy;
+    }
+}
+
+void    EdgeGeometryStore::generateCurvedControlPoints() noexcept
+{
+    // See qan::EdgeItem::generateCurvedControlPoints(), node to node edges (no ports) case.
+    const auto n = size();
+    for (std::size_t e = 0; e < n; e++) {
+        if (_lineType[e] != LineType::Curved ||
+            _hidden[e] != 0)
+            continue;
+        const double xDelta = _p2x[e] - _p1x[e];
+        const double yDelta = _p2y[e] - _p1y[e];
+        const double lineLength = std::sqrt((xDelta * xDelta) + (yDelta * yDelta));
+        const double invert = (xDelta > 0 && yDelta < 0) ||
+                              (xDelta < 0 && yDelta > 0) ? -1. : 1.;
+        double ox = 0., oy = 0.;
+        if (std::abs(lineLength) >= std::numeric_limits<double>::epsilon()) {
+            const double nx = -yDelta / (lineLength * invert);
+            const double ny = xDelta / (lineLength * invert);
+            const double distance = std::min(lineLength, std::min(std::abs(xDelta) / 2., std::abs(yDelta) / 2.));
+            const double controlPointDistance = std::clamp(distance, 0.001, 40.);
+            ox = nx * controlPointDistance;
+            oy = ny * controlPointDistance;
+        }
+        const double cx = (_p1x[e] + _p2x[e]) / 2.;
+        const double cy = (_p1y[e] + _p2y[e]) / 2.;
+        const double c1x = cx + ox, c1y = cy + oy;
+        const double c2x = cx - ox, c2y = cy - oy;
+        _c1x[e] = c1x; _c1y[e] = c1y;
+        _c2x[e] = c2x; _c2y[e] = c2y;
+
+        // Intersect (c1, src center) with src shape and (c2, dst center) with dst shape,
+        // default to control point when there is no intersection.
+        const double scx = _sx[e] + (_sw[e] / 2.), scy = _sy[e] + (_sh[e] / 2.);
+        const double dcx = _dx[e] + (_dw[e] / 2.), dcy = _dy[e] + (_dh[e] / 2.);
+        const double ts = impl::roundedRectRayExit(c1x - scx, c1y - scy, _sw[e] / 2., _sh[e] / 2., _sr[e]);
+        const double td = impl::roundedRectRayExit(c2x - dcx, c2y - dcy, _dw[e] / 2., _dh[e] / 2., _dr[e]);
+        _p1x[e] = ts < 1. ? scx + ((c1x - scx) * ts) : c1x;
+        _p1y[e] = ts < 1. ? scy + ((c1y - scy) * ts) : c1y;
+        _p2x[e] = td < 1. ? dcx + ((c2x - dcx) * td) : c2x;
+        _p2y[e] = td < 1. ? dcy + ((c2y - dcy) * td) : c2y;
+    }
+}
+
+void    EdgeGeometryStore::generateArrowAngles() noexcept
+{
+    // See qan::EdgeItem::generateArrowGeometry(), order of src/dst generation matter since
+    // correction of one end is used for the other end angle.
+    const auto n = size();
+    for (std::size_t e = 0; e < n; e++) {
+        if (_hidden[e] != 0)
+            continue;
+        const bool srcShape = _srcShape[e] != 0;
+        const bool dstShape = _dstShape[e] != 0;
+        const double length = _arrowLength[e];
+        switch (_lineType[e]) {
+        case LineType::Straight:
+            _dstAngle[e] = impl::straightArrowAngle(_p1x[e], _p1y[e], _p2x[e], _p2y[e], dstShape, length);
+            _srcAngle[e] = impl::straightArrowAngle(_p2x[e], _p2y[e], _p1x[e], _p1y[e], srcShape, length);
+            break;
+        case LineType::Ortho:
+            _dstAngle[e] = impl::straightArrowAngle(_c1x[e], _c1y[e], _p2x[e], _p2y[e], dstShape, length);
+            _srcAngle[e] = impl::straightArrowAngle(_c1x[e], _c1y[e], _p1x[e], _p1y[e], srcShape, length);
+            break;
+        case LineType::Curved:
+            _srcAngle[e] = impl::curvedArrowAngle(_p2x[e], _p2y[e], _p1x[e], _p1y[e],
+                                                  _c2x[e], _c2y[e], _c1x[e], _c1y[e], srcShape, length);
+            _dstAngle[e] = impl::curvedArrowAngle(_p1x[e], _p1y[e], _p2x[e], _p2y[e],
+                                                  _c1x[e], _c1y[e], _c2x[e], _c2y[e], dstShape, length);
+            break;
+        }
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
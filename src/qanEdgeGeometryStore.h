@@ -0,0 +1,186 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEdgeGeometryStore.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// Qt headers
+#include <QPointF>
+#include <QRectF>
+
+namespace qan { // ::qan
+
+namespace impl { // ::qan::impl
+
+/*! \brief Return parameter \c t where ray (center + t * (dx, dy)) exit a (\c hw, \c hh) half size rect with \c r rounded corners.
+ *
+ * A null (or negative) radius is a rect. Branch free: rounded corner solution is always computed then selected,
+ * so that batch kernels inline it and vectorize (see qan::EdgeGeometryStore), qan::NodeItem::boundingShapeRayExit()
+ * use the same solver for rect and rounded rect shapes.
+ */
+inline double   roundedRectRayExit(double dx, double dy, double hw, double hh, double r) noexcept
+{
+    constexpr double inf = std::numeric_limits<double>::infinity();
+    const double adx = std::abs(dx);    // Solve in first quadrant, shape is symmetric
+    const double ady = std::abs(dy);
+    const double tx = adx > 0. ? hw / adx : inf;
+    const double ty = ady > 0. ? hh / ady : inf;
+    const double t = std::min(tx, ty);
+    const double cr = std::min(r, std::min(hw, hh));
+    const double kx = hw - cr;          // Corner circle center
+    const double ky = hh - cr;
+    // Exit point is in a rounded corner: solve |t.d - k| = r
+    const double a = (adx * adx) + (ady * ady);
+    const double b = -2. * ((adx * kx) + (ady * ky));
+    const double c = (kx * kx) + (ky * ky) - (cr * cr);
+    const double discriminant = (b * b) - (4. * a * c);
+    const double tc = (-b + std::sqrt(std::max(discriminant, 0.))) / (2. * a);
+    const bool corner = (cr > 0.) & (adx * t > kx) & (ady * t > ky) & (discriminant >= 0.);
+    return corner ? tc : t;
+}
+
+} // ::qan::impl
+
+/*! \brief Structure of arrays storage for edge geometry, with batch kernels generating edges ends, control points and arrow angles.
+ *
+ * Store is used by qan::Graph to update all edges dirty in a frame at once (see qan::Graph::flushEdgeUpdates()): edges
+ * endpoints rects, bounding shape rounding radius, line type and end shapes are packed in contiguous arrays,
+ * then kernels generate p1/p2/c1/c2, arrow angles and hidden flag for every edge. Generated geometry match
+ * qan::EdgeItem::updateItem() per edge pipeline for node to node edges with a rectangular (or rounded
+ * rectangular) bounding shape, edges connected to ports or to custom bounding shapes are not supported.
+ *
+ * Kernels have no allocations and no virtual calls, bounding shape intersections use the same inlined analytic
+ * solver than qan::EdgeItem (see impl::roundedRectRayExit()). Straight ends kernel process two edges per
+ * iteration with SSE2 on x86-64 (scalar loop on other architectures).
+ *
+ * All geometry is expressed in graph container item CS.
+ *
+ * \nosubgrouping
+ */
+class EdgeGeometryStore
+{
+    /*! \name EdgeGeometryStore Object Management *///-------------------------
+    //@{
+public:
+    EdgeGeometryStore() = default;
+    ~EdgeGeometryStore() = default;
+    EdgeGeometryStore(const EdgeGeometryStore&) = delete;
+
+public:
+    using index_t = std::uint32_t;
+
+    //! Line type, values match qan::EdgeStyle::LineType.
+    enum class LineType : std::uint8_t {
+        Straight    = 1,
+        Curved      = 2,
+        Ortho       = 3
+    };
+
+    //! Remove all edges, memory is not released.
+    void        clear() noexcept;
+    void        reserve(std::size_t capacity);
+    inline std::size_t  size() const noexcept { return _lineType.size(); }
+
+    //! Append a new edge and return its index.
+    index_t     add();
+
+    /*! \brief Set edge \c e source and destination bounding rects (in graph CS) and bounding shape corner radius.
+     *
+     * A zero radius define a rectangular bounding shape.
+     */
+    void        setEndpoints(index_t e, const QRectF& srcBr, qreal srcRadius,
+                             const QRectF& dstBr, qreal dstRadius) noexcept;
+
+    //! Set edge \c e line type, arrow length (arrowSize * 3) and source/destination end shapes existence.
+    void        setStyle(index_t e, LineType lineType, qreal arrowLength,
+                         bool srcShape, bool dstShape) noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Batch Kernels *///-----------------------------------------------
+    //@{
+public:
+    //! Run all kernels on all edges.
+    void        update() noexcept;
+
+protected:
+    //! Generate straight p1/p2 and hidden flag for all edges (ends of curved edges are generated here too).
+    void        generateStraightEnds() noexcept;
+    //! Generate ortho p1/p2/c1 for ortho edges.
+    void        generateOrthoEnds() noexcept;
+    //! Generate curved edges c1/c2 and intersect p1/p2 with (c1, src) and (c2, dst) lines.
+    void        generateCurvedControlPoints() noexcept;
+    //! Generate arrow angles and correct p1/p2 by arrow length when edge has an end shape.
+    void        generateArrowAngles() noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Generated Geometry *///------------------------------------------
+    //@{
+public:
+    inline QPointF  getP1(index_t e) const noexcept { return QPointF{_p1x[e], _p1y[e]}; }
+    inline QPointF  getP2(index_t e) const noexcept { return QPointF{_p2x[e], _p2y[e]}; }
+    inline QPointF  getC1(index_t e) const noexcept { return QPointF{_c1x[e], _c1y[e]}; }
+    inline QPointF  getC2(index_t e) const noexcept { return QPointF{_c2x[e], _c2y[e]}; }
+    inline qreal    getSrcAngle(index_t e) const noexcept { return _srcAngle[e]; }
+    inline qreal    getDstAngle(index_t e) const noexcept { return _dstAngle[e]; }
+    inline bool     getHidden(index_t e) const noexcept { return _hidden[e] != 0; }
+    inline LineType getLineType(index_t e) const noexcept { return _lineType[e]; }
+    inline QRectF   getSrcBr(index_t e) const noexcept { return QRectF{_sx[e], _sy[e], _sw[e], _sh[e]}; }
+    inline QRectF   getDstBr(index_t e) const noexcept { return QRectF{_dx[e], _dy[e], _dw[e], _dh[e]}; }
+
+private:
+    // Inputs
+    std::vector<double>         _sx, _sy, _sw, _sh, _sr;    // Source bounding rect and radius
+    std::vector<double>         _dx, _dy, _dw, _dh, _dr;    // Destination bounding rect and radius
+    std::vector<LineType>       _lineType;
+    std::vector<double>         _arrowLength;
+    std::vector<std::uint8_t>   _srcShape, _dstShape;
+
+    // Outputs
+    std::vector<double>         _p1x, _p1y, _p2x, _p2y;
+    std::vector<double>         _c1x, _c1y, _c2x, _c2y;
+    std::vector<double>         _srcAngle, _dstAngle;
+    std::vector<std::uint8_t>   _hidden;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
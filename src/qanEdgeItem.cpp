@@ -32,6 +32,11 @@
 // \date	2017 03 02
 //-----------------------------------------------------------------------------
 
+// Std headers
+#include <typeinfo>
+#include <algorithm>
+#include <cmath>
+
 // Qt headers
 #include <QtGlobal>
 #include <QBrush>
@@ -42,11 +47,10 @@
 #include "./qanEdgeItem.h"
 #include "./qanNodeItem.h"      // Resolve forward declaration
 #include "./qanGroupItem.h"
+#include "./qanPortItem.h"
 #include "./qanGraph.h"
 #include "./qanEdgeDraggableCtrl.h"
 
-#include "./bezier/include/bezier.h"
-
 namespace qan { // ::qan
 
 /* Edge Object Management *///-------------------------------------------------
@@ -71,6 +75,11 @@ EdgeItem::EdgeItem(QQuickItem* parent) :
             this,   &qan::EdgeItem::onWidthChanged);
     connect(this,   &qan::EdgeItem::heightChanged,
             this,   &qan::EdgeItem::onHeightChanged);
+    // Batch renderer only tessellate modified edges
+    connect(this,   &qan::EdgeItem::selectedChanged,
+            this,   &qan::EdgeItem::requestBatchUpdate);
+    connect(this,   &qan::EdgeItem::hiddenChanged,
+            this,   &qan::EdgeItem::requestBatchUpdate);
 }
 
 auto    EdgeItem::getEdge() noexcept -> qan::Edge* { return _edge.data(); }
@@ -79,9 +88,11 @@ auto    EdgeItem::setEdge(qan::Edge* edge) noexcept -> void
 {
     if (_edge != edge) {
         _edge = edge;
-        edge->setItem(this);
+        if (edge != nullptr)
+            edge->setItem(this);
         const auto edgeDraggableCtrl = static_cast<EdgeDraggableCtrl*>(_draggableCtrl.get());
         edgeDraggableCtrl->setTarget(edge);
+        emit edgeChanged();
     }
 }
 
@@ -104,6 +115,44 @@ auto    EdgeItem::setGraph(qan::Graph* graph) -> void
 }
 //-----------------------------------------------------------------------------
 
+/* Delegate Pooling Management *///--------------------------------------------
+void    EdgeItem::saveDelegateDefaults() noexcept
+{
+    _delegateDefaults.saved = true;
+    _delegateDefaults.position = position();
+    _delegateDefaults.size = size();
+}
+
+void    EdgeItem::recycle()
+{
+    if (_sourceItem)
+        disconnect(_sourceItem, nullptr, this, nullptr);
+    if (_destinationItem)
+        disconnect(_destinationItem, nullptr, this, nullptr);
+    _sourceItem = nullptr;
+    emit sourceItemChanged();
+    _destinationItem = nullptr;
+    emit destinationItemChanged();
+    setSelectedState(false);    // Note: edge has already been removed from graph selection
+    setEdge(nullptr);
+    setDragged(false);
+    setHidden(false);
+    setLod(qan::NodeItem::Lod::Full);
+    if (_delegateDefaults.saved) {
+        setPosition(_delegateDefaults.position);
+        setSize(_delegateDefaults.size);
+    }
+    setVisible(false);
+    setParentItem(nullptr);
+    emit pooled();
+}
+
+void    EdgeItem::reuse()
+{
+    emit reused();
+}
+//-----------------------------------------------------------------------------
+
 /* Edge Topology Management *///-----------------------------------------------
 auto    EdgeItem::setSourceItem(qan::NodeItem* source) -> void
 {
@@ -111,8 +160,8 @@ auto    EdgeItem::setSourceItem(qan::NodeItem* source) -> void
         return;
 
     // Connect dst x and y monitored properties change notify signal to slot updateEdge()
-    QMetaMethod updateItemSlot = metaObject()->method( metaObject()->indexOfSlot( "updateItemSlot()" ) );
-    if ( updateItemSlot.isValid() ) {  // Connect src and dst x and y monitored properties change notify signal to slot updateItemSlot()
+    QMetaMethod updateItemSlot = metaObject()->method( metaObject()->indexOfSlot( "scheduleUpdateItem()" ) );
+    if ( updateItemSlot.isValid() ) {  // Connect src and dst x and y monitored properties change notify signal to slot scheduleUpdateItem()
         auto srcMetaObj = source->metaObject();
         QMetaProperty srcX      = srcMetaObj->property(srcMetaObj->indexOfProperty("x"));
         QMetaProperty srcY      = srcMetaObj->property(srcMetaObj->indexOfProperty("y"));
@@ -163,8 +212,8 @@ void    EdgeItem::configureDestinationItem(QQuickItem* item)
     if (item == nullptr)
         return;
 
-    // Connect dst x and y monitored properties change notify signal to slot updateItemSlot()
-    QMetaMethod updateItemSlot = metaObject()->method(metaObject()->indexOfSlot("updateItemSlot()"));
+    // Connect dst x and y monitored properties change notify signal to slot scheduleUpdateItem()
+    QMetaMethod updateItemSlot = metaObject()->method(metaObject()->indexOfSlot("scheduleUpdateItem()"));
     if (!updateItemSlot.isValid()) {
         qWarning() << "qan::EdgeItem::setDestinationItem(): Error: no access to edge updateItem slot.";
         return;
@@ -210,6 +259,25 @@ void    EdgeItem::setHidden(bool hidden) noexcept
     }
 }
 
+void    EdgeItem::setBatchRendered(bool batchRendered) noexcept
+{
+    if (batchRendered != _batchRendered) {
+        _batchRendered = batchRendered;
+        emit batchRenderedChanged();
+    }
+}
+
+void    EdgeItem::requestBatchUpdate() noexcept
+{
+    if (!_batchRendered &&
+        _lod != qan::NodeItem::Lod::Minimal)    // Minimal lod edges are drawn by batch renderer
+        return;
+    const auto graph = getGraph();
+    if (graph != nullptr &&
+        graph->getEdgeBatchRenderer() != nullptr)
+        graph->getEdgeBatchRenderer()->requestItemUpdate(this);
+}
+
 void    EdgeItem::setArrowSize( qreal arrowSize ) noexcept
 {
     if (!qFuzzyCompare(1. + arrowSize, 1. + _arrowSize)) {
@@ -241,8 +309,19 @@ auto    EdgeItem::setDstShape(ArrowShape dstShape) noexcept -> bool
     return false;
 }
 
+void    EdgeItem::scheduleUpdateItem()
+{
+    auto graph = getGraph();
+    if (graph != nullptr)
+        graph->scheduleEdgeUpdate(this);
+    else
+        updateItemSlot();
+}
+
 void    EdgeItem::updateItem() noexcept
 {
+    requestBatchUpdate();   // Note: batch renderer collect edge geometry later, before next frame
+
     // Algorithm:
         // Generate cache step by step until it become invalid.
         // 1. Generate                 srcBr / dstBr / srcBrCenter / dstBrCenter / z
@@ -276,12 +355,94 @@ void    EdgeItem::updateItem() noexcept
         setHidden(true);
 }
 
+bool    EdgeItem::storeGeometry(qan::EdgeGeometryStore& store, qan::EdgeGeometryStore::index_t& e) const noexcept
+{
+    // PRECONDITIONS:
+        // updateItem() must not be overriden (typeid check)
+        // source and destination must be regular nodes (not ports) with a rect or rounded rect bounding shape
+        // source and destination must not be in a collapsed group
+    if (typeid(*this) != typeid(qan::EdgeItem))
+        return false;
+    const auto graph = getGraph();
+    const QQuickItem* graphContainerItem = graph != nullptr ? graph->getContainerItem() : nullptr;
+    if (graphContainerItem == nullptr)
+        return false;
+    const auto isStorable = [](const qan::NodeItem* nodeItem) -> bool {
+        if (nodeItem == nullptr ||
+            qobject_cast<const qan::PortItem*>(nodeItem) != nullptr ||
+            (nodeItem->getBoundingShapeType() != qan::NodeItem::BoundingShapeType::Rect &&
+             nodeItem->getBoundingShapeType() != qan::NodeItem::BoundingShapeType::RoundedRect))
+            return false;
+        const auto node = nodeItem->getNode();
+        const auto group = node != nullptr ? qobject_cast<const qan::Group*>(node->get_group()) : nullptr;
+        return group == nullptr ||
+               group->getGroupItem() == nullptr ||
+               !group->getGroupItem()->getCollapsed();
+    };
+    if (!isStorable(_sourceItem.data()) ||
+        !isStorable(_destinationItem.data()))
+        return false;
+
+    auto lineType = qan::EdgeGeometryStore::LineType::Straight;
+    if (_style) {
+        switch (_style->getLineType()) {
+        case qan::EdgeStyle::LineType::Undefined:   // [[fallthrough]] default to Straight
+        case qan::EdgeStyle::LineType::Straight: lineType = qan::EdgeGeometryStore::LineType::Straight; break;
+        case qan::EdgeStyle::LineType::Curved:   lineType = qan::EdgeGeometryStore::LineType::Curved;   break;
+        case qan::EdgeStyle::LineType::Ortho:    lineType = qan::EdgeGeometryStore::LineType::Ortho;    break;
+        }
+    }
+
+    const auto srcShape = _sourceItem->getBoundingShapeDescriptor();
+    const auto dstShape = _destinationItem->getBoundingShapeDescriptor();
+    e = store.add();
+    store.setEndpoints(e, _sourceItem->mapRectToItem(graphContainerItem, srcShape.rect), srcShape.radius,
+                          _destinationItem->mapRectToItem(graphContainerItem, dstShape.rect), dstShape.radius);
+    store.setStyle(e, lineType, getArrowSize() * 3.,
+                   getSrcShape() != ArrowShape::None,
+                   getDstShape() != ArrowShape::None);
+    return true;
+}
+
+void    EdgeItem::applyStoredGeometry(const qan::EdgeGeometryStore& store, qan::EdgeGeometryStore::index_t e) noexcept
+{
+    requestBatchUpdate();
+    if (!_sourceItem ||
+        !_destinationItem)
+        return;
+
+    GeometryCache cache{};
+    cache.srcItem = _sourceItem.data();
+    cache.dstItem = _destinationItem.data();
+    if (_style)
+        cache.lineType = _style->getLineType();
+    cache.z = qMax(qan::getItemGlobalZ_rec(_sourceItem.data()),
+                   qan::getItemGlobalZ_rec(_destinationItem.data())) - 0.1;
+    cache.hidden = store.getHidden(e);
+    cache.srcBr = store.getSrcBr(e);
+    cache.dstBr = store.getDstBr(e);
+    cache.srcBrCenter = cache.srcBr.center();
+    cache.dstBrCenter = cache.dstBr.center();
+    cache.p1 = store.getP1(e);
+    cache.p2 = store.getP2(e);
+    cache.c1 = store.getC1(e);
+    cache.c2 = store.getC2(e);
+    cache.srcAngle = store.getSrcAngle(e);
+    cache.dstAngle = store.getDstAngle(e);
+    cache.valid = true;
+    generateArrowPoints(cache);
+    generateLabelPosition(cache);
+    applyGeometry(cache);
+}
+
 EdgeItem::GeometryCache::GeometryCache(GeometryCache&& rha) :
     valid{rha.valid},
     lineType{rha.lineType},
     z{rha.z},
     hidden{rha.hidden},
     srcBs{std::move(rha.srcBs)},    dstBs{std::move(rha.dstBs)},
+    srcBsType{rha.srcBsType},       dstBsType{rha.dstBsType},
+    srcBsRadius{rha.srcBsRadius},   dstBsRadius{rha.dstBsRadius},
     srcBr{std::move(rha.srcBr)},    dstBr{std::move(rha.dstBr)},
     srcBrCenter{std::move(rha.srcBrCenter)},
     dstBrCenter{std::move(rha.dstBrCenter)},
@@ -374,28 +535,31 @@ EdgeItem::GeometryCache  EdgeItem::generateGeometryCache() const noexcept
         return cache;   // Return invalid cache
 
     // Generate bounding shapes for source and destination in global CS
-    {
-        if (_sourceItem != nullptr) {        // Generate source bounding shape polygon
-            const auto srcBs = _sourceItem->getBoundingShape();
-            cache.srcBs.resize(srcBs.size());
-            int p = 0;
-            for (const auto& point: srcBs)
-                cache.srcBs[p++] = _sourceItem->mapToItem(graphContainerItem, point);
-        }
-        // Generate destination bounding shape polygon
-        if (dstNodeItem != nullptr) {        // Regular Node -> Node edge
-            // Update edge z to source or destination maximum x
-            const auto dstBs = dstNodeItem->getBoundingShape();
-            cache.dstBs.resize(dstBs.size());
-            int p = 0;
-            for (const auto& point: dstBs)
-                cache.dstBs[p++] = dstNodeItem->mapToItem(graphContainerItem, point);
+    // Note: Analytic shapes (rect, rounded rect, ellipse) are described by their bounding rect mapped with a single
+    // transformation, polygons are mapped point by point.
+    const auto mapBoundingShape = [graphContainerItem](const qan::NodeItem* nodeItem, QPolygonF& bs, QRectF& br,
+                                                       qan::NodeItem::BoundingShapeType& type, qreal& radius) {
+        const auto descriptor = nodeItem->getBoundingShapeDescriptor();
+        type = descriptor.type;
+        radius = descriptor.radius;
+        if (descriptor.isAnalytic()) {
+            br = nodeItem->mapRectToItem(graphContainerItem, descriptor.rect);
+            return;
         }
-    }
+        const auto nodeBs = const_cast<qan::NodeItem*>(nodeItem)->getBoundingShape();
+        bs.resize(nodeBs.size());
+        int p = 0;
+        for (const auto& point: nodeBs)
+            bs[p++] = nodeItem->mapToItem(graphContainerItem, point);
+        br = bs.boundingRect();
+    };
+    QRectF srcBr, dstBr;
+    mapBoundingShape(_sourceItem.data(), cache.srcBs, srcBr, cache.srcBsType, cache.srcBsRadius);
+    mapBoundingShape(dstNodeItem, cache.dstBs, dstBr, cache.dstBsType, cache.dstBsRadius);
 
     // Verify source and destination bounding shapes
-    if (cache.srcBs.isEmpty() ||
-        cache.dstBs.isEmpty()) {
+    if ((cache.srcBsType == qan::NodeItem::BoundingShapeType::Polygon && cache.srcBs.isEmpty()) ||
+        (cache.dstBsType == qan::NodeItem::BoundingShapeType::Polygon && cache.dstBs.isEmpty())) {
         qWarning() << "qan::EdgeItem::generateEdgeGeometry(): Invalid source or destination bounding shape.";
         return cache;    // Return INVALID geometry cache
     }
@@ -409,8 +573,6 @@ EdgeItem::GeometryCache  EdgeItem::generateGeometryCache() const noexcept
         cache.lineType = _style->getLineType();
 
     // Generate edge line P1 and P2 in global graph CS
-    const auto srcBr = cache.srcBs.boundingRect();
-    const auto dstBr = cache.dstBs.boundingRect();
     const QPointF srcBrCenter = srcBr.center(); // Keep theses value in processor cache
     const QPointF dstBrCenter = dstBr.center();
     cache.srcBr = srcBr;
@@ -430,8 +592,19 @@ void    EdgeItem::generateStraightEnds(GeometryCache& cache) const noexcept
     if (!cache.isValid())
         return;
 
-    const QLineF line = getLineIntersection(cache.srcBrCenter, cache.dstBrCenter,
-                                            cache.srcBs, cache.dstBs);
+    QPointF source{cache.srcBrCenter};
+    QPointF destination{cache.dstBrCenter};
+    if (cache.srcBsType != qan::NodeItem::BoundingShapeType::Polygon)
+        qan::NodeItem::intersectBoundingShape(cache.srcBsType, cache.srcBsRadius, cache.srcBr,
+                                              cache.dstBrCenter, source);
+    else
+        source = getLineIntersection(cache.srcBrCenter, cache.dstBrCenter, cache.srcBs);
+    if (cache.dstBsType != qan::NodeItem::BoundingShapeType::Polygon)
+        qan::NodeItem::intersectBoundingShape(cache.dstBsType, cache.dstBsRadius, cache.dstBr,
+                                              cache.srcBrCenter, destination);
+    else
+        destination = getLineIntersection(cache.dstBrCenter, cache.srcBrCenter, cache.dstBs);
+    const QLineF line{source, destination};
 
     // Update hidden: Edge is hidden if it's size is less than the src/dst shape size sum
     {
@@ -522,7 +695,7 @@ void    EdgeItem::generateOrthoEnds(GeometryCache& cache) const noexcept
 {
     // PRECONDITIONS:
         // cache should be valid
-        // cache srcBs and dstBs must not be empty (valid bounding shapes are necessary)
+        // cache srcBr and dstBr must be valid
     if ( !cache.isValid() )
         return;
 
@@ -620,6 +793,41 @@ void    EdgeItem::generateArrowGeometry(GeometryCache& cache) const noexcept
     if (!cache.isValid())
         return;
 
+    generateArrowPoints(cache);
+
+    const qreal arrowLength = getArrowSize() * 3.;
+    const auto srcShape = getSrcShape();
+    const auto dstShape = getDstShape();
+
+    // Generate start/end arrow angle
+    switch (cache.lineType) {
+        case qan::EdgeStyle::LineType::Undefined:      // [[fallthrough]]
+        case qan::EdgeStyle::LineType::Straight:
+            cache.dstAngle = generateStraightArrowAngle(cache.p1, cache.p2, dstShape, arrowLength);
+            cache.srcAngle = generateStraightArrowAngle(cache.p2, cache.p1, srcShape, arrowLength);
+            break;
+
+        case qan::EdgeStyle::LineType::Ortho:
+            cache.dstAngle = generateStraightArrowAngle(cache.c1, cache.p2, dstShape, arrowLength);
+            cache.srcAngle = generateStraightArrowAngle(cache.c1, cache.p1, srcShape, arrowLength);
+            break;
+
+        case qan::EdgeStyle::LineType::Curved:
+            // Generate source arrow angle (p2 <-> p1 and c2 <-> c1)
+            cache.srcAngle = generateCurvedArrowAngle(cache.p2, cache.p1,
+                                                      cache.c2, cache.c1,
+                                                      srcShape, arrowLength);
+
+            // Generate destination arrow angle
+            cache.dstAngle = generateCurvedArrowAngle(cache.p1, cache.p2,
+                                                      cache.c1, cache.c2,
+                                                      dstShape, arrowLength);
+            break;
+    }
+}
+
+void    EdgeItem::generateArrowPoints(GeometryCache& cache) const noexcept
+{
     const qreal arrowSize = getArrowSize();
     const qreal arrowLength = arrowSize * 3.;
 
@@ -674,32 +882,6 @@ void    EdgeItem::generateArrowGeometry(GeometryCache& cache) const noexcept
             break;
         // No default, anyway the cache will be invalid
     }
-
-    // Generate start/end arrow angle
-    switch (cache.lineType) {
-        case qan::EdgeStyle::LineType::Undefined:      // [[fallthrough]]
-        case qan::EdgeStyle::LineType::Straight:
-            cache.dstAngle = generateStraightArrowAngle(cache.p1, cache.p2, dstShape, arrowLength);
-            cache.srcAngle = generateStraightArrowAngle(cache.p2, cache.p1, srcShape, arrowLength);
-            break;
-
-        case qan::EdgeStyle::LineType::Ortho:
-            cache.dstAngle = generateStraightArrowAngle(cache.c1, cache.p2, dstShape, arrowLength);
-            cache.srcAngle = generateStraightArrowAngle(cache.c1, cache.p1, srcShape, arrowLength);
-            break;
-
-        case qan::EdgeStyle::LineType::Curved:
-            // Generate source arrow angle (p2 <-> p1 and c2 <-> c1)
-            cache.srcAngle = generateCurvedArrowAngle(cache.p2, cache.p1,
-                                                      cache.c2, cache.c1,
-                                                      srcShape, arrowLength);
-
-            // Generate destination arrow angle
-            cache.dstAngle = generateCurvedArrowAngle(cache.p1, cache.p2,
-                                                      cache.c1, cache.c2,
-                                                      dstShape, arrowLength);
-            break;
-    }
 }
 
 qreal   EdgeItem::generateStraightArrowAngle(QPointF& p1, QPointF& p2,
@@ -750,7 +932,7 @@ void    EdgeItem::generateCurvedControlPoints(GeometryCache& cache) const noexce
 {
     // PRECONDITIONS:
         // cache should be valid
-        // cache srcBs and dstBs must not be empty (valid bounding shapes are necessary)
+        // cache srcBr and dstBr must be valid
         // cache style must be straight line
     if ( !cache.isValid() )
         return;
@@ -917,8 +1099,16 @@ void    EdgeItem::generateCurvedControlPoints(GeometryCache& cache) const noexce
     }
 
     // Finally, modify p1 and p2 according to c1 and c2
-    cache.p1 = getLineIntersection( cache.c1, cache.srcBrCenter, cache.srcBs);
-    cache.p2 = getLineIntersection( cache.c2, cache.dstBrCenter, cache.dstBs);
+    cache.p1 = cache.c1;
+    if (cache.srcBsType != qan::NodeItem::BoundingShapeType::Polygon)
+        qan::NodeItem::intersectBoundingShape(cache.srcBsType, cache.srcBsRadius, cache.srcBr, cache.c1, cache.p1);
+    else
+        cache.p1 = getLineIntersection( cache.c1, cache.srcBrCenter, cache.srcBs);
+    cache.p2 = cache.c2;
+    if (cache.dstBsType != qan::NodeItem::BoundingShapeType::Polygon)
+        qan::NodeItem::intersectBoundingShape(cache.dstBsType, cache.dstBsRadius, cache.dstBr, cache.c2, cache.p2);
+    else
+        cache.p2 = getLineIntersection( cache.c2, cache.dstBrCenter, cache.dstBs);
 }
 
 
@@ -999,6 +1189,8 @@ void    EdgeItem::applyGeometry(const GeometryCache& cache) noexcept
             emit controlPointsChanged();
         }
 
+        updateHitShape();
+
         setZ(cache.z);
         setLabelPos(mapFromItem(graphContainerItem, cache.labelPosition));
     }
@@ -1026,6 +1218,7 @@ void    EdgeItem::setLine( QPoint src, QPoint dst )
 {
     _p1 = src;
     _p2 = dst;
+    updateHitShape();
     emit lineGeometryChanged();
 }
 
@@ -1223,6 +1416,13 @@ void    EdgeItem::setStyle(EdgeStyle* style) noexcept
                     this,      &EdgeItem::styleModified);
             connect(_style,    &qan::EdgeStyle::dstShapeChanged,
                     this,      &EdgeItem::styleModified);
+            // Appearance only properties are watched from edge delegate, except when edge is batch rendered
+            for (const auto appearanceChanged : {&qan::EdgeStyle::lineColorChanged,
+                                                 &qan::EdgeStyle::lineWidthChanged,
+                                                 &qan::EdgeStyle::dashedChanged,
+                                                 &qan::EdgeStyle::dashPatternChanged})
+                connect(_style, appearanceChanged,
+                        this,   &EdgeItem::requestBatchUpdate);
         }
         emit styleChanged();
         updateItem();   // Force initial style settings
@@ -1245,6 +1445,17 @@ void    EdgeItem::styleModified()
 }
 //-----------------------------------------------------------------------------
 
+/* Level of Detail Management *///-------------------------------------------
+bool    EdgeItem::setLod(qan::NodeItem::Lod lod) noexcept
+{
+    if (lod == _lod)
+        return false;
+    _lod = lod;
+    emit lodChanged();
+    return true;
+}
+//-----------------------------------------------------------------------------
+
 /* Edge drag management *///---------------------------------------------------
 void    EdgeItem::setDraggable(bool draggable) noexcept
 {
@@ -1291,45 +1502,78 @@ void    EdgeItem::setAcceptDrops(bool acceptDrops)
 
 bool    EdgeItem::contains(const QPointF& point) const
 {
-    const auto lineType = _style ? _style->getLineType() : qan::EdgeStyle::LineType::Straight;
-    bool r = false;
-    qreal d = 0.;
+    // Note: Keep hitTolerance constant on screen, tolerance in item CS grow when graph is zoomed out
+    qreal zoom = 1.;
+    const auto graph = getGraph();
+    if (graph != nullptr &&
+        graph->getContainerItem() != nullptr)
+        zoom = graph->getContainerItem()->scale();
+    const qreal tolerance = hitTolerance / std::max(zoom, 0.01);
+    return polylineContains(_hitPolyline, _hitBr, point, tolerance);
+}
+
+QPolygonF   EdgeItem::flattenLine(qan::EdgeStyle::LineType lineType,
+                                  const QPointF& p1, const QPointF& p2,
+                                  const QPointF& c1, const QPointF& c2,
+                                  qreal flatness)
+{
+    QPolygonF polyline;
     switch (lineType) {
     case qan::EdgeStyle::LineType::Undefined:  // [[fallthrough]]
     case qan::EdgeStyle::LineType::Straight:
-        d = distanceFromLine(point, QLineF{_p1, _p2});
-        r = (d > -0.001 && d < 6.001);
+        polyline << p1 << p2;
+        break;
+    case qan::EdgeStyle::LineType::Ortho:
+        polyline << p1 << c1 << p2;
         break;
     case qan::EdgeStyle::LineType::Curved: {
-        bezier::Bezier<3> cubicBezier({{static_cast<float>(_p1.x()), static_cast<float>(_p1.y())},
-                                       {static_cast<float>(_c1.x()), static_cast<float>(_c1.y())},
-                                       {static_cast<float>(_c2.x()), static_cast<float>(_c2.y())},
-                                       {static_cast<float>(_p2.x()), static_cast<float>(_p2.y())}});
-        // FIXME: check p in cubicBezier.tbb() (aka Tight bounding box)
-        // FIXME: At least, adapt steps to tbb.length() / thresold (here 6)
-        const auto steps = 25;
-        const auto dStep = 1.0 / static_cast<float>(steps);
-        for (int step = 0; step < steps; step++) {
-            const auto pos = dStep * step;
-            auto curveP = cubicBezier.valueAt(pos);
-            const auto d = QLineF{point, QPointF{curveP.x, curveP.y}}.length();
-            if (d > -0.001 && d < 6.001) {
-                r = true;
-                break;
-            }
+        // Uniform subdivision error is bounded by max|B''| / (8.n^2), with max|B''| <= 6.max(|p1 - 2c1 + c2|, |c1 - 2c2 + p2|)
+        const QPointF d1 = p1 - (2. * c1) + c2;
+        const QPointF d2 = c1 - (2. * c2) + p2;
+        const qreal secondDerivative = 6. * std::sqrt(std::max(QPointF::dotProduct(d1, d1), QPointF::dotProduct(d2, d2)));
+        static constexpr int maxSegments = 128;
+        const int segments = std::clamp(static_cast<int>(std::ceil(std::sqrt(secondDerivative / (8. * std::max(flatness, 0.01))))),
+                                        1, maxSegments);
+        polyline.reserve(segments + 1);
+        for (int s = 0; s <= segments; s++) {
+            const qreal t = static_cast<qreal>(s) / segments;
+            const qreal u = 1. - t;
+            polyline << (u * u * u * p1) + (3. * u * u * t * c1) + (3. * u * t * t * c2) + (t * t * t * p2);
         }
     }
         break;
-    case qan::EdgeStyle::LineType::Ortho:
-        d = distanceFromLine(point, QLineF{_p1, _c1});
-        r = (d > -0.001 && d < 6.001);
-        if (!r) {
-            const qreal d2 = distanceFromLine(point, QLineF{_p2, _c1});
-            r = (d2 > -0.001 && d2 < 6.001);
-        }
-        break;
     }
-    return r;
+    return polyline;
+}
+
+bool    EdgeItem::polylineContains(const QPolygonF& polyline, const QRectF& polylineBr,
+                                   const QPointF& point, qreal tolerance) noexcept
+{
+    // PRECONDITIONS:
+        // polyline must have at least two points
+    if (polyline.size() < 2)
+        return false;
+    if (!polylineBr.adjusted(-tolerance, -tolerance, tolerance, tolerance).contains(point))
+        return false;   // Fast bounding rect rejection
+    const qreal tolerance2 = tolerance * tolerance;
+    for (int s = 0; s < polyline.size() - 1; s++) {
+        const QPointF a = polyline[s];
+        const QPointF ab = polyline[s + 1] - a;
+        const QPointF ap = point - a;
+        const qreal ab2 = QPointF::dotProduct(ab, ab);
+        const qreal t = ab2 > 0. ? std::clamp(QPointF::dotProduct(ap, ab) / ab2, 0., 1.) : 0.;
+        const QPointF d = ap - (t * ab);
+        if (QPointF::dotProduct(d, d) <= tolerance2)
+            return true;
+    }
+    return false;
+}
+
+void    EdgeItem::updateHitShape()
+{
+    const auto lineType = _style ? _style->getLineType() : qan::EdgeStyle::LineType::Straight;
+    _hitPolyline = flattenLine(lineType, _p1, _p2, _c1, _c2);
+    _hitBr = _hitPolyline.boundingRect();
 }
 
 void    EdgeItem::dragEnterEvent(QDragEnterEvent* event)
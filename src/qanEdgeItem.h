@@ -41,6 +41,7 @@
 #include "./qanStyle.h"
 #include "./qanNodeItem.h"
 #include "./qanSelectable.h"
+#include "./qanEdgeGeometryStore.h"
 
 namespace qan { // ::qan
 
@@ -68,12 +69,15 @@ public:
     EdgeItem(const EdgeItem&) = delete;
 
 public:
-    Q_PROPERTY(qan::Edge* edge READ getEdge CONSTANT FINAL)
+    //! Item edge, could change when item is reused from qan::Graph delegate pool.
+    Q_PROPERTY(qan::Edge* edge READ getEdge NOTIFY edgeChanged FINAL)
     auto        getEdge() noexcept -> qan::Edge*;
     auto        getEdge() const noexcept -> const qan::Edge*;
     auto        setEdge(qan::Edge* edge) noexcept -> void;
 private:
     QPointer<qan::Edge>    _edge;
+signals:
+    void        edgeChanged();
 
 public:
     Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged)
@@ -89,6 +93,45 @@ private:
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Delegate Pooling Management *///--------------------------------
+    //@{
+public:
+    //! Component used to create this item, set by qan::Graph (used to pool item, see qan::Graph::delegatePooling).
+    inline QQmlComponent*   getDelegateComponent() const noexcept { return _delegateComponent.data(); }
+    //! \copydoc getDelegateComponent()
+    inline void             setDelegateComponent(QQmlComponent* delegateComponent) noexcept { _delegateComponent = delegateComponent; }
+private:
+    QPointer<QQmlComponent> _delegateComponent;
+
+public:
+    //! \copydoc qan::NodeItem::saveDelegateDefaults()
+    void            saveDelegateDefaults() noexcept;
+private:
+    struct DelegateDefaults {
+        bool    saved = false;
+        QPointF position;
+        QSizeF  size;
+    };
+    DelegateDefaults    _delegateDefaults;
+
+public:
+    /*! \brief Detach this item from it's edge and source/destination items before it is stored in qan::Graph delegate pool (internal).
+     *
+     * Source and destination geometry monitoring is disconnected, item is unselected, hidden and removed
+     * from graph container. Position and size are restored to delegate defaults (see saveDelegateDefaults()),
+     * dragged and hidden are reset and level of detail is set to \c Full, then \c pooled() is emitted.
+     */
+    virtual void    recycle();
+    //! Called by qan::Graph once a pooled item has been bound to a new edge (internal), emit \c reused().
+    virtual void    reuse();
+signals:
+    //! \copydoc qan::NodeItem::pooled()
+    void            pooled();
+    //! Emitted when this item is reused from qan::Graph delegate pool, \c edge, \c graph and \c style are already set.
+    void            reused();
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Edge Topology Management *///------------------------------------
     //@{
 public:
@@ -131,6 +174,21 @@ signals:
 private:
     bool        _hidden = false;
 
+public:
+    /*! \brief Set to true when edge is drawn by graph qan::EdgeBatchRenderer (see qan::Graph::edgeBatchRendering), edge delegate should not draw anything.
+     *
+     * Edge item is still used for hit testing and selection when \c batchRendered is true.
+     */
+    Q_PROPERTY(bool batchRendered READ getBatchRendered NOTIFY batchRenderedChanged FINAL)
+    inline bool getBatchRendered() const noexcept { return _batchRendered; }
+    void        setBatchRendered(bool batchRendered) noexcept;
+signals:
+    void        batchRenderedChanged();
+private:
+    bool        _batchRendered = false;
+    //! Request a graph batch renderer update when edge is batch rendered.
+    void        requestBatchUpdate() noexcept;
+
 public:
     Q_PROPERTY(qreal arrowSize READ getArrowSize WRITE setArrowSize NOTIFY arrowSizeChanged FINAL)
     void            setArrowSize( qreal arrowSize ) noexcept;
@@ -172,6 +230,21 @@ signals:
 public slots:
     //! Call updateItem() (override updateItem() to an empty method for invisible edges).
     virtual void        updateItemSlot() { updateItem(); }
+    /*! \brief Request an updateItemSlot() call before next frame, source and destination geometry changes are connected to this slot.
+     *
+     * Update is queued in edge graph (see qan::Graph::scheduleEdgeUpdate()), edge is then updated at most
+     * once per frame whatever the number of source/destination properties modified. Update is immediate
+     * when edge has no graph or graph is not in a window.
+     */
+    void                scheduleUpdateItem();
+public:
+    //! Used internally by qan::Graph edge update queue, true when edge is already queued for an update.
+    inline bool         isUpdateScheduled() const noexcept { return _updateScheduled; }
+    //! \copydoc isUpdateScheduled()
+    inline void         setUpdateScheduled(bool updateScheduled) noexcept { _updateScheduled = updateScheduled; }
+private:
+    //! \copydoc isUpdateScheduled()
+    bool                _updateScheduled = false;
 public:
     /*! \brief Update edge bounding box according to source and destination item actual position and size.
      *
@@ -180,6 +253,16 @@ public:
      */
     virtual void        updateItem() noexcept;
 
+    /*! \brief Pack this edge source/destination rects and style in \c store, return false if edge geometry can't be generated by store.
+     *
+     * Only node to node edges with default (rounded rectangle) bounding shapes, not in a collapsed group, and with
+     * no updateItem() override are supported, other edges must be updated with updateItem().
+     * \sa qan::Graph::flushEdgeUpdates()
+     */
+    bool                storeGeometry(qan::EdgeGeometryStore& store, qan::EdgeGeometryStore::index_t& e) const noexcept;
+    //! Apply geometry generated by \c store for edge \c e (previously packed with storeGeometry()).
+    void                applyStoredGeometry(const qan::EdgeGeometryStore& store, qan::EdgeGeometryStore::index_t e) noexcept;
+
 protected:
      /*! Cache current edge geometry state.
       *
@@ -201,8 +284,12 @@ protected:
         qreal   z = 0.;
 
         bool hidden = false;
-        QPolygonF   srcBs;
+        QPolygonF   srcBs;      // Empty for analytic bounding shapes
         QPolygonF   dstBs;
+        qan::NodeItem::BoundingShapeType    srcBsType{qan::NodeItem::BoundingShapeType::Polygon};
+        qan::NodeItem::BoundingShapeType    dstBsType{qan::NodeItem::BoundingShapeType::Polygon};
+        qreal       srcBsRadius = 0.;
+        qreal       dstBsRadius = 0.;
         QRectF      srcBr, dstBr;
         QPointF     srcBrCenter;
         QPointF     dstBrCenter;
@@ -233,6 +320,9 @@ protected:
      */
     inline void             generateArrowGeometry(GeometryCache& cache) const noexcept;
 
+    //! Generate arrow shapes points (srcA1..A3 and dstA1..A3) in arrow local CS.
+    inline void             generateArrowPoints(GeometryCache& cache) const noexcept;
+
     //! Generate arrow angle for a curved edge points.
     inline qreal            generateStraightArrowAngle(QPointF& p1, QPointF& p2,
                                                        const qan::EdgeStyle::ArrowShape arrowShape,
@@ -429,6 +519,20 @@ private slots:
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Level of Detail Management *///--------------------------------
+    //@{
+public:
+    //! Current edge level of detail, set by qan::Graph according to view zoom (default to Full, \sa qan::NodeItem::Lod).
+    Q_PROPERTY(qan::NodeItem::Lod lod READ getLod NOTIFY lodChanged FINAL)
+    inline qan::NodeItem::Lod   getLod() const noexcept { return _lod; }
+    bool                        setLod(qan::NodeItem::Lod lod) noexcept;
+private:
+    qan::NodeItem::Lod          _lod = qan::NodeItem::Lod::Full;
+signals:
+    void                        lodChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Edge drag management *///----------------------------------------
     //@{
 public:
@@ -512,9 +616,37 @@ signals:
     void            acceptDropsChanged();
 
 protected:
-    //! Return true if point is actually on the edge (not only in edge bounding rect).
+    /*! \brief Return true if point is actually on the edge (not only in edge bounding rect).
+     *
+     * Point is tested against a cached flattened edge line (see updateHitShape()) with bounding rect rejection, maximum
+     * distance is \c hitTolerance pixels (scaled by graph zoom).
+     */
     virtual bool    contains(const QPointF& point) const override;
 
+public:
+    //! Maximum distance in pixels between a point and edge line for contains(), scaled by graph container zoom.
+    static constexpr qreal  hitTolerance = 6.;
+
+    /*! \brief Flatten an edge line to a polyline: (p1, p2) for straight lines, (p1, c1, p2) for ortho lines.
+     *
+     * Curved lines (cubic p1, c1, c2, p2) are subdivided uniformly with enough segments to keep flattening error
+     * under \c flatness.
+     */
+    static QPolygonF    flattenLine(qan::EdgeStyle::LineType lineType,
+                                    const QPointF& p1, const QPointF& p2,
+                                    const QPointF& c1, const QPointF& c2,
+                                    qreal flatness = 0.5);
+    //! Return true if \c point distance to \c polyline is less than \c tolerance (\c polylineBr is \c polyline bounding rect).
+    static bool         polylineContains(const QPolygonF& polyline, const QRectF& polylineBr,
+                                         const QPointF& point, qreal tolerance) noexcept;
+protected:
+    //! Rebuild contains() cached polyline and bounding rect from current p1, p2, c1, c2 geometry (called from applyGeometry()).
+    void                updateHitShape();
+private:
+    QPolygonF           _hitPolyline;
+    QRectF              _hitBr;
+protected:
+
     /*! \brief Internally used to manage drag and drop over nodes, override with caution, and call base class implementation.
      *
      * Drag enter event are not restricted to the edge bounding rect but to the edge line with a distance delta, computing
@@ -0,0 +1,184 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEffectAtlas.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Qt headers
+#include <QQuickWindow>
+#include <QSGTexture>
+#include <QRectF>
+
+// QuickQanava headers
+#include "./qanEffectAtlas.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+//! Signed distance from \c (x, y) to \c rect rounded with \c radius (negative inside).
+qreal   roundedRectDistance(qreal x, qreal y, const QRectF& rect, qreal radius) noexcept
+{
+    const auto qx = std::abs(x - rect.center().x()) - ((rect.width() / 2.) - radius);
+    const auto qy = std::abs(y - rect.center().y()) - ((rect.height() / 2.) - radius);
+    const auto outside = std::hypot(std::max(qx, 0.), std::max(qy, 0.));
+    const auto inside = std::min(std::max(qx, qy), 0.);
+    return outside + inside - radius;
+}
+
+//! Antialiased \c rect coverage for a \c size x \c size image.
+std::vector<float>  roundedRectCoverage(int size, const QRectF& rect, qreal radius)
+{
+    std::vector<float> coverage(static_cast<std::size_t>(size) * size, 0.f);
+    for (int y = 0; y < size; y++)
+        for (int x = 0; x < size; x++) {
+            const auto d = roundedRectDistance(x + 0.5, y + 0.5, rect, radius);
+            coverage[(y * size) + x] = static_cast<float>(std::clamp(0.5 - d, 0., 1.));
+        }
+    return coverage;
+}
+
+//! In place \c radius box blur of a \c size x \c size image, in one direction (pixels outside image are 0).
+void    boxBlur(std::vector<float>& values, std::vector<float>& buffer, int size, int radius, bool horizontal)
+{
+    const auto at = [&](int line, int i) -> float& {
+        return horizontal ? values[(line * size) + i] : values[(i * size) + line];
+    };
+    const auto norm = 1.f / static_cast<float>((2 * radius) + 1);
+    buffer.resize(static_cast<std::size_t>(size));
+    for (int line = 0; line < size; line++) {
+        float sum = 0.f;
+        for (int i = 0; i <= std::min(radius, size - 1); i++)
+            sum += at(line, i);
+        for (int i = 0; i < size; i++) {
+            buffer[i] = sum * norm;
+            if (i + radius + 1 < size)          // Slide the window
+                sum += at(line, i + radius + 1);
+            if (i - radius >= 0)
+                sum -= at(line, i - radius);
+        }
+        for (int i = 0; i < size; i++)
+            at(line, i) = buffer[i];
+    }
+}
+
+} // ::qan::anonymous
+
+/* EffectAtlas Object Management *///------------------------------------------
+EffectAtlas::EffectAtlas(QQuickWindow* window) :
+    QObject{window},
+    _window{window}
+{
+    if (window != nullptr)
+        connect(window, &QQuickWindow::sceneGraphInvalidated,
+                this,   &EffectAtlas::releaseTextures, Qt::DirectConnection);
+}
+
+EffectAtlas::~EffectAtlas() { releaseTextures(); }
+
+EffectAtlas*    EffectAtlas::forWindow(QQuickWindow* window)
+{
+    if (window == nullptr)
+        return nullptr;
+    auto atlas = window->findChild<qan::EffectAtlas*>(QString{}, Qt::FindDirectChildrenOnly);
+    return atlas != nullptr ? atlas : new qan::EffectAtlas{window};
+}
+//-----------------------------------------------------------------------------
+
+/* Nine-Patch Textures Management *///-----------------------------------------
+auto    EffectAtlas::makeKey(qreal radius, qreal blur, qreal offset, const QColor& color) noexcept -> Key
+{
+    return Key{std::max(0, qRound(radius)), std::max(0, qRound(blur)), qRound(offset), color.rgba()};
+}
+
+QSGTexture* EffectAtlas::texture(const Key& key)
+{
+    const auto texture = _textures.find(key);
+    if (texture != _textures.end())
+        return texture->second.get();
+    if (!_window)
+        return nullptr;
+    const auto image = generateNinePatch(key);
+    auto newTexture = std::unique_ptr<QSGTexture>{_window->createTextureFromImage(image, QQuickWindow::TextureCanUseAtlas |
+                                                                                         QQuickWindow::TextureHasAlphaChannel)};
+    if (!newTexture)
+        return nullptr;
+    newTexture->setFiltering(QSGTexture::Linear);
+    return _textures.emplace(key, std::move(newTexture)).first->second.get();
+}
+
+void    EffectAtlas::releaseTextures() noexcept { _textures.clear(); }
+
+int     EffectAtlas::cornerSize(const Key& key) noexcept
+{
+    return std::max(key.radius, 0) + (2 * std::max(key.blur, 0)) + std::abs(key.offset) + 1;
+}
+
+QImage  EffectAtlas::generateNinePatch(const Key& key)
+{
+    // Algorithm:
+        // 1. Compute antialiased shape coverage, shape is inset by blur extent.
+        // 2. Blur coverage with three box blur passes (approximate a gaussian blur with blur extent).
+        // 3. Knock out node shape (shape moved by -offset) and colorize.
+    const int size = (2 * cornerSize(key)) + 1;
+    const qreal blur = key.blur;
+    const QRectF shape{blur, blur, size - (2. * blur), size - (2. * blur)};
+    auto alpha = roundedRectCoverage(size, shape, key.radius);                  // 1.
+    if (key.blur > 0) {                                                         // 2.
+        const int passRadius = std::max(1, qRound(blur / 3.));
+        std::vector<float> buffer;
+        for (int pass = 0; pass < 3; pass++) {
+            boxBlur(alpha, buffer, size, passRadius, true);
+            boxBlur(alpha, buffer, size, passRadius, false);
+        }
+    }
+    const auto knockout = roundedRectCoverage(size, shape.translated(-key.offset, -key.offset), key.radius);
+    QImage image{size, size, QImage::Format_ARGB32_Premultiplied};              // 3.
+    const QColor color = QColor::fromRgba(key.color);
+    for (int y = 0; y < size; y++) {
+        auto line = reinterpret_cast<QRgb*>(image.scanLine(y));
+        for (int x = 0; x < size; x++) {
+            const auto i = (y * size) + x;
+            const auto a = alpha[i] * (1.f - knockout[i]) * color.alphaF();
+            line[x] = qPremultiply(qRgba(color.red(), color.green(), color.blue(),
+                                         std::clamp(qRound(a * 255.f), 0, 255)));
+        }
+    }
+    return image;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
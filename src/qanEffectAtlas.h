@@ -0,0 +1,138 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanEffectAtlas.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <memory>
+#include <unordered_map>
+
+// Qt headers
+#include <QObject>
+#include <QPointer>
+#include <QColor>
+#include <QImage>
+
+QT_BEGIN_NAMESPACE
+class QQuickWindow;
+class QSGTexture;
+QT_END_NAMESPACE
+
+namespace qan { // ::qan
+
+/*! \brief Per window cache of pre blurred nine-patch shadow and glow textures shared by all qan::RectEffect items.
+ *
+ * A nine-patch texture contains a blurred rounded rectangle with \c radius corners, \c blur blur extent and
+ * \c offset shadow offset, with the (unblurred, not offset) node shape knocked out. Corners are drawn unscaled,
+ * borders and center are stretched: a single texture is valid for any node size, and is generated once per
+ * (radius, blur, offset, color) key.
+ *
+ * Textures are created with QQuickWindow::TextureCanUseAtlas, they are packed in Qt Quick texture atlas: effects
+ * quads sharing a key are batched by the scene graph renderer in a single draw call, there is no offscreen
+ * rendering pass.
+ *
+ * \note Textures are released when window scene graph is invalidated, atlas is destroyed with its window.
+ * \nosubgrouping
+ */
+class EffectAtlas : public QObject
+{
+    /*! \name EffectAtlas Object Management *///-------------------------------
+    //@{
+    Q_OBJECT
+public:
+    explicit EffectAtlas(QQuickWindow* window);
+    virtual ~EffectAtlas() override;
+    EffectAtlas(const EffectAtlas&) = delete;
+
+    //! Return \c window effect atlas, atlas is created on first call (must be called from GUI thread).
+    static EffectAtlas* forWindow(QQuickWindow* window);
+private:
+    QPointer<QQuickWindow>  _window;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Nine-Patch Textures Management *///------------------------------
+    //@{
+public:
+    struct Key {
+        int     radius = 0;
+        int     blur = 0;
+        int     offset = 0;
+        QRgb    color = 0;
+        inline bool operator==(const Key& other) const noexcept {
+            return radius == other.radius && blur == other.blur &&
+                   offset == other.offset && color == other.color;
+        }
+    };
+    struct KeyHash {
+        inline std::size_t operator()(const Key& key) const noexcept {
+            std::size_t h = std::hash<int>{}(key.radius);
+            h = (h * 31) ^ std::hash<int>{}(key.blur);
+            h = (h * 31) ^ std::hash<int>{}(key.offset);
+            return (h * 31) ^ std::hash<QRgb>{}(key.color);
+        }
+    };
+
+    //! Build a key from node style values (values are rounded to pixels, negative radius and blur are clamped to 0).
+    static Key          makeKey(qreal radius, qreal blur, qreal offset, const QColor& color) noexcept;
+
+    /*! \brief Return \c key texture, texture is generated and cached on first access (must be called from render thread).
+     *
+     * \return Texture owned by atlas, or nullptr if atlas window is destroyed.
+     */
+    QSGTexture*         texture(const Key& key);
+
+    //! Number of cached textures.
+    inline std::size_t  size() const noexcept { return _textures.size(); }
+
+    //! Nine-patch corner size in pixels for \c key (corners contains all rounded and blurred shape features).
+    static int          cornerSize(const Key& key) noexcept;
+
+    /*! \brief Generate \c key nine-patch image (premultiplied ARGB, 2 * cornerSize(key) + 1 pixels wide and high).
+     *
+     * For a target rect expanded by \c key.blur, shape is inset by \c key.blur, knocked out shape is moved
+     * by -offset.
+     */
+    static QImage       generateNinePatch(const Key& key);
+
+private:
+    //! Release all textures (called on render thread when scene graph is invalidated).
+    void                releaseTextures() noexcept;
+
+    std::unordered_map<Key, std::unique_ptr<QSGTexture>, KeyHash>   _textures;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
@@ -0,0 +1,789 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanForceDirectedLayout.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+// QuickQanava headers
+#include "./qanForceDirectedLayout.h"
+#include "./qanNodeItem.h"
+#include "./qanGroupItem.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::
+
+/* Minimal fork-join worker pool: parallelFor() split a range in one chunk per thread, the calling thread
+ * process the first chunk.
+ */
+class WorkerPool
+{
+public:
+    using Task = std::function<void(std::size_t, std::size_t)>;
+
+    explicit WorkerPool(unsigned threadCount) :
+        _threadCount{std::max(1u, threadCount)}
+    {
+        for (unsigned t = 1; t < _threadCount; ++t)
+            _threads.emplace_back([this, t]() { run(t); });
+    }
+    ~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _stop = true;
+            ++_generation;
+        }
+        _taskCondition.notify_all();
+        for (auto& thread : _threads)
+            thread.join();
+    }
+    WorkerPool(const WorkerPool&) = delete;
+
+    unsigned    threadCount() const noexcept { return _threadCount; }
+
+    void    parallelFor(std::size_t count, const Task& task)
+    {
+        if (_threads.empty()) {
+            task(0, count);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _task = &task;
+            _count = count;
+            _pending = _threads.size();
+            ++_generation;
+        }
+        _taskCondition.notify_all();
+        runChunk(task, count, 0);
+        std::unique_lock<std::mutex> lock{_mutex};
+        _doneCondition.wait(lock, [this]() { return _pending == 0; });
+        _task = nullptr;
+    }
+
+private:
+    void    runChunk(const Task& task, std::size_t count, unsigned t) const
+    {
+        const auto begin = count * t / _threadCount;
+        const auto end = count * (t + 1) / _threadCount;
+        if (begin < end)
+            task(begin, end);
+    }
+
+    void    run(unsigned t)
+    {
+        std::size_t generation = 0;
+        for (;;) {
+            const Task* task = nullptr;
+            std::size_t count = 0;
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+                _taskCondition.wait(lock, [this, generation]() { return _generation != generation; });
+                generation = _generation;
+                if (_stop)
+                    return;
+                task = _task;
+                count = _count;
+            }
+            runChunk(*task, count, t);
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                if (--_pending == 0)
+                    _doneCondition.notify_one();
+            }
+        }
+    }
+
+    const unsigned              _threadCount;
+    std::vector<std::thread>    _threads;
+    std::mutex                  _mutex;
+    std::condition_variable     _taskCondition;
+    std::condition_variable     _doneCondition;
+    const Task*                 _task = nullptr;
+    std::size_t                 _count = 0;
+    std::size_t                 _pending = 0;
+    std::size_t                 _generation = 0;
+    bool                        _stop = false;
+};
+
+/* Barnes-Hut quadtree built from bodies sorted on their Morton code: every cell match a contiguous range
+ * of sorted bodies, cells center of mass are computed from prefix sums. Leaves contain at most \c leafSize
+ * bodies, or more very close bodies at maximum depth.
+ *
+ * Cells are stored in depth first pre-order: a cell children immediately follow it and \c next is the index
+ * of the first cell after its subtree. Traversal is a forward scan skipping far subtrees (no stack, mostly
+ * sequential memory accesses).
+ */
+class QuadTree
+{
+public:
+    struct Cell {
+        double          mx = 0., my = 0.;           // Center of mass
+        double          mass = 0.;
+        double          size2 = 0.;                 // Squared cell side length
+        std::uint32_t   begin = 0, end = 0;         // Cell bodies range in order
+        std::uint32_t   next = 0;                   // First cell after cell subtree, a leaf next cell is index + 1
+    };
+
+    std::vector<Cell>           cells;
+    //! Bodies sorted on Morton code (ie spatially coherent order).
+    std::vector<std::uint32_t>  order;
+    //! Bodies positions in \c order.
+    std::vector<double>         sortedXs, sortedYs;
+    //! Group cells in pre-order, every body belong to exactly one group.
+    std::vector<std::uint32_t>  groups;
+
+    void    build(const std::vector<double>& xs, const std::vector<double>& ys, WorkerPool& pool)
+    {
+        const auto count = xs.size();
+        cells.clear();
+        groups.clear();
+        order.resize(count);
+        if (count == 0)
+            return;
+        auto minX = xs[0], maxX = xs[0], minY = ys[0], maxY = ys[0];
+        std::mutex boundsMutex;
+        pool.parallelFor(count, [&](std::size_t begin, std::size_t end) {
+            auto chunkMinX = xs[begin], chunkMaxX = xs[begin], chunkMinY = ys[begin], chunkMaxY = ys[begin];
+            for (auto b = begin + 1; b < end; ++b) {
+                chunkMinX = std::min(chunkMinX, xs[b]);
+                chunkMaxX = std::max(chunkMaxX, xs[b]);
+                chunkMinY = std::min(chunkMinY, ys[b]);
+                chunkMaxY = std::max(chunkMaxY, ys[b]);
+            }
+            std::lock_guard<std::mutex> lock{boundsMutex};
+            minX = std::min(minX, chunkMinX);
+            maxX = std::max(maxX, chunkMaxX);
+            minY = std::min(minY, chunkMinY);
+            maxY = std::max(maxY, chunkMaxY);
+        });
+        const auto half = std::max(maxX - minX, maxY - minY) / 2. + 1.;
+
+        // Sort bodies on Morton code (LSD radix sort, stable and deterministic)
+        const auto scale = static_cast<double>(1u << maxDepth) / (2. * half);
+        const auto quantize = [scale](double v) {
+            return std::min(static_cast<std::uint32_t>(v * scale), (1u << maxDepth) - 1u);
+        };
+        _codes.resize(count);
+        _sortedCodes.resize(count);
+        sortedXs.resize(count);
+        sortedYs.resize(count);
+        pool.parallelFor(count, [&](std::size_t begin, std::size_t end) {
+            for (auto b = begin; b < end; ++b) {
+                _codes[b] = interleave(quantize(xs[b] - minX)) | (interleave(quantize(ys[b] - minY)) << 1);
+                order[b] = static_cast<std::uint32_t>(b);
+            }
+        });
+        _swap.resize(count);
+        for (unsigned shift = 0; shift < 32; shift += 8) {
+            std::size_t offsets[257] = {0};
+            for (const auto b : order)
+                ++offsets[((_codes[b] >> shift) & 0xFFu) + 1];
+            for (std::size_t d = 0; d < 256; ++d)
+                offsets[d + 1] += offsets[d];
+            for (const auto b : order)
+                _swap[offsets[(_codes[b] >> shift) & 0xFFu]++] = b;
+            order.swap(_swap);
+        }
+        pool.parallelFor(count, [&](std::size_t begin, std::size_t end) {
+            for (auto o = begin; o < end; ++o) {
+                _sortedCodes[o] = _codes[order[o]];
+                sortedXs[o] = xs[order[o]];
+                sortedYs[o] = ys[order[o]];
+            }
+        });
+        _sumX.assign(count + 1, 0.);
+        _sumY.assign(count + 1, 0.);
+        for (std::size_t o = 0; o < count; ++o) {
+            _sumX[o + 1] = _sumX[o] + sortedXs[o];
+            _sumY[o + 1] = _sumY[o] + sortedYs[o];
+        }
+
+        // Note: tree (and forces) do not depend on thread count.
+        cells.reserve(count * 2);
+        const Range root{0, static_cast<std::uint32_t>(count), 0, minX + half, minY + half, half};
+        _pending.clear();
+        if (pool.threadCount() <= 1)
+            expand(cells, root, maxDepth, nullptr);
+        else
+            splice(root, pool);
+
+        // Groups: largest cells with at most groupSize bodies (or leaves at maximum depth), cover all bodies
+        const auto cellCount = static_cast<std::uint32_t>(cells.size());
+        for (std::uint32_t c = 0; c < cellCount; ) {
+            if (cells[c].end - cells[c].begin <= groupSize ||
+                cells[c].next == c + 1) {
+                groups.push_back(c);
+                c = cells[c].next;
+            } else
+                ++c;
+        }
+    }
+
+private:
+    static constexpr int maxDepth = 16;
+    //! Maximum bodies in a leaf (leaf bodies interact directly), except at maximum depth.
+    static constexpr std::uint32_t leafSize = 8;
+    //! Maximum bodies in a group sharing a single interaction list, except for leaves at maximum depth.
+    static constexpr std::uint32_t groupSize = 32;
+    //! Depth where cells building is split in independent subtrees (at most 4^splitDepth).
+    static constexpr int splitDepth = 4;
+
+    //! Cell bodies range and geometry, \c cell is the cell index in top cells for pending subtrees.
+    struct Range {
+        std::uint32_t   begin, end;
+        int             depth;
+        double          x, y, half;                 // Cell center and half size
+        std::size_t     cell = 0;
+    };
+
+    /*! \brief Append \c range cell and its subtree cells to \c out in pre-order, splitting sorted ranges on 2 bits of Morton code per level.
+     *
+     * Cells at \c stopDepth are not split and are appended to \c pending (when not nullptr), their \c next is set
+     * once their subtree has been built.
+     */
+    void    expand(std::vector<Cell>& out, const Range& range, int stopDepth, std::vector<Range>* pending) const
+    {
+        const auto c = out.size();
+        Cell cell;
+        cell.begin = range.begin;
+        cell.end = range.end;
+        cell.mass = static_cast<double>(range.end - range.begin);
+        cell.mx = (_sumX[range.end] - _sumX[range.begin]) / cell.mass;
+        cell.my = (_sumY[range.end] - _sumY[range.begin]) / cell.mass;
+        cell.size2 = (range.half * 2.) * (range.half * 2.);
+        out.push_back(cell);
+        if (range.end - range.begin > leafSize &&
+            range.depth < maxDepth) {
+            if (range.depth >= stopDepth) {
+                if (pending != nullptr) {
+                    pending->push_back(range);
+                    pending->back().cell = c;
+                }
+            } else {
+                const auto shift = 2 * (maxDepth - 1 - range.depth);
+                const auto childHalf = range.half / 2.;
+                auto childBegin = range.begin;
+                for (std::uint32_t q = 0; q < 4 && childBegin < range.end; ++q) {
+                    const auto childEnd = static_cast<std::uint32_t>(
+                                std::upper_bound(_sortedCodes.begin() + childBegin, _sortedCodes.begin() + range.end, q,
+                                                 [shift](std::uint32_t value, std::uint32_t code) {
+                                                    return value < ((code >> shift) & 3u);
+                                                 }) - _sortedCodes.begin());
+                    if (childEnd == childBegin)
+                        continue;
+                    expand(out, Range{childBegin, childEnd, range.depth + 1,
+                                      range.x + ((q & 1u) != 0 ? childHalf : -childHalf),
+                                      range.y + ((q & 2u) != 0 ? childHalf : -childHalf),
+                                      childHalf}, stopDepth, pending);
+                    childBegin = childEnd;
+                }
+            }
+        }
+        out[c].next = static_cast<std::uint32_t>(out.size());
+    }
+
+    //! Build top cells, then independent subtrees on the worker pool, and splice subtrees in pre-order.
+    void    splice(const Range& root, WorkerPool& pool)
+    {
+        expand(cells, root, splitDepth, &_pending);
+        _subtrees.resize(_pending.size());
+        pool.parallelFor(_pending.size(), [this](std::size_t begin, std::size_t end) {
+            for (auto p = begin; p < end; ++p) {
+                _subtrees[p].clear();
+                expand(_subtrees[p], _pending[p], maxDepth, nullptr);
+            }
+        });
+        // Top cell t is stored at offsets[t], a pending top cell is replaced by its whole subtree
+        const auto topCount = cells.size();
+        std::vector<std::uint32_t> offsets(topCount + 1, 1);
+        std::vector<std::size_t> subtreeOf(topCount, _pending.size());
+        for (std::size_t p = 0; p < _pending.size(); ++p) {
+            subtreeOf[_pending[p].cell] = p;
+            offsets[_pending[p].cell] = static_cast<std::uint32_t>(_subtrees[p].size());
+        }
+        std::uint32_t offset = 0;
+        for (auto& o : offsets) {
+            const auto slots = o;
+            o = offset;
+            offset += slots;
+        }
+        _spliced.resize(offsets[topCount]);
+        for (std::size_t t = 0; t < topCount; ++t)
+            if (subtreeOf[t] == _pending.size()) {
+                _spliced[offsets[t]] = cells[t];
+                _spliced[offsets[t]].next = offsets[cells[t].next];
+            }
+        pool.parallelFor(_pending.size(), [this, &offsets](std::size_t begin, std::size_t end) {
+            for (auto p = begin; p < end; ++p) {
+                const auto base = offsets[_pending[p].cell];
+                const auto& subtree = _subtrees[p];
+                for (std::size_t c = 0; c < subtree.size(); ++c) {
+                    _spliced[base + c] = subtree[c];
+                    _spliced[base + c].next += base;
+                }
+            }
+        });
+        cells.swap(_spliced);
+    }
+
+    //! Spread 16 low bits of v on even bits.
+    static std::uint32_t    interleave(std::uint32_t v) noexcept {
+        v &= 0x0000FFFFu;
+        v = (v | (v << 8)) & 0x00FF00FFu;
+        v = (v | (v << 4)) & 0x0F0F0F0Fu;
+        v = (v | (v << 2)) & 0x33333333u;
+        v = (v | (v << 1)) & 0x55555555u;
+        return v;
+    }
+
+    std::vector<std::uint32_t>  _codes;
+    std::vector<std::uint32_t>  _swap;
+    std::vector<std::uint32_t>  _sortedCodes;
+    std::vector<double>         _sumX;
+    std::vector<double>         _sumY;
+    std::vector<Range>          _pending;
+    std::vector<std::vector<Cell>>  _subtrees;
+    std::vector<Cell>           _spliced;
+};
+
+// Deterministic unit direction used to separate coincident nodes i and j.
+inline void     separationDirection(std::size_t i, std::size_t j, double& dx, double& dy) noexcept
+{
+    const auto angle = static_cast<double>((i * 7919u + j * 104729u) % 360u) * 3.14159265358979323846 / 180.;
+    dx = std::cos(angle);
+    dy = std::sin(angle);
+}
+
+} // ::qan::
+
+/* ForceDirectedLayout Object Management *///----------------------------------
+ForceDirectedLayout::ForceDirectedLayout(QObject* parent) noexcept :
+    QObject{parent}
+{
+}
+ForceDirectedLayout::~ForceDirectedLayout() { }
+
+bool    ForceDirectedLayout::setIterations(int iterations) noexcept
+{
+    iterations = std::max(0, iterations);
+    if (iterations != _iterations) {
+        _iterations = iterations;
+        emit iterationsChanged();
+        return true;
+    }
+    return false;
+}
+
+bool    ForceDirectedLayout::setConvergenceThreshold(qreal convergenceThreshold) noexcept
+{
+    if (convergenceThreshold >= 0. &&
+        !qFuzzyCompare(1. + convergenceThreshold, 1. + _convergenceThreshold)) {
+        _convergenceThreshold = convergenceThreshold;
+        emit convergenceThresholdChanged();
+        return true;
+    }
+    return false;
+}
+
+bool    ForceDirectedLayout::setSpringLength(qreal springLength) noexcept
+{
+    if (springLength > 0. &&
+        !qFuzzyCompare(1. + springLength, 1. + _springLength)) {
+        _springLength = springLength;
+        emit springLengthChanged();
+        return true;
+    }
+    return false;
+}
+
+bool    ForceDirectedLayout::setTheta(qreal theta) noexcept
+{
+    if (theta >= 0. &&
+        !qFuzzyCompare(1. + theta, 1. + _theta)) {
+        _theta = theta;
+        emit thetaChanged();
+        return true;
+    }
+    return false;
+}
+
+bool    ForceDirectedLayout::setGravity(qreal gravity) noexcept
+{
+    if (gravity >= 0. &&
+        !qFuzzyCompare(1. + gravity, 1. + _gravity)) {
+        _gravity = gravity;
+        emit gravityChanged();
+        return true;
+    }
+    return false;
+}
+
+bool    ForceDirectedLayout::setUseEdgeWeight(bool useEdgeWeight) noexcept
+{
+    if (useEdgeWeight != _useEdgeWeight) {
+        _useEdgeWeight = useEdgeWeight;
+        emit useEdgeWeightChanged();
+        return true;
+    }
+    return false;
+}
+
+bool    ForceDirectedLayout::setThreadCount(int threadCount) noexcept
+{
+    threadCount = std::max(0, threadCount);
+    if (threadCount != _threadCount) {
+        _threadCount = threadCount;
+        emit threadCountChanged();
+        return true;
+    }
+    return false;
+}
+//-----------------------------------------------------------------------------
+
+/* Layout Management *///------------------------------------------------------
+void    ForceDirectedLayout::layout(qan::Graph& graph) noexcept
+{
+    const auto containerItem = graph.getContainerItem();
+    if (containerItem == nullptr)
+        return;
+    // Collect nodes positions in graph container item CS (grouped nodes are children of their group container)
+    Input input;
+    std::vector<qan::Node*> nodes;
+    std::unordered_map<const qan::Node*, std::size_t> indexes;
+    std::unordered_map<const qan::Group*, std::size_t> containers;
+    for (const auto node : graph.get_nodes()) {
+        if (node == nullptr ||
+            node->isGroup() ||
+            node->getItem() == nullptr)
+            continue;
+        const auto item = node->getItem();
+        indexes.emplace(node, nodes.size());
+        nodes.push_back(node);
+        input.positions.push_back(item->mapToItem(containerItem, QPointF{0., 0.}));
+        input.sizes.emplace_back(item->width(), item->height());
+        input.pinned.push_back(node->getLocked());
+        auto containerIndex = noContainer;
+        const auto group = node->getGroup();
+        const auto groupItem = group != nullptr ? group->getGroupItem() : nullptr;
+        const auto groupContainer = groupItem != nullptr ? groupItem->getContainer() : nullptr;
+        if (groupContainer != nullptr) {
+            const auto container = containers.find(group);
+            if (container == containers.end()) {
+                containerIndex = input.containers.size();
+                containers.emplace(group, containerIndex);
+                input.containers.push_back(groupContainer->mapRectToItem(containerItem,
+                                                                         QRectF{0., 0., groupContainer->width(), groupContainer->height()}));
+            } else
+                containerIndex = container->second;
+        }
+        input.containerIndexes.push_back(containerIndex);
+    }
+    for (const auto edge : graph.get_edges()) {
+        if (edge == nullptr)
+            continue;
+        const auto src = indexes.find(edge->get_src());
+        const auto dst = indexes.find(edge->get_dst());
+        if (src == indexes.end() ||
+            dst == indexes.end())
+            continue;
+        input.edges.emplace_back(src->second, dst->second);
+        input.weights.push_back(_useEdgeWeight ? std::abs(edge->getWeight()) : 1.);
+    }
+
+    const auto positions = computeLayout(input);
+    if (positions.size() != nodes.size())
+        return;
+    for (std::size_t n = 0; n < nodes.size(); ++n) {
+        const auto item = nodes[n]->getItem();
+        const auto parentItem = item->parentItem();
+        item->setPosition(parentItem != nullptr && parentItem != containerItem ?
+                              containerItem->mapToItem(parentItem, positions[n]) : positions[n]);
+    }
+}
+
+void    ForceDirectedLayout::layoutGraph(qan::Graph* graph) noexcept
+{
+    if (graph != nullptr)
+        layout(*graph);
+}
+
+std::vector<QPointF>    ForceDirectedLayout::computeLayout(const Input& input, const Progress& progress)
+{
+    // PRECONDITIONS:
+        // input positions and sizes must have the same size
+    _iterationCount = 0;
+    _converged = false;
+    const auto count = input.positions.size();
+    if (count == 0 ||
+        input.sizes.size() != count) {
+        if (count != 0)
+            qWarning() << "qan::ForceDirectedLayout::computeLayout(): Error: Invalid input sizes count.";
+        return {};
+    }
+
+    // ALGORITHM:
+        // Work on node centers, build a CSR adjacency from edges (both directions).
+        // For each iteration:
+            // 1. Build a Barnes-Hut quadtree over current centers snapshot (subtrees built on the worker pool).
+            // 2. On the worker pool: compute each node displacement from snapshot (repulsion, springs, gravity).
+            // 3. On the worker pool: apply displacements limited by temperature, skip pinned nodes, clamp to containers.
+            // 4. Stop when maximum displacement is below convergence threshold.
+    std::vector<double> xs(count), ys(count), ws(count), hs(count);
+    for (std::size_t n = 0; n < count; ++n) {
+        ws[n] = std::max(0., input.sizes[n].width());
+        hs[n] = std::max(0., input.sizes[n].height());
+        xs[n] = input.positions[n].x() + ws[n] / 2.;
+        ys[n] = input.positions[n].y() + hs[n] / 2.;
+    }
+    const auto isPinned = [&input](std::size_t n) { return n < input.pinned.size() && input.pinned[n]; };
+    const auto containerOf = [&input](std::size_t n) -> const QRectF* {
+        if (n >= input.containerIndexes.size() ||
+            input.containerIndexes[n] >= input.containers.size())
+            return nullptr;
+        return &input.containers[input.containerIndexes[n]];
+    };
+
+    // CSR adjacency
+    std::vector<std::size_t> offsets(count + 1, 0);
+    for (const auto& [src, dst] : input.edges)
+        if (src < count && dst < count && src != dst) {
+            ++offsets[src + 1];
+            ++offsets[dst + 1];
+        }
+    for (std::size_t n = 0; n < count; ++n)
+        offsets[n + 1] += offsets[n];
+    std::vector<std::uint32_t> neighbours(offsets[count]);
+    std::vector<double> weights(offsets[count]);
+    {
+        auto fill = offsets;
+        for (std::size_t e = 0; e < input.edges.size(); ++e) {
+            const auto [src, dst] = input.edges[e];
+            if (src >= count || dst >= count || src == dst)
+                continue;
+            const auto weight = e < input.weights.size() ? input.weights[e] : 1.;
+            neighbours[fill[src]] = static_cast<std::uint32_t>(dst);
+            weights[fill[src]++] = weight;
+            neighbours[fill[dst]] = static_cast<std::uint32_t>(src);
+            weights[fill[dst]++] = weight;
+        }
+    }
+
+    const double k = _springLength;
+    const double k2 = k * k;
+    const double theta2 = _theta * _theta;
+    const double gravity = _gravity;
+    const double minDistance2 = 1e-4;
+    double extent = k * std::sqrt(static_cast<double>(count));
+    {
+        const auto [minX, maxX] = std::minmax_element(xs.begin(), xs.end());
+        const auto [minY, maxY] = std::minmax_element(ys.begin(), ys.end());
+        extent = std::max({extent, *maxX - *minX, *maxY - *minY});
+    }
+    const double initialTemperature = extent / 10.;
+
+    const auto threadCount = _threadCount > 0 ? static_cast<unsigned>(_threadCount) :
+                                                std::max(1u, std::thread::hardware_concurrency());
+    WorkerPool pool{count < 1024 ? 1u : threadCount};
+    QuadTree tree;
+    std::vector<double> dxs(count, 0.), dys(count, 0.);
+    double cx = 0., cy = 0.;
+
+    // Algorithm: bodies of a quadtree group share a single interaction list built from the group bounding
+    // box (a cell far enough from the whole box is far enough from every group body), then each body
+    // accumulate forces from the list cells centers of mass and from near leaves bodies.
+    const WorkerPool::Task computeDisplacements = [&](std::size_t begin, std::size_t end) {
+        const auto cells = tree.cells.data();
+        const auto cellCount = static_cast<std::uint32_t>(tree.cells.size());
+        const auto sortedXs = tree.sortedXs.data();
+        const auto sortedYs = tree.sortedYs.data();
+        std::vector<double> farXs, farYs, farMasses;
+        std::vector<double> nearXs, nearYs;
+        std::vector<std::uint32_t> nearBodies;
+        for (auto g = begin; g < end; ++g) {
+            const auto& group = cells[tree.groups[g]];
+            auto minX = sortedXs[group.begin], maxX = minX;
+            auto minY = sortedYs[group.begin], maxY = minY;
+            for (auto o = group.begin + 1; o < group.end; ++o) {
+                minX = std::min(minX, sortedXs[o]);
+                maxX = std::max(maxX, sortedXs[o]);
+                minY = std::min(minY, sortedYs[o]);
+                maxY = std::max(maxY, sortedYs[o]);
+            }
+            // Pre-order scan skip far or leaf subtrees
+            farXs.clear();
+            farYs.clear();
+            farMasses.clear();
+            nearXs.clear();
+            nearYs.clear();
+            nearBodies.clear();
+            for (std::uint32_t c = 0; c < cellCount; ) {
+                const auto& cell = cells[c];
+                const double dx = std::max({minX - cell.mx, cell.mx - maxX, 0.});
+                const double dy = std::max({minY - cell.my, cell.my - maxY, 0.});
+                if (cell.size2 < theta2 * (dx * dx + dy * dy)) {  // Far enough, use cell center of mass
+                    farXs.push_back(cell.mx);
+                    farYs.push_back(cell.my);
+                    farMasses.push_back(cell.mass);
+                } else if (cell.next == c + 1) {    // Near leaf, bodies interact directly
+                    nearXs.insert(nearXs.end(), sortedXs + cell.begin, sortedXs + cell.end);
+                    nearYs.insert(nearYs.end(), sortedYs + cell.begin, sortedYs + cell.end);
+                    for (auto ob = cell.begin; ob < cell.end; ++ob)
+                        nearBodies.push_back(ob);
+                } else {
+                    ++c;                            // Open cell: visit its children
+                    continue;
+                }
+                c = cell.next;
+            }
+
+            for (auto o = group.begin; o < group.end; ++o) {    // Iterate in Morton order for cache coherency
+                const std::size_t i = tree.order[o];
+                const double x = sortedXs[o];
+                const double y = sortedYs[o];
+                double fx = 0., fy = 0.;
+                // Repulsion: f = k² / d, far cells are outside group box (d > 0)
+                for (std::size_t f = 0; f < farMasses.size(); ++f) {
+                    const double dx = x - farXs[f];
+                    const double dy = y - farYs[f];
+                    const double s = farMasses[f] * k2 / (dx * dx + dy * dy);
+                    fx += dx * s;
+                    fy += dy * s;
+                }
+                for (std::size_t n = 0; n < nearBodies.size(); ++n) {
+                    if (nearBodies[n] == o)
+                        continue;
+                    double dx = x - nearXs[n];
+                    double dy = y - nearYs[n];
+                    double d2 = dx * dx + dy * dy;
+                    if (d2 < minDistance2) {    // Push coincident bodies in a deterministic direction
+                        separationDirection(i, tree.order[nearBodies[n]], dx, dy);
+                        dx *= 0.01;
+                        dy *= 0.01;
+                        d2 = minDistance2;
+                    }
+                    const double s = k2 / d2;
+                    fx += dx * s;
+                    fy += dy * s;
+                }
+                dxs[i] = fx;
+                dys[i] = fy;
+            }
+        }
+    };
+    // Note: attraction is computed in nodes order, adjacency is then read sequentially.
+    const WorkerPool::Task addAttraction = [&](std::size_t begin, std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+            const double x = xs[i];
+            const double y = ys[i];
+            double fx = gravity * (cx - x);
+            double fy = gravity * (cy - y);
+            // Attraction: f = weight * d² / k along edges
+            for (auto e = offsets[i]; e < offsets[i + 1]; ++e) {
+                const auto j = neighbours[e];
+                const double dx = xs[j] - x;
+                const double dy = ys[j] - y;
+                const double d = std::sqrt(dx * dx + dy * dy);
+                fx += weights[e] * dx * d / k;
+                fy += weights[e] * dy * d / k;
+            }
+            dxs[i] += fx;
+            dys[i] += fy;
+        }
+    };
+
+    const auto iterations = _iterations;
+    const double convergenceDistance = _convergenceThreshold * k;
+    for (int iteration = 0; iteration < iterations; ++iteration) {
+        tree.build(xs, ys, pool);
+        cx = tree.cells[0].mx;
+        cy = tree.cells[0].my;
+        pool.parallelFor(tree.groups.size(), computeDisplacements);
+        pool.parallelFor(count, addAttraction);
+
+        const double temperature = initialTemperature * (1. - static_cast<double>(iteration) / iterations);
+        double maxMove = 0.;
+        std::mutex maxMoveMutex;
+        pool.parallelFor(count, [&](std::size_t begin, std::size_t end) {
+            double chunkMaxMove = 0.;
+            for (auto n = begin; n < end; ++n) {
+                if (isPinned(n))
+                    continue;
+                const double d = std::sqrt(dxs[n] * dxs[n] + dys[n] * dys[n]);
+                if (d <= 0.)
+                    continue;
+                const double move = std::min(d, temperature);
+                auto x = xs[n] + dxs[n] / d * move;
+                auto y = ys[n] + dys[n] / d * move;
+                if (const auto container = containerOf(n)) {   // Keep node inside its container
+                    const auto clamp = [](double v, double min, double max) {
+                        return min <= max ? std::clamp(v, min, max) : (min + max) / 2.;
+                    };
+                    x = clamp(x, container->left() + ws[n] / 2., container->right() - ws[n] / 2.);
+                    y = clamp(y, container->top() + hs[n] / 2., container->bottom() - hs[n] / 2.);
+                }
+                chunkMaxMove = std::max(chunkMaxMove, std::abs(x - xs[n]) + std::abs(y - ys[n]));
+                xs[n] = x;
+                ys[n] = y;
+            }
+            std::lock_guard<std::mutex> lock{maxMoveMutex};
+            maxMove = std::max(maxMove, chunkMaxMove);
+        });
+        _iterationCount = iteration + 1;
+        if (maxMove < convergenceDistance) {
+            _converged = true;
+            break;
+        }
+        if (progress &&
+            !progress(static_cast<qreal>(_iterationCount) / iterations))
+            return {};
+    }
+
+    std::vector<QPointF> positions;
+    positions.reserve(count);
+    for (std::size_t n = 0; n < count; ++n)
+        positions.emplace_back(xs[n] - ws[n] / 2., ys[n] - hs[n] / 2.);
+    return positions;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
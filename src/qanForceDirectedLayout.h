@@ -0,0 +1,214 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanForceDirectedLayout.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// Qt headers
+#include <QObject>
+#include <QPointF>
+#include <QRectF>
+#include <QSizeF>
+#include <QtQml>
+
+// QuickQanava headers
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/*! \brief Force directed (Fruchterman-Reingold) layout with Barnes-Hut repulsion for large networks.
+ *
+ * Each iteration build a Barnes-Hut quadtree over a snapshot of node centers, then forces are
+ * computed in parallel on a worker pool: quadtree approximated repulsion, spring attraction
+ * along edges (optionally scaled by edge weight) and a weak gravity toward centroid. Displacements
+ * are applied once all forces have been computed, result does not depend on thread count.
+ *
+ * Node displacement is limited by a linearly decreasing temperature, layout stop after \c iterations
+ * or when the maximum displacement during an iteration fall below \c convergenceThreshold.
+ *
+ * Locked nodes are pinned, groups are not moved and grouped nodes are constrained inside their group.
+ *
+ * Performances: quadtree Morton codes, subtrees cells, forces and displacements are computed on the
+ * worker pool, quadtree radix sort and center of mass prefix sums are serial. Groups of up to 32 close
+ * nodes share a single Barnes-Hut interaction list, attraction is computed in nodes order.
+ * Measured on \c quickqanava_benchmarks input (random tree, 100k nodes, 300 iterations, not converged)
+ * on a single core: 16 to 29 s depending on host load, forces being about 87% of the time. Timing on
+ * 8 cores has not been measured.
+ *
+ * \nosubgrouping
+ */
+class ForceDirectedLayout : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    /*! \name ForceDirectedLayout Object Management *///-----------------------
+    //@{
+public:
+    explicit ForceDirectedLayout(QObject* parent = nullptr) noexcept;
+    virtual ~ForceDirectedLayout() override;
+    ForceDirectedLayout(const ForceDirectedLayout&) = delete;
+    ForceDirectedLayout& operator=(const ForceDirectedLayout&) = delete;
+    ForceDirectedLayout(ForceDirectedLayout&&) = delete;
+    ForceDirectedLayout& operator=(ForceDirectedLayout&&) = delete;
+
+public:
+    //! Maximum number of iterations (default to 300).
+    Q_PROPERTY(int iterations READ getIterations WRITE setIterations NOTIFY iterationsChanged FINAL)
+    bool            setIterations(int iterations) noexcept;
+    int             getIterations() const noexcept { return _iterations; }
+protected:
+    int             _iterations = 300;
+signals:
+    void            iterationsChanged();
+
+public:
+    //! Stop when maximum node displacement during an iteration is below \c convergenceThreshold * \c springLength (default to 0.01).
+    Q_PROPERTY(qreal convergenceThreshold READ getConvergenceThreshold WRITE setConvergenceThreshold NOTIFY convergenceThresholdChanged FINAL)
+    bool            setConvergenceThreshold(qreal convergenceThreshold) noexcept;
+    qreal           getConvergenceThreshold() const noexcept { return _convergenceThreshold; }
+protected:
+    qreal           _convergenceThreshold = 0.01;
+signals:
+    void            convergenceThresholdChanged();
+
+public:
+    //! Ideal distance between two connected node centers (default to 100.).
+    Q_PROPERTY(qreal springLength READ getSpringLength WRITE setSpringLength NOTIFY springLengthChanged FINAL)
+    bool            setSpringLength(qreal springLength) noexcept;
+    qreal           getSpringLength() const noexcept { return _springLength; }
+protected:
+    qreal           _springLength = 100.;
+signals:
+    void            springLengthChanged();
+
+public:
+    //! Barnes-Hut opening criterion, 0. for exact (quadratic) repulsion, higher is faster and less accurate (default to 1.2).
+    Q_PROPERTY(qreal theta READ getTheta WRITE setTheta NOTIFY thetaChanged FINAL)
+    bool            setTheta(qreal theta) noexcept;
+    qreal           getTheta() const noexcept { return _theta; }
+protected:
+    qreal           _theta = 1.2;
+signals:
+    void            thetaChanged();
+
+public:
+    //! Attraction toward nodes centroid, keep disconnected components together (default to 0.01, 0. to disable).
+    Q_PROPERTY(qreal gravity READ getGravity WRITE setGravity NOTIFY gravityChanged FINAL)
+    bool            setGravity(qreal gravity) noexcept;
+    qreal           getGravity() const noexcept { return _gravity; }
+protected:
+    qreal           _gravity = 0.01;
+signals:
+    void            gravityChanged();
+
+public:
+    //! Scale edges spring stiffness with qan::Edge::weight absolute value (default to false).
+    Q_PROPERTY(bool useEdgeWeight READ getUseEdgeWeight WRITE setUseEdgeWeight NOTIFY useEdgeWeightChanged FINAL)
+    bool            setUseEdgeWeight(bool useEdgeWeight) noexcept;
+    bool            getUseEdgeWeight() const noexcept { return _useEdgeWeight; }
+protected:
+    bool            _useEdgeWeight = false;
+signals:
+    void            useEdgeWeightChanged();
+
+public:
+    //! Worker pool thread count, 0 to use hardware concurrency (default to 0).
+    Q_PROPERTY(int threadCount READ getThreadCount WRITE setThreadCount NOTIFY threadCountChanged FINAL)
+    bool            setThreadCount(int threadCount) noexcept;
+    int             getThreadCount() const noexcept { return _threadCount; }
+protected:
+    int             _threadCount = 0;
+signals:
+    void            threadCountChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Layout Management *///-------------------------------------------
+    //@{
+public:
+    //! Apply a force directed layout to all \c graph nodes (groups are not moved).
+    void                layout(qan::Graph& graph) noexcept;
+
+    //! QML invokable version of layout().
+    Q_INVOKABLE void    layoutGraph(qan::Graph* graph) noexcept;
+
+public:
+    static constexpr std::size_t    noContainer = std::numeric_limits<std::size_t>::max();
+
+    //! Topology only layout input, all per node vectors are indexed by node and except \c positions and \c sizes might be empty.
+    struct Input {
+        //! Nodes initial top left positions.
+        std::vector<QPointF>    positions;
+        std::vector<QSizeF>     sizes;
+        std::vector<std::pair<std::size_t, std::size_t>>    edges;
+        //! Edges spring stiffness factor (default to 1.).
+        std::vector<qreal>      weights;
+        //! Pinned nodes are never moved.
+        std::vector<bool>       pinned;
+        //! Containers rects, nodes with a container are kept inside their container rect.
+        std::vector<QRectF>     containers;
+        //! Node container index in \c containers or \c noContainer.
+        std::vector<std::size_t> containerIndexes;
+    };
+
+    //! Progress callback called with a [0, 1] progress, layout is cancelled if it return false.
+    using Progress = std::function<bool(qreal)>;
+
+    /*! \brief Compute nodes top left position for \c input, edges referencing an invalid node and self loops are ignored.
+     *
+     * \c progress is called after each iteration (from caller thread), an empty result is returned
+     * when cancelled.
+     */
+    std::vector<QPointF>    computeLayout(const Input& input, const Progress& progress = {});
+
+    //! Count of iterations run during the last layout.
+    int             getIterationCount() const noexcept { return _iterationCount; }
+    //! True if the last layout stopped on \c convergenceThreshold before reaching \c iterations.
+    bool            getConverged() const noexcept { return _converged; }
+private:
+    int             _iterationCount = 0;
+    bool            _converged = false;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::ForceDirectedLayout)
@@ -33,13 +33,20 @@
 //-----------------------------------------------------------------------------
 
 // Std headers
+#include <algorithm>
 #include <memory>
+#include <unordered_set>
 
 // Qt headers
 #include <QQmlProperty>
 #include <QVariant>
 #include <QQmlEngine>
 #include <QQmlComponent>
+#include <QQmlIncubator>
+#include <QQuickWindow>
+#if defined(QUICKQANAVA_SCENEGRAPH_CULLING)
+#include <QtQuick/private/qquickitem_p.h>  // QQuickItemPrivate::setCulled()
+#endif
 
 // QuickQanava headers
 #include "./qanUtils.h"
@@ -52,14 +59,24 @@
 #include "./qanGroup.h"
 #include "./qanGroupItem.h"
 #include "./qanConnector.h"
+#include "./qanNativeNodeItem.h"
+#include "./qanNativeEdgeItem.h"
 
 namespace qan { // ::qan
 
+//! Selection overlay is always drawn on top of container items.
+static constexpr qreal selectionOverlayZ = 1e9;
+//! Batched edges under all root groups are drawn under all container items (see qan::EdgeBatchRenderer layers).
+static constexpr qreal edgeBatchRendererZ = -1e9;
+
 /* Graph Object Management *///------------------------------------------------
 Graph::Graph(QQuickItem* parent) noexcept :
     super_t{parent}
 {
     setContainerItem(this);
+    _selectionOverlay = new qan::SelectionOverlay{getContainerItem()};
+    _selectionOverlay->setZ(selectionOverlayZ);
+    _selectionOverlay->setGraph(this);
     setAntialiasing(true);
     setSmooth(true);
     // Note: do not accept mouse buttons, mouse events are captured in
@@ -76,6 +93,15 @@ Graph::~Graph()
         node->disconnect(node, 0, 0, 0);
     for (const auto edge: get_edges())
         edge->disconnect(edge, 0, 0, 0);
+    for (const auto item: _spatialIndex.getItems())  // Items might be destroyed after _spatialIndex
+        disconnect(item, nullptr, this, nullptr);
+    _spatialIndex.clear();
+    _incubators.clear();    // Abort incubations in progress
+    const auto engine = qmlEngine(this);
+    if (engine != nullptr &&
+        _incubationController &&
+        engine->incubationController() == _incubationController.get())
+        engine->setIncubationController(nullptr);
 }
 
 void    Graph::classBegin()
@@ -87,7 +113,7 @@ void    Graph::classBegin()
     // Note: Do not set a default node delegate, otherwise it would be used instead
     //  of qan::Node::delegate(), just let the user specify one.
     setEdgeDelegate(createComponent(QStringLiteral("qrc:/QuickQanava/Edge.qml")));
-    setSelectionDelegate(createComponent(QStringLiteral("qrc:/QuickQanava/SelectionItem.qml")));
+    setSelectionDelegate(std::unique_ptr<QQmlComponent>{});  // Default selection delegate
 
     const auto engine = qmlEngine(this);
     if (engine != nullptr) {
@@ -148,6 +174,13 @@ void    Graph::setContainerItem(QQuickItem* containerItem)
     if (containerItem != nullptr &&
         containerItem != _containerItem.data()) {
         _containerItem = containerItem;
+        if (_selectionOverlay)
+            _selectionOverlay->setParentItem(containerItem);
+        if (_edgeBatchRenderer) {
+            _edgeBatchRenderer->setParentItem(containerItem);
+            _edgeBatchRenderer->requestUpdate();    // Items are collected in container CS
+        }
+        rebuildSpatialIndex();
         emit containerItemChanged();
     }
 }
@@ -164,67 +197,75 @@ void    Graph::clear() noexcept
     _selectedNodes.clear();
     _selectedGroups.clear();
     _selectedEdges.clear();
+    if (_delegatePooling) {
+        // Algorithm: Pool items before topology is cleared (and items destroyed with their primitives):
+            // 1. Edges items.
+            // 2. Nodes items, including grouped nodes, so that groups items are empty.
+            // 3. Groups items.
+        for (const auto edge : get_edges())                     // 1.
+            if (edge != nullptr)
+                poolEdgeItem(*edge);
+        for (const auto node : get_nodes())                     // 2.
+            if (node != nullptr &&
+                !node->isGroup())
+                poolNodeItem(*node);
+        for (bool pooled = true; pooled; ) {                    // 3. Nested groups are pooled once their sub groups are
+            pooled = false;
+            for (const auto node : get_nodes())
+                if (node != nullptr &&
+                    node->isGroup() &&
+                    node->getItem() != nullptr)
+                    pooled |= poolNodeItem(*node);
+        }
+    }
     super_t::clear();
+    _spatialIndex.clear();
+    _culledItems.clear();
+    _unculledItems.clear();
+    _cullingHiddenItems.clear();
+    _delegatePool.purge();  // Note: pool is indexed by components and styles, drop items of destroyed ones
+    clearIncubators();
     _styleManager.clear();
+    if (_selectionOverlay)
+        _selectionOverlay->requestUpdate();
+    if (_edgeBatchRenderer)
+        _edgeBatchRenderer->requestUpdate();
 }
 
 QQuickItem* Graph::graphChildAt(qreal x, qreal y) const
 {
     if (getContainerItem() == nullptr)
         return nullptr;
-    const auto childrens = getContainerItem()->childItems();
-    for (int i = childrens.count() - 1; i >= 0; --i) {
-        QQuickItem* child = childrens.at(i);
-        const QPointF point = mapToItem(child, QPointF{x, y});  // Map coordinates to the child element's coordinate space
-        if (child != nullptr &&
-            child->isVisible() &&
-            child->contains(point) &&    // Note 20160508: childAt do not call contains()
-            point.x() > -0.0001 &&
-            child->width() > point.x() &&
-            point.y() > -0.0001 &&
-            child->height() > point.y()) {
-            if (child->inherits("qan::TableGroupItem")) {
-                const auto tableGroupItem = static_cast<qan::TableGroupItem*>(child);
-                if (tableGroupItem != nullptr) {
-                    for (const auto cell: tableGroupItem->getCells()) {
-                        const auto point = mapToItem(cell, QPointF(x, y)); // Map coordinates to group child element's coordinate space
-                        if (cell->isVisible() &&
-                            cell->contains(point) &&
-                            point.x() > -0.0001 &&
-                            cell->width() > point.x() &&
-                            point.y() > -0.0001 &&
-                            cell->height() > point.y()) {
-                            QQmlEngine::setObjectOwnership(cell->getItem(), QQmlEngine::CppOwnership);
-                            return cell->getItem();
-                        }
-                    }
-                }
-            }
-            if (child->inherits("qan::GroupItem")) {  // For group, look in group childs
-                const auto groupItem = qobject_cast<qan::GroupItem*>(child);
-                if (groupItem != nullptr &&
-                    groupItem->getContainer() != nullptr) {
-                    const QList<QQuickItem *> groupChildren = groupItem->getContainer()->childItems();
-                    for (int gc = groupChildren.count() - 1; gc >= 0; --gc) {
-                        QQuickItem* groupChild = groupChildren.at(gc);
-                        const auto point = mapToItem(groupChild, QPointF(x, y)); // Map coordinates to group child element's coordinate space
-                        if (groupChild->isVisible() &&
-                            groupChild->contains(point) &&
-                            point.x() > -0.0001 &&
-                            groupChild->width() > point.x() &&
-                            point.y() > -0.0001 &&
-                            groupChild->height() > point.y()) {
-                            QQmlEngine::setObjectOwnership(groupChild, QQmlEngine::CppOwnership);
-                            return groupChild;
-                        }
-                    }
-                }
-            }
-            QQmlEngine::setObjectOwnership(child, QQmlEngine::CppOwnership);
-            return child;
+
+    // Algorithm:
+        // 1. Query spatial index for items whose bounding rect contains (x, y).
+        // 2. Filter invisible items and items that do not contains() point (ie edges).
+        // 3. Return the top most item: a group child is always returned before it's group,
+        //    otherwise the item with maximum global z is returned.
+    const auto p = mapToItem(getContainerItem(), QPointF{x, y});    // Note: Spatial index is expressed in container CS
+    QQuickItem* topItem = nullptr;
+    qreal topItemZ = 0.;
+    // 1.
+    for (const auto item : _spatialIndex.itemsAt(p)) {
+        // 2.
+        if (item == nullptr ||
+            !item->isVisible())
+            continue;
+        const auto itemPoint = getContainerItem()->mapToItem(item, p);
+        if (!item->contains(itemPoint))     // Note 20160508: childAt do not call contains()
+            continue;
+        // 3.
+        const auto itemZ = qan::getItemGlobalZ_rec(item);
+        if (topItem == nullptr ||
+            topItem->isAncestorOf(item) ||
+            (!item->isAncestorOf(topItem) && itemZ > topItemZ)) {
+            topItem = item;
+            topItemZ = itemZ;
         }
     }
-    return nullptr;
+    if (topItem != nullptr)
+        QQmlEngine::setObjectOwnership(topItem, QQmlEngine::CppOwnership);
+    return topItem;
 }
 
 qan::Group* Graph::groupAt(const QPointF& p, const QSizeF& s, const QQuickItem* except) const
@@ -234,58 +275,334 @@ qan::Group* Graph::groupAt(const QPointF& p, const QSizeF& s, const QQuickItem*
         // except can be nullptr
     if (!s.isValid())
         return nullptr;
+    if (getContainerItem() == nullptr)
+        return nullptr;
 
     // Algorithm:
-        // 1. Copy internal group list
-        // 2. Order the container of group from maximum to minimum z
-        // 3. Return the first group containing rect(p,s)
+        // 1. Collect groups whose indexed container rect contains p (any group containing rect(p,s) contains p).
+        // 2. Return the candidate with maximum global z containing rect(p,s), using cached
+        //    groups global z ordering (no sorting, no recursive global z computation).
+    updateGroupsZOrder();
+    qan::GroupItem* topGroupItem = nullptr;
+    int topGroupRank = -1;
+    for (const auto item : _spatialIndex.itemsAt(p)) {    // 1.
+        if (item == nullptr ||
+            item == except)
+            continue;
+        const auto groupItem = qobject_cast<qan::GroupItem*>(item);
+        if (groupItem == nullptr ||
+            groupItem->getGroup() == nullptr)
+            continue;
+        if (groupItem->getCollapsed())
+            continue;  // Do not return collapsed groups
+        const auto groupRank = getGroupZRank(groupItem);  // 2.
+        if (topGroupItem != nullptr &&
+            groupRank <= topGroupRank)
+            continue;
+        const auto groupRect = _spatialIndex.getRect(groupItem);
+        const auto targetSize = groupItem->getStrictDrop() ? s :            // In non-strict mode (ie for TableGroup) target has not
+                                                             QSizeF{1,1};   // to be fully contained by group to trigger a drop.
+        if (groupRect.contains(QRectF{p, targetSize})) {
+            topGroupItem = groupItem;
+            topGroupRank = groupRank;
+        }
+    } // for all candidate groups
+    if (topGroupItem == nullptr)
+        return nullptr;
+    const auto group = topGroupItem->getGroup();
+    QQmlEngine::setObjectOwnership(group, QQmlEngine::CppOwnership);
+    return group;
+}
 
-    // 1.
-    std::vector<qan::Group*> groups;
-    groups.reserve(static_cast<unsigned int>(get_groups().size()));
-    for (const auto group : qAsConst(get_groups().getContainer())) {
-        if (group != nullptr)
-            groups.push_back(group);
+QList<QQuickItem*>  Graph::itemsInRect(const QRectF& rect) const
+{
+    QList<QQuickItem*> items;
+    for (const auto item : _spatialIndex.itemsIntersecting(rect)) {
+        if (item != nullptr &&
+            item->isVisible()) {
+            QQmlEngine::setObjectOwnership(item, QQmlEngine::CppOwnership);
+            items.append(item);
+        }
     }
+    return items;
+}
 
-    // 2.
-    std::sort(groups.begin(), groups.end(), [](const auto g1, const auto g2) -> bool {
-        if (g1 == nullptr || g2 == nullptr)
-            return false;
-        const auto g1Item = g1->getItem();
-        const auto g2Item = g2->getItem();
-        if (g1Item == nullptr ||
-            g2Item == nullptr)
-            return false;
-        const auto g1GlobalZ = qan::getItemGlobalZ_rec(g1Item);
-        const auto g2GlobalZ = qan::getItemGlobalZ_rec(g2Item);
-        return g1GlobalZ > g2GlobalZ;
+void    Graph::updateSpatialIndex(QQuickItem* item)
+{
+    if (item == nullptr ||
+        getContainerItem() == nullptr)
+        return;
+    const auto itemRect = item->mapRectToItem(getContainerItem(),
+                                              QRectF{0., 0., item->width(), item->height()});
+    _spatialIndex.insert(item, itemRect);
+    if (_viewportCulling)
+        updateItemCulling(item, itemRect);
+    if (_edgeBatchRenderer &&
+        _lod == qan::NodeItem::Lod::Minimal)    // Minimal lod nodes and groups are drawn by batch renderer
+        _edgeBatchRenderer->requestItemUpdate(item);
+    if (_selectionOverlay &&
+        isSelectionOverlayActive()) {
+        const auto nodeItem = qobject_cast<qan::NodeItem*>(item);
+        if (nodeItem != nullptr &&
+            nodeItem->getSelected())
+            _selectionOverlay->requestUpdate();
+    }
+
+    // Grouped nodes position is expressed in their group CS, update group content
+    // rects when the group move.
+    const auto groupItem = qobject_cast<qan::GroupItem*>(item);
+    if (groupItem != nullptr &&
+        groupItem->getGroup() != nullptr) {
+        for (const auto node : groupItem->getGroup()->get_nodes()) {
+            if (node != nullptr &&
+                node->getItem() != nullptr &&
+                _spatialIndex.contains(node->getItem()))
+                updateSpatialIndex(node->getItem());
+        }
+    }
+}
+
+void    Graph::registerSpatialItem(QQuickItem* item)
+{
+    if (item == nullptr)
+        return;
+    const auto update = [this, item]() { updateSpatialIndex(item); };
+    connect(item, &QQuickItem::xChanged,        this, update);
+    connect(item, &QQuickItem::yChanged,        this, update);
+    connect(item, &QQuickItem::widthChanged,    this, update);
+    connect(item, &QQuickItem::heightChanged,   this, update);
+    // Note: item is never dereferenced in index, it is just used as a key
+    connect(item, &QObject::destroyed,          this, [this, item]() {
+        _spatialIndex.remove(item);
+        _culledItems.erase(item);
+        _unculledItems.erase(item);
+        _cullingHiddenItems.erase(item);
+        // Note: Batch renderer monitor its collected items destruction
     });
+    updateSpatialIndex(item);
+}
 
-    // 3.
-    if (getContainerItem() == nullptr)
-            return nullptr;
-    for (const auto group : qAsConst(groups)) {
-        if (group &&
-            group->getItem() != nullptr &&
-            group->getItem() != except) {
-            const auto groupItem = group->getGroupItem();
-            if (groupItem == nullptr)
-                continue;
-            if (groupItem->getCollapsed())
-                continue;  // Do not return collapsed groups
-
-            const auto groupRect =  QRectF{groupItem->mapToItem(getContainerItem(), QPointF{0., 0.}),
-                                           QSizeF{groupItem->width(), groupItem->height()}};
-            const auto targetSize = groupItem->getStrictDrop() ? s :            // In non-strict mode (ie for TableGroup) target has not
-                                                                 QSizeF{1,1};   // to be fully contained by group to trigger a drop.
-            if (groupRect.contains(QRectF{p, targetSize})) {
-                QQmlEngine::setObjectOwnership(group, QQmlEngine::CppOwnership);
-                return group;
-            }
+void    Graph::rebuildSpatialIndex()
+{
+    _spatialIndex.clear();
+    for (const auto node : get_nodes())     // Note: groups are nodes
+        if (node != nullptr &&
+            node->getItem() != nullptr)
+            updateSpatialIndex(node->getItem());
+    for (const auto edge : get_edges())
+        if (edge != nullptr &&
+            edge->getItem() != nullptr)
+            updateSpatialIndex(edge->getItem());
+}
+//-----------------------------------------------------------------------------
+
+/* Viewport Culling Management *///--------------------------------------------
+bool    Graph::setViewportCulling(bool viewportCulling) noexcept
+{
+    if (viewportCulling == _viewportCulling)
+        return false;
+    _viewportCulling = viewportCulling;
+    if (_viewportCulling) {
+        // Note: All items are initially rendered, last culling pass "unculled" set is the whole graph
+        _unculledItems.clear();
+        for (const auto item : _spatialIndex.getItems())
+            _unculledItems.insert(item);
+        updateCulling();
+    } else
+        uncullAll();
+    emit viewportCullingChanged();
+    return true;
+}
+
+void    Graph::setCullingRect(const QRectF& cullingRect) noexcept
+{
+    if (cullingRect == _cullingRect)
+        return;
+    _cullingRect = cullingRect;
+    if (!_viewportCulling)
+        return;
+    _cullingDirty = true;
+    if (window() != nullptr)
+        polish();
+    else
+        updateCulling();
+}
+
+void    Graph::updateCulling()
+{
+    _cullingDirty = false;
+    if (!_viewportCulling ||
+        !_cullingRect.isValid())    // Wait for a valid culling rect (ie view not yet layouted)
+        return;
+
+    // Algorithm:
+        // 1. Query items intersecting culling rect in spatial index: cost is proportional to visible items.
+        // 2. Cull items that were inside culling rect during last update and are now outside.
+        // 3. Uncull items inside culling rect.
+    const auto items = _spatialIndex.itemsIntersecting(_cullingRect);      // 1.
+    std::unordered_set<QQuickItem*> unculledItems{items.cbegin(), items.cend()};
+    for (const auto item : _unculledItems)                                  // 2.
+        if (unculledItems.find(item) == unculledItems.end())
+            cullItem(item);
+    for (const auto item : items)                                           // 3.
+        uncullItem(item);
+    _unculledItems.swap(unculledItems);
+}
+
+void    Graph::updateItemCulling(QQuickItem* item, const QRectF& rect)
+{
+    if (item == nullptr ||
+        !_viewportCulling ||
+        !_cullingRect.isValid())
+        return;
+    if (rect.intersects(_cullingRect)) {
+        uncullItem(item);
+        _unculledItems.insert(item);
+    } else if (_unculledItems.find(item) == _unculledItems.end())
+        cullItem(item);     // Note: Items leaving culling rect (ie dragged items) are culled on next updateCulling()
+}
+
+void    Graph::uncullAll()
+{
+    const auto culledItems = std::move(_culledItems);
+    _culledItems.clear();
+    for (const auto item : culledItems)
+        if (item != nullptr) {
+            setItemCulled(item, false);
+            if (_edgeBatchRenderer)
+                _edgeBatchRenderer->requestItemUpdate(item);
         }
-    } // for all groups
-    return nullptr;
+    _unculledItems.clear();
+    _cullingDirty = false;
+}
+
+void    Graph::cullItem(QQuickItem* item)
+{
+    if (item == nullptr ||
+        !_culledItems.insert(item).second)
+        return;
+    setItemCulled(item, true);
+    if (_edgeBatchRenderer)     // Batch renderer skip culled edges (and nodes in minimal lod)
+        _edgeBatchRenderer->requestItemUpdate(item);
+}
+
+void    Graph::uncullItem(QQuickItem* item)
+{
+    if (item == nullptr ||
+        _culledItems.erase(item) == 0)
+        return;
+    setItemCulled(item, false);
+    if (_edgeBatchRenderer)
+        _edgeBatchRenderer->requestItemUpdate(item);
+}
+
+void    Graph::forgetCulledItem(QQuickItem* item)
+{
+    // Note: Pooled items might be reused for another node or edge, they must not stay culled.
+    if (item != nullptr &&
+        _culledItems.erase(item) > 0)
+        setItemCulled(item, false);
+    _unculledItems.erase(item);
+}
+
+void    Graph::setItemCulled(QQuickItem* item, bool culled)
+{
+#if defined(QUICKQANAVA_SCENEGRAPH_CULLING)
+    // Note: Culling use Qt Quick scene graph culling (like views delegates outside viewport),
+    // item visible property is never modified: visibility remain user defined.
+    QQuickItemPrivate::get(item)->setCulled(culled);
+#else
+    // Note: Without Qt Quick private module, culled items are hidden, only items hidden by culling
+    // are shown again once unculled.
+    if (culled) {
+        if (item->isVisible()) {
+            _cullingHiddenItems.insert(item);
+            item->setVisible(false);
+        }
+    } else if (_cullingHiddenItems.erase(item) > 0)
+        item->setVisible(true);
+#endif
+}
+//-----------------------------------------------------------------------------
+
+/* Level of Detail Management *///---------------------------------------------
+bool    Graph::setLevelOfDetail(bool levelOfDetail) noexcept
+{
+    if (levelOfDetail == _levelOfDetail)
+        return false;
+    _levelOfDetail = levelOfDetail;
+    updateLod();
+    emit levelOfDetailChanged();
+    return true;
+}
+
+bool    Graph::setSimplifiedLodZoom(qreal simplifiedLodZoom) noexcept
+{
+    if (qFuzzyCompare(1. + simplifiedLodZoom, 1. + _simplifiedLodZoom))
+        return false;
+    _simplifiedLodZoom = simplifiedLodZoom;
+    updateLod();
+    emit simplifiedLodZoomChanged();
+    return true;
+}
+
+bool    Graph::setMinimalLodZoom(qreal minimalLodZoom) noexcept
+{
+    if (qFuzzyCompare(1. + minimalLodZoom, 1. + _minimalLodZoom))
+        return false;
+    _minimalLodZoom = minimalLodZoom;
+    updateLod();
+    emit minimalLodZoomChanged();
+    return true;
+}
+
+bool    Graph::setLodHysteresis(qreal lodHysteresis) noexcept
+{
+    lodHysteresis = std::max(0., lodHysteresis);
+    if (qFuzzyCompare(1. + lodHysteresis, 1. + _lodHysteresis))
+        return false;
+    _lodHysteresis = lodHysteresis;
+    emit lodHysteresisChanged();
+    return true;
+}
+
+void    Graph::setLodZoom(qreal lodZoom) noexcept
+{
+    _lodZoom = lodZoom;
+    updateLod();
+}
+
+qan::NodeItem::Lod  Graph::lodForZoom(qan::NodeItem::Lod lod, qreal zoom,
+                                      qreal simplifiedLodZoom, qreal minimalLodZoom, qreal lodHysteresis) noexcept
+{
+    // Thresholds are raised by hysteresis when leaving a coarser level for a finer one
+    using Lod = qan::NodeItem::Lod;
+    const auto h = 1. + std::max(0., lodHysteresis);
+    if (zoom < minimalLodZoom * (lod == Lod::Minimal ? h : 1.))
+        return Lod::Minimal;
+    if (zoom < simplifiedLodZoom * (lod != Lod::Full ? h : 1.))
+        return Lod::Simplified;
+    return Lod::Full;
+}
+
+void    Graph::updateLod() noexcept
+{
+    const auto lod = _levelOfDetail ? lodForZoom(_lod, _lodZoom, _simplifiedLodZoom, _minimalLodZoom, _lodHysteresis) :
+                                      qan::NodeItem::Lod::Full;
+    if (lod == _lod)
+        return;
+    _lod = lod;
+    // Note: Groups are nodes
+    for (const auto node : get_nodes())
+        if (node != nullptr &&
+            node->getItem() != nullptr)
+            node->getItem()->setLod(_lod);
+    for (const auto edge : get_edges())
+        if (edge != nullptr &&
+            edge->getItem() != nullptr)
+            edge->getItem()->setLod(_lod);
+    updateEdgeBatchRenderer();
+    emit lodChanged();
 }
 //-----------------------------------------------------------------------------
 
@@ -414,6 +731,17 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component,
         qWarning() << "qan::Graph::createFromComponent(): Error called with a nullptr delegate component.";
         return nullptr;
     }
+    if (_delegatePooling &&
+        (node != nullptr || edge != nullptr || group != nullptr)) { // Try reusing a pooled node, edge or group item
+        const auto pooledItem = reusePooledItem(*component, style, node, edge, group);
+        if (pooledItem != nullptr)
+            return pooledItem;
+    }
+    if (_nativeDelegates) {
+        const auto nativeItem = createNativeItem(*component, style, node, edge);
+        if (nativeItem != nullptr)
+            return nativeItem;
+    }
     QQuickItem* item = nullptr;
     try {
         if (!component->isReady())
@@ -437,6 +765,7 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component,
                 node->setItem(nodeItem);
                 nodeItem->setNode(node);
                 nodeItem->setGraph(this);
+                nodeItem->setDelegateComponent(component);
                 nodeItem->setStyle(qobject_cast<qan::NodeStyle*>(&style));
                 _styleManager.setStyleComponent(&style, component );
             }
@@ -446,6 +775,8 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component,
                 edge->setItem(edgeItem);
                 edgeItem->setEdge(edge);
                 edgeItem->setGraph(this);
+                edgeItem->setDelegateComponent(component);
+                edgeItem->setBatchRendered(getEdgeBatchRendering());  // Set before completion, delegate content depends on it
                 edgeItem->setStyle(qobject_cast<qan::EdgeStyle*>(&style));
                 _styleManager.setStyleComponent(edgeItem->getStyle(), component);
             }
@@ -454,6 +785,7 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component,
             if (groupItem != nullptr) {
                 group->setItem(groupItem);
                 groupItem->setGraph(this);
+                groupItem->setDelegateComponent(component);
                 groupItem->setStyle(qobject_cast<qan::NodeStyle*>(&style));
                 _styleManager.setStyleComponent(groupItem->getStyle(), component);
             }
@@ -466,6 +798,7 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component,
         if (!component->isError()) {
             QQmlEngine::setObjectOwnership(object, QQmlEngine::CppOwnership);
             item = qobject_cast<QQuickItem*>(object);
+            saveDelegateDefaults(item);
             item->setVisible(true);
             item->setParentItem(getContainerItem());
         } // Note: There is no leak until cpp ownership is set
@@ -485,6 +818,54 @@ QQuickItem* Graph::createFromComponent(QQmlComponent* component, qan::Style* sty
                                  nullptr;
 }
 
+bool    Graph::setNativeDelegates(bool nativeDelegates) noexcept
+{
+    if (nativeDelegates == _nativeDelegates)
+        return false;
+    _nativeDelegates = nativeDelegates;
+    emit nativeDelegatesChanged();
+    return true;
+}
+
+QQuickItem* Graph::createNativeItem(QQmlComponent& component, qan::Style& style,
+                                    qan::Node* node, qan::Edge* edge) noexcept
+{
+    // PRECONDITIONS:
+        // component must be one of default Node.qml or Edge.qml delegates
+    static const QUrl nodeDelegateUrl{QStringLiteral("qrc:/QuickQanava/Node.qml")};
+    static const QUrl edgeDelegateUrl{QStringLiteral("qrc:/QuickQanava/Edge.qml")};
+    QQuickItem* item = nullptr;
+    if (node != nullptr &&
+        component.url() == nodeDelegateUrl) {
+        const auto nodeItem = new qan::NativeNodeItem{};
+        node->setItem(nodeItem);
+        nodeItem->setNode(node);
+        nodeItem->setGraph(this);
+        nodeItem->setDelegateComponent(&component);     // Native items are pooled with their default component items
+        nodeItem->setStyle(qobject_cast<qan::NodeStyle*>(&style));
+        _styleManager.setStyleComponent(&style, &component);
+        item = nodeItem;
+    } else if (edge != nullptr &&
+               component.url() == edgeDelegateUrl) {
+        const auto edgeItem = new qan::NativeEdgeItem{};
+        edge->setItem(edgeItem);
+        edgeItem->setEdge(edge);
+        edgeItem->setGraph(this);
+        edgeItem->setDelegateComponent(&component);
+        edgeItem->setBatchRendered(getEdgeBatchRendering());
+        edgeItem->setStyle(qobject_cast<qan::EdgeStyle*>(&style));
+        _styleManager.setStyleComponent(edgeItem->getStyle(), &component);
+        item = edgeItem;
+    }
+    if (item != nullptr) {
+        QQmlEngine::setObjectOwnership(item, QQmlEngine::CppOwnership);
+        saveDelegateDefaults(item);
+        item->setVisible(true);
+        item->setParentItem(getContainerItem());
+    }
+    return item;
+}
+
 void Graph::setSelectionDelegate(QQmlComponent* selectionDelegate) noexcept
 {
     // Note: Cpp ownership is voluntarily not set to avoid destruction of
@@ -498,13 +879,16 @@ void Graph::setSelectionDelegate(std::unique_ptr<QQmlComponent> selectionDelegat
     if (selectionDelegate) {
         if (selectionDelegate != _selectionDelegate) {
             _selectionDelegate = std::move(selectionDelegate);
+            _customSelectionDelegate = true;
             delegateChanged = true;
         }
     } else {    // Use QuickQanava default selection delegate
         _selectionDelegate = createComponent(QStringLiteral("qrc:/QuickQanava/SelectionItem.qml"));
+        _customSelectionDelegate = false;
         delegateChanged = true;
     }
-    if (delegateChanged) {  // Update all existing delegates...
+    if (delegateChanged &&
+        !isSelectionOverlayActive()) {  // Update all existing delegates...
         // Note: It could be done in a more more 'generic' way!
         auto updateNodeSelectionItem = [this](auto& primitive) -> void {
             if (primitive != nullptr &&
@@ -520,6 +904,9 @@ void Graph::setSelectionDelegate(std::unique_ptr<QQmlComponent> selectionDelegat
         };
         std::for_each(get_groups().begin(), get_groups().end(), updateGroupSelectionItem);
         std::for_each(get_nodes().begin(), get_nodes().end(), updateNodeSelectionItem);
+    }
+    if (delegateChanged) {
+        updateSelectionRendering();
         emit selectionDelegateChanged();
     }
 }
@@ -529,6 +916,8 @@ QQuickItem* Graph::createSelectionItem(QQuickItem* parent)
     const auto edgeItem = qobject_cast<qan::EdgeItem*>(parent);
     if (edgeItem != nullptr)    // Edge selection item is managed directly in EdgeTemplate.qml
         return nullptr;
+    if (isSelectionOverlayActive())  // Node and group selection is drawn in selection overlay
+        return nullptr;
     const auto selectionItem = createItemFromComponent(_selectionDelegate.get());
     if (selectionItem != nullptr) {
         selectionItem->setEnabled(false); // Avoid node/edge/group selection problems
@@ -614,6 +1003,327 @@ QQuickItem* Graph::createItemFromComponent(QQmlComponent* component)
 }
 //-----------------------------------------------------------------------------
 
+/* Delegate Pooling Management *///--------------------------------------------
+bool    Graph::setDelegatePooling(bool delegatePooling) noexcept
+{
+    if (delegatePooling == _delegatePooling)
+        return false;
+    _delegatePooling = delegatePooling;
+    if (!_delegatePooling)
+        _delegatePool.clear();
+    emit delegatePoolingChanged();
+    return true;
+}
+
+int     Graph::getDelegatePoolHits() const noexcept { return static_cast<int>(_delegatePool.getHits()); }
+int     Graph::getDelegatePoolMisses() const noexcept { return static_cast<int>(_delegatePool.getMisses()); }
+int     Graph::getDelegatePoolSize() const noexcept { return static_cast<int>(_delegatePool.size()); }
+
+QQuickItem* Graph::reusePooledItem(QQmlComponent& component, qan::Style& style,
+                                   qan::Node* node, qan::Edge* edge, qan::Group* group) noexcept
+{
+    const auto pooledItem = _delegatePool.acquire(&component, &style);
+    if (pooledItem == nullptr)
+        return nullptr;
+    if (node != nullptr) {
+        const auto nodeItem = qobject_cast<qan::NodeItem*>(pooledItem);
+        if (nodeItem != nullptr) {
+            node->setItem(nodeItem);
+            nodeItem->setNode(node);
+            nodeItem->setGraph(this);
+            nodeItem->setStyle(qobject_cast<qan::NodeStyle*>(&style));
+            _styleManager.setStyleComponent(&style, &component);
+            nodeItem->setParentItem(getContainerItem());
+            nodeItem->setVisible(true);
+            nodeItem->reuse();
+        }
+    } else if (edge != nullptr) {
+        const auto edgeItem = qobject_cast<qan::EdgeItem*>(pooledItem);
+        if (edgeItem != nullptr) {
+            edge->setItem(edgeItem);
+            edgeItem->setEdge(edge);
+            edgeItem->setGraph(this);
+            edgeItem->setBatchRendered(getEdgeBatchRendering());
+            edgeItem->setStyle(qobject_cast<qan::EdgeStyle*>(&style));
+            _styleManager.setStyleComponent(edgeItem->getStyle(), &component);
+            edgeItem->setParentItem(getContainerItem());
+            edgeItem->setVisible(true);
+            edgeItem->reuse();
+        }
+    } else if (group != nullptr) {
+        const auto groupItem = qobject_cast<qan::GroupItem*>(pooledItem);
+        if (groupItem != nullptr) {     // Note: group is set on item in insertGroup()
+            group->setItem(groupItem);
+            groupItem->setGraph(this);
+            groupItem->setStyle(qobject_cast<qan::NodeStyle*>(&style));
+            _styleManager.setStyleComponent(groupItem->getStyle(), &component);
+            groupItem->setParentItem(getContainerItem());
+            groupItem->setVisible(true);
+            groupItem->reuse();
+        }
+    }
+    return pooledItem;
+}
+
+void    Graph::saveDelegateDefaults(QQuickItem* item) noexcept
+{
+    const auto nodeItem = qobject_cast<qan::NodeItem*>(item);
+    if (nodeItem != nullptr)
+        nodeItem->saveDelegateDefaults();
+    const auto edgeItem = qobject_cast<qan::EdgeItem*>(item);
+    if (edgeItem != nullptr)
+        edgeItem->saveDelegateDefaults();
+}
+
+bool    Graph::poolNodeItem(qan::Node& node)
+{
+    // PRECONDITIONS:
+        // node item must have been created from a delegate component
+        // group item must be empty (group content has been ungrouped or removed)
+    const auto nodeItem = node.getItem();
+    if (nodeItem == nullptr)
+        return false;
+    const auto groupItem = qobject_cast<qan::GroupItem*>(nodeItem);
+    if (groupItem != nullptr &&
+        groupItem->getContainer() != nullptr) {
+        const auto& content = groupItem->getContainer()->childItems();
+        if (std::any_of(content.cbegin(), content.cend(),
+                        [](const auto item) { return qobject_cast<qan::NodeItem*>(item) != nullptr; }))
+            return false;
+    }
+    const auto component = nodeItem->getDelegateComponent();
+    const qan::Style* style = nodeItem->getStyle();
+    if (!_delegatePool.canRelease(component, style))
+        return false;
+
+    // Algorithm:
+        // 1. Remaining adjacent edges items (see poolAdjacentEdgeItems()) are destroyed with their edges, but
+        //    only later with deleteLater(): disconnect them now since item might be reused immediately.
+        // 2. Destroy ports items: ports are specific to a node, docks are kept (empty) with node item.
+        // 3. Disconnect item from graph and release it.
+    for (const auto inEdge : node.get_in_edges())       // 1.
+        if (inEdge != nullptr && inEdge->getItem() != nullptr)
+            disconnect(nodeItem, nullptr, inEdge->getItem(), nullptr);
+    for (const auto outEdge : node.get_out_edges())
+        if (outEdge != nullptr && outEdge->getItem() != nullptr)
+            disconnect(nodeItem, nullptr, outEdge->getItem(), nullptr);
+
+    for (const auto port : nodeItem->getPorts()) {      // 2.
+        if (port != nullptr) {
+            disconnect(port, nullptr, this, nullptr);
+            port->deleteLater();
+        }
+    }
+    nodeItem->getPorts().clear();
+
+    disconnect(nodeItem, nullptr, this, nullptr);       // 3. Spatial index, z monitoring and click notifications
+    untrackItemZ(nodeItem);
+    forgetCulledItem(nodeItem);
+    node.takeItem();
+    nodeItem->recycle();
+    if (groupItem != nullptr)
+        invalidateGroupsZOrder();
+    return _delegatePool.release(component, style, nodeItem);
+}
+
+void    Graph::poolAdjacentEdgeItems(qan::Node& node)
+{
+    // Note: Adjacent edges are removed implicitly with node topology, without removeEdge()
+    const auto poolAdjacentEdgeItem = [this](qan::Edge* edge) {
+        if (edge == nullptr ||
+            edge->getItem() == nullptr)
+            return;
+        _selectedEdges.removeAll(edge);
+        _spatialIndex.remove(edge->getItem());
+        poolEdgeItem(*edge);
+    };
+    for (const auto inEdge : node.get_in_edges())
+        poolAdjacentEdgeItem(inEdge);
+    for (const auto outEdge : node.get_out_edges())
+        poolAdjacentEdgeItem(outEdge);
+}
+
+bool    Graph::poolEdgeItem(qan::Edge& edge)
+{
+    const auto edgeItem = edge.getItem();
+    if (edgeItem == nullptr)
+        return false;
+    const auto component = edgeItem->getDelegateComponent();
+    const qan::Style* style = edgeItem->getStyle();
+    if (!_delegatePool.canRelease(component, style))
+        return false;
+    disconnect(edgeItem, nullptr, this, nullptr);   // Spatial index monitoring and click notifications
+    forgetCulledItem(edgeItem);
+    edge.takeItem();
+    edgeItem->recycle();
+    return _delegatePool.release(component, style, edgeItem);
+}
+//-----------------------------------------------------------------------------
+
+/* Asynchronous Insertion Management *///--------------------------------------
+bool    Graph::setAsynchronousInsertion(bool asynchronousInsertion) noexcept
+{
+    if (asynchronousInsertion == _asynchronousInsertion)
+        return false;
+    _asynchronousInsertion = asynchronousInsertion;
+    emit asynchronousInsertionChanged();
+    return true;
+}
+
+bool    Graph::setIncubationBudget(int incubationBudget) noexcept
+{
+    incubationBudget = std::max(1, incubationBudget);
+    if (incubationBudget == _incubationBudget)
+        return false;
+    _incubationBudget = incubationBudget;
+    emit incubationBudgetChanged();
+    return true;
+}
+
+bool    Graph::useAsynchronousInsertion() const noexcept
+{
+    return _asynchronousInsertion &&
+           window() != nullptr &&
+           qmlContext(this) != nullptr;
+}
+
+QQuickItem* Graph::incubateFromComponent(QQmlComponent* component,
+                                         qan::Style& style,
+                                         qan::Node* node,
+                                         qan::Edge* edge) noexcept
+{
+    // PRECONDITIONS:
+        // component must be ready (otherwise fallback to synchronous creation)
+        // one of node or edge must be non nullptr
+    if (component == nullptr ||
+        (node == nullptr && edge == nullptr))
+        return nullptr;
+    if (_delegatePooling) {                     // Pooled items are available immediately
+        const auto pooledItem = reusePooledItem(*component, style, node, edge, nullptr);
+        if (pooledItem != nullptr)
+            return pooledItem;
+    }
+    if (_nativeDelegates) {                     // Native items are cheap enough to be created synchronously
+        const auto nativeItem = createNativeItem(*component, style, node, edge);
+        if (nativeItem != nullptr)
+            return nativeItem;
+    }
+    const auto engine = qmlEngine(this);
+    const auto rootContext = qmlContext(this);
+    if (!component->isReady() ||
+        engine == nullptr ||
+        rootContext == nullptr)
+        return createFromComponent(component, style, node, edge);
+
+    if (engine->incubationController() == nullptr) {   // Incubation is driven from frame callback, install a controller if none exists
+        if (!_incubationController)
+            _incubationController = std::make_unique<QQmlIncubationController>();
+        engine->setIncubationController(_incubationController.get());
+    }
+    if (!_incubationFrameConnection &&
+        window() != nullptr)
+        _incubationFrameConnection = connect(window(), &QQuickWindow::afterAnimating,
+                                             this,     &qan::Graph::incubateDelegates);
+    _pendingItems++;
+    emit pendingItemsChanged();
+    // Note: incubator is registered before create() since incubation might complete synchronously
+    _incubators.emplace_back(std::make_unique<qan::DelegateIncubator>(*this, *component, style, node, edge));
+    component->create(*_incubators.back(), rootContext);
+    if (window() != nullptr)
+        window()->update();             // Request a frame to drive incubation
+    return nullptr;
+}
+
+void    Graph::incubateDelegates()
+{
+    // Algorithm:
+        // 1. Incubate pending items for at most incubationBudget ms.
+        // 2. Release finished incubators (incubators can't be destroyed from their statusChanged()).
+        // 3. Request another frame while items are pending, otherwise stop monitoring frames.
+    const auto engine = qmlEngine(this);
+    if (engine != nullptr &&
+        engine->incubationController() != nullptr)
+        engine->incubationController()->incubateFor(_incubationBudget);   // 1.
+    _incubators.erase(std::remove_if(_incubators.begin(), _incubators.end(),    // 2.
+                                     [](const auto& incubator) { return incubator->isFinished(); }),
+                      _incubators.end());
+    if (_pendingItems > 0) {                                                    // 3.
+        if (window() != nullptr)
+            window()->update();
+    } else if (_incubationFrameConnection)
+        disconnect(_incubationFrameConnection);
+}
+
+void    Graph::initializeIncubatedItem(qan::DelegateIncubator& incubator, QObject* object)
+{
+    // Note: Same initialization than createFromComponent() before completeCreate(), except that
+    // node or edge item is attached to it's primitive only once ready.
+    const auto style = incubator.getStyle();
+    if (incubator.getNode() != nullptr) {
+        const auto nodeItem = qobject_cast<qan::NodeItem*>(object);
+        if (nodeItem != nullptr) {
+            nodeItem->setNode(incubator.getNode());
+            nodeItem->setGraph(this);
+            nodeItem->setDelegateComponent(incubator.getComponent());
+            nodeItem->setStyle(qobject_cast<qan::NodeStyle*>(style));
+        }
+    } else if (incubator.getEdge() != nullptr) {
+        const auto edgeItem = qobject_cast<qan::EdgeItem*>(object);
+        if (edgeItem != nullptr) {
+            edgeItem->setGraph(this);
+            edgeItem->setDelegateComponent(incubator.getComponent());
+            edgeItem->setBatchRendered(getEdgeBatchRendering());
+            edgeItem->setStyle(qobject_cast<qan::EdgeStyle*>(style));
+        }
+    }
+}
+
+void    Graph::delegateIncubated(qan::DelegateIncubator& incubator)
+{
+    // PRECONDITIONS:
+        // incubator must be either ready or in error
+    if (incubator.isError())
+        qWarning() << "qan::Graph::delegateIncubated(): " << incubator.errors();
+    else if (incubator.isReady()) {
+        const auto object = incubator.object();
+        QQmlEngine::setObjectOwnership(object, QQmlEngine::CppOwnership);
+        saveDelegateDefaults(qobject_cast<QQuickItem*>(object));
+        const auto node = incubator.getNode();
+        const auto edge = incubator.getEdge();
+        const auto nodeItem = qobject_cast<qan::NodeItem*>(object);
+        const auto edgeItem = qobject_cast<qan::EdgeItem*>(object);
+        if (node != nullptr && nodeItem != nullptr) {
+            nodeItem->setParentItem(getContainerItem());
+            nodeItem->setVisible(true);
+            configureNodeItem(*node, *nodeItem);
+        } else if (edge != nullptr && edgeItem != nullptr) {
+            edgeItem->setParentItem(getContainerItem());
+            edgeItem->setVisible(true);
+            configureEdgeItem(*edge, *edgeItem);
+        } else if (object != nullptr)
+            object->deleteLater();      // Node or edge has been removed while item was incubated
+    }
+    if (_pendingItems > 0) {
+        _pendingItems--;
+        emit pendingItemsChanged();
+        if (_pendingItems == 0)
+            emit itemsReady();
+    }
+}
+
+void    Graph::clearIncubators() noexcept
+{
+    if (_incubationFrameConnection)
+        disconnect(_incubationFrameConnection);
+    _incubators.clear();            // Note: Incubation in progress is aborted and incubated objects destroyed
+    if (_pendingItems != 0) {
+        _pendingItems = 0;
+        emit pendingItemsChanged();
+        emit itemsReady();
+    }
+}
+//-----------------------------------------------------------------------------
+
 /* Graph Factories *///--------------------------------------------------------
 auto    Graph::insertNonVisualNode(Node* node) -> bool
 {
@@ -655,40 +1365,11 @@ bool    Graph::insertNode(Node* node, QQmlComponent* nodeComponent, qan::NodeSty
         if (nodeComponent != nullptr &&
             nodeStyle != nullptr) {
             _styleManager.setStyleComponent(nodeStyle, nodeComponent);
-            nodeItem = static_cast<qan::NodeItem*>(createFromComponent(nodeComponent,
-                                                                       *nodeStyle,
-                                                                       node));
-        }
-        if (nodeItem != nullptr) {
-            nodeItem->setNode(node);
-            nodeItem->setGraph(this);
-            node->setItem(nodeItem);
-            auto notifyNodeClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-                if ( nodeItem != nullptr && nodeItem->getNode() != nullptr )
-                    emit this->nodeClicked(nodeItem->getNode(), p);
-            };
-            connect(nodeItem,   &qan::NodeItem::nodeClicked,
-                    this,       notifyNodeClicked);
-
-            auto notifyNodeRightClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-                if ( nodeItem != nullptr && nodeItem->getNode() != nullptr )
-                    emit this->nodeRightClicked(nodeItem->getNode(), p);
-            };
-            connect(nodeItem,   &qan::NodeItem::nodeRightClicked,
-                    this,       notifyNodeRightClicked);
-
-            auto notifyNodeDoubleClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
-                if ( nodeItem != nullptr && nodeItem->getNode() != nullptr )
-                    emit this->nodeDoubleClicked(nodeItem->getNode(), p);
-            };
-            connect(nodeItem, &qan::NodeItem::nodeDoubleClicked,
-                    this,     notifyNodeDoubleClicked);
-            node->setItem(nodeItem);
-            {   // Send item to front
-                const auto z = nextMaxZ();
-                nodeItem->setZ(z);
-            }
+            nodeItem = static_cast<qan::NodeItem*>(useAsynchronousInsertion() ? incubateFromComponent(nodeComponent, *nodeStyle, node) :
+                                                                                 createFromComponent(nodeComponent, *nodeStyle, node));
         }
+        if (nodeItem != nullptr)
+            configureNodeItem(*node, *nodeItem);
         super_t::insert_node(node);
     } catch (const qan::Error& e) {
         qWarning() << "qan::Graph::insertNode(): Error: " << e.getMsg();
@@ -721,9 +1402,58 @@ bool    Graph::removeNode(qan::Node* node, bool force)
     emit nodeRemoved(node);
     if (_selectedNodes.contains(node))
         _selectedNodes.removeAll(node);
+    if (node->getItem() != nullptr)
+        _spatialIndex.remove(node->getItem());
+    if (_delegatePooling) {
+        poolAdjacentEdgeItems(*node);
+        poolNodeItem(*node);
+    }
     return super_t::remove_node(node);  // warning node pointer now invalid
 }
 
+void    Graph::configureNodeItem(qan::Node& node, qan::NodeItem& nodeItem)
+{
+    nodeItem.setNode(&node);
+    nodeItem.setGraph(this);
+    nodeItem.setLod(_lod);
+    node.setItem(&nodeItem);
+    auto notifyNodeClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
+        if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
+            emit this->nodeClicked(nodeItem->getNode(), p);
+    };
+    connect(&nodeItem,  &qan::NodeItem::nodeClicked,
+            this,       notifyNodeClicked);
+
+    auto notifyNodeRightClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
+        if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
+            emit this->nodeRightClicked(nodeItem->getNode(), p);
+    };
+    connect(&nodeItem,  &qan::NodeItem::nodeRightClicked,
+            this,       notifyNodeRightClicked);
+
+    auto notifyNodeDoubleClicked = [this] (qan::NodeItem* nodeItem, QPointF p) {
+        if (nodeItem != nullptr && nodeItem->getNode() != nullptr)
+            emit this->nodeDoubleClicked(nodeItem->getNode(), p);
+    };
+    connect(&nodeItem,  &qan::NodeItem::nodeDoubleClicked,
+            this,       notifyNodeDoubleClicked);
+    nodeItem.setZ(nextMaxZ());      // Send item to front
+    trackItemZ(&nodeItem);
+    registerSpatialItem(&nodeItem);
+
+    // Edges inserted while node item was incubated have no source or destination item yet
+    for (const auto inEdge : node.get_in_edges())
+        if (inEdge != nullptr &&
+            inEdge->getItem() != nullptr &&
+            inEdge->getItem()->getDestinationItem() == nullptr)
+            inEdge->getItem()->setDestinationItem(&nodeItem);
+    for (const auto outEdge : node.get_out_edges())
+        if (outEdge != nullptr &&
+            outEdge->getItem() != nullptr &&
+            outEdge->getItem()->getSourceItem() == nullptr)
+            outEdge->getItem()->setSourceItem(&nodeItem);
+}
+
 int     Graph::getNodeCount() const noexcept { return super_t::get_node_count(); }
 
 bool    Graph::hasNode(const qan::Node* node) const { return super_t::contains(node); }
@@ -861,41 +1591,62 @@ bool    Graph::configureEdge(qan::Edge& edge, QQmlComponent& edgeComponent, qan:
                              qan::Node& src, qan::Node* dst)
 {
     _styleManager.setStyleComponent(&style, &edgeComponent);
+    if (useAsynchronousInsertion()) {   // Topology is set immediately, item is configured once incubated
+        edge.set_src(&src);
+        if (dst != nullptr)
+            edge.set_dst(dst);
+        const auto edgeItem = qobject_cast<qan::EdgeItem*>(incubateFromComponent(&edgeComponent, style, nullptr, &edge));
+        if (edgeItem != nullptr)
+            configureEdgeItem(edge, *edgeItem);
+        return true;
+    }
     auto edgeItem = qobject_cast< qan::EdgeItem* >(createFromComponent(&edgeComponent, style, nullptr, &edge));
     if (edgeItem == nullptr) {
         qWarning() << "qan::Graph::insertEdge(): Warning: Edge creation from QML delegate failed.";
         return false;
     }
-    edge.setItem(edgeItem);
-    edgeItem->setSourceItem(src.getItem());
-    if (dst != nullptr)
-        edgeItem->setDestinationItem(dst->getItem());
-
     edge.set_src(&src);
     if (dst != nullptr)
         edge.set_dst(dst);
+    configureEdgeItem(edge, *edgeItem);
+    return true;
+}
+
+void    Graph::configureEdgeItem(qan::Edge& edge, qan::EdgeItem& edgeItem)
+{
+    edge.setItem(&edgeItem);
+    edgeItem.setLod(_lod);
+    registerSpatialItem(&edgeItem);
+    // Note: source or destination item might still be incubated, they are then set in configureNodeItem()
+    const auto src = edge.get_src();
+    if (src != nullptr &&
+        src->getItem() != nullptr)
+        edgeItem.setSourceItem(src->getItem());
+    const auto dst = edge.get_dst();
+    if (dst != nullptr &&
+        dst->getItem() != nullptr)
+        edgeItem.setDestinationItem(dst->getItem());
 
     auto notifyEdgeClicked = [this] (qan::EdgeItem* edgeItem, QPointF p) {
         if (edgeItem != nullptr && edgeItem->getEdge() != nullptr)
             emit this->edgeClicked(edgeItem->getEdge(), p);
     };
-    connect(edgeItem, &qan::EdgeItem::edgeClicked,
-            this,     notifyEdgeClicked);
+    connect(&edgeItem,  &qan::EdgeItem::edgeClicked,
+            this,       notifyEdgeClicked);
 
     auto notifyEdgeRightClicked = [this] (qan::EdgeItem* edgeItem, QPointF p) {
         if (edgeItem != nullptr && edgeItem->getEdge() != nullptr)
             emit this->edgeRightClicked(edgeItem->getEdge(), p);
     };
-    connect(edgeItem,   &qan::EdgeItem::edgeRightClicked,
+    connect(&edgeItem,  &qan::EdgeItem::edgeRightClicked,
             this,       notifyEdgeRightClicked);
 
     auto notifyEdgeDoubleClicked = [this] (qan::EdgeItem* edgeItem, QPointF p) {
         if (edgeItem != nullptr && edgeItem->getEdge() != nullptr)
             emit this->edgeDoubleClicked(edgeItem->getEdge(), p);
     };
-    connect(edgeItem, &qan::EdgeItem::edgeDoubleClicked,
-            this,     notifyEdgeDoubleClicked);
-    return true;
+    connect(&edgeItem,  &qan::EdgeItem::edgeDoubleClicked,
+            this,       notifyEdgeDoubleClicked);
 }
 
 bool    Graph::removeEdge(qan::Node* source, qan::Node* destination) {
@@ -909,7 +1660,11 @@ bool    Graph::removeEdge(qan::Edge* edge, bool force) {
          edge->getLocked()))
         return false;
     _selectedEdges.removeAll(edge);
+    if (edge->getItem() != nullptr)
+        _spatialIndex.remove(edge->getItem());
     emit onEdgeRemoved(edge);
+    if (_delegatePooling)
+        poolEdgeItem(*edge);
     return super_t::remove_edge(edge);
 }
 
@@ -921,6 +1676,93 @@ bool    Graph::hasEdge(const qan::Node* source, const qan::Node* destination) co
 }
 
 bool    Graph::hasEdge(const qan::Edge* edge) const { return hasEdge(edge->get_src(), edge->get_dst()); }
+
+void    Graph::scheduleEdgeUpdate(qan::EdgeItem* edgeItem)
+{
+    if (edgeItem == nullptr)
+        return;
+    if (window() == nullptr) {  // No frame to synchronize with, update immediately
+        edgeItem->updateItemSlot();
+        return;
+    }
+    if (edgeItem->isUpdateScheduled())
+        return;
+    edgeItem->setUpdateScheduled(true);
+    _dirtyEdges.push_back(edgeItem);
+    polish();
+}
+
+void    Graph::flushEdgeUpdates()
+{
+    // Algorithm:
+        // 1. Pack all dirty edges supported by qan::EdgeGeometryStore in the store, update others immediately.
+        // 2. Generate packed edges geometry in batch.
+        // 3. Apply generated geometry to packed edges.
+    // Note: Updating an edge might queue edges connected to it (edge to edge connection), iterate
+    // with an index since _dirtyEdges might grow during flush.
+    _edgeGeometryStore.clear();
+    _storedEdges.clear();
+    for (std::size_t e = 0; e < _dirtyEdges.size(); e++) {     // 1.
+        const QPointer<qan::EdgeItem> edgeItem = _dirtyEdges[e];
+        if (edgeItem) {
+            edgeItem->setUpdateScheduled(false);
+            qan::EdgeGeometryStore::index_t storeIndex = 0;
+            if (edgeItem->storeGeometry(_edgeGeometryStore, storeIndex))
+                _storedEdges.push_back(edgeItem);
+            else
+                edgeItem->updateItemSlot();
+        }
+    }
+    _dirtyEdges.clear();
+    if (_storedEdges.empty())
+        return;
+    _edgeGeometryStore.update();                                // 2.
+    for (std::size_t s = 0; s < _storedEdges.size(); s++)      // 3.
+        if (_storedEdges[s])
+            _storedEdges[s]->applyStoredGeometry(_edgeGeometryStore,
+                                                 static_cast<qan::EdgeGeometryStore::index_t>(s));
+    _storedEdges.clear();
+}
+
+bool    Graph::setEdgeBatchRendering(bool edgeBatchRendering) noexcept
+{
+    if (edgeBatchRendering == _edgeBatchRendering)
+        return false;
+    _edgeBatchRendering = edgeBatchRendering;
+    updateEdgeBatchRenderer();
+    for (const auto edge : get_edges())
+        if (edge != nullptr &&
+            edge->getItem() != nullptr)
+            edge->getItem()->setBatchRendered(_edgeBatchRendering);
+    emit edgeBatchRenderingChanged();
+    return true;
+}
+
+void    Graph::updateEdgeBatchRenderer()
+{
+    // Note: Minimal level of detail is entirely drawn by batch renderer
+    const auto minimal = _lod == qan::NodeItem::Lod::Minimal;
+    const auto active = _edgeBatchRendering || minimal;
+    if (active &&
+        !_edgeBatchRenderer) {
+        _edgeBatchRenderer = new qan::EdgeBatchRenderer{getContainerItem()};
+        _edgeBatchRenderer->setZ(edgeBatchRendererZ);
+        _edgeBatchRenderer->setGraph(this);
+    }
+    if (_edgeBatchRenderer) {
+        _edgeBatchRenderer->setVisible(active);
+        _edgeBatchRenderer->setMinimal(minimal);
+        _edgeBatchRenderer->requestUpdate();
+    }
+}
+
+void    Graph::updatePolish()
+{
+    super_t::updatePolish();
+    flushEdgeUpdates();
+    if (_cullingDirty)
+        updateCulling();
+}
 //-----------------------------------------------------------------------------
 
 /* Graph Group Management *///-------------------------------------------------
@@ -988,10 +1830,19 @@ bool    Graph::insertGroup(Group* group, QQmlComponent* groupComponent, qan::Nod
         connect(groupItem, &qan::GroupItem::groupDoubleClicked,
                 this,      notifyGroupDoubleClicked);
 
+        groupItem->setLod(_lod);
         { // Send group item to front
             const auto z = nextMaxZ();
             groupItem->setZ(z);
         }
+        trackItemZ(groupItem);
+        registerSpatialItem(groupItem);
+        // Groups global z ordering must be updated when a group is sent to front/back
+        connect(groupItem,  &QQuickItem::zChanged,
+                this,       &qan::Graph::invalidateGroupsZOrder);
+        connect(groupItem,  &QObject::destroyed,
+                this,       &qan::Graph::invalidateGroupsZOrder);
+        invalidateGroupsZOrder();
     }
     if (group != nullptr) {       // Notify user.
         onNodeInserted(*group);
@@ -1028,6 +1879,13 @@ void    Graph::removeGroup(qan::Group* group, bool removeContent, bool force)
             _selectedNodes.removeAll(group);
         if (_selectedGroups.contains(group))
             _selectedGroups.removeAll(group);
+        if (group->getItem() != nullptr)
+            _spatialIndex.remove(group->getItem());
+        if (_delegatePooling) {
+            poolAdjacentEdgeItems(*group);
+            poolNodeItem(*group);
+        }
+        invalidateGroupsZOrder();
         remove_group(group);
     } else {
         removeGroupContent_rec(group);
@@ -1053,7 +1911,15 @@ void    Graph::removeGroupContent_rec(qan::Group* group)
 
     if (_selectedNodes.contains(group))
         _selectedNodes.removeAll(group);
-
+    if (_selectedGroups.contains(group))
+        _selectedGroups.removeAll(group);
+    if (group->getItem() != nullptr)
+        _spatialIndex.remove(group->getItem());
+    if (_delegatePooling) {     // Note: Group content has been removed, group item is empty
+        poolAdjacentEdgeItems(*group);
+        poolNodeItem(*group);
+    }
+    invalidateGroupsZOrder();
     super_t::remove_group(group);
 }
 
@@ -1082,6 +1948,9 @@ bool    qan::Graph::groupNode(qan::Group* group, qan::Node* node, qan::TableCell
             group->getGroupItem() != nullptr &&
             node->getItem() != nullptr ) {
             group->getGroupItem()->groupNodeItem(node->getItem(), groupCell, transform);
+            updateSpatialIndex(node->getItem());    // Node item has been reparented to group
+            if (node->isGroup())
+                invalidateGroupsZOrder();           // Grouped group global z now depends on it's host group
             emit nodeGrouped(node, group);
         }
         return true;
@@ -1120,7 +1989,10 @@ bool    qan::Graph::ungroupNode(qan::Node* node, qan::Group* group, bool transfo
                 // Update node z to maxZ: otherwise an undroupped node might be behind it's host group.
                 const auto z = nextMaxZ();
                 node->getItem()->setZ(z);
+                updateSpatialIndex(node->getItem());    // Node item has been reparented to graph
             }
+            if (node->isGroup())
+                invalidateGroupsZOrder();
             return true;
         } catch (...) { qWarning() << "qan::Graph::ungroupNode(): Topology error."; }
     }
@@ -1179,9 +2051,41 @@ void    Graph::setSelectionMargin(qreal selectionMargin) noexcept
     }
 }
 
+bool    Graph::setSelectionOverlayEnabled(bool selectionOverlayEnabled) noexcept
+{
+    if (selectionOverlayEnabled != _selectionOverlayEnabled) {
+        _selectionOverlayEnabled = selectionOverlayEnabled;
+        updateSelectionRendering();
+        emit selectionOverlayEnabledChanged();
+        return true;
+    }
+    return false;
+}
+
+void    Graph::updateSelectionRendering() noexcept
+{
+    const auto overlayActive = isSelectionOverlayActive();
+    for (const auto node : get_nodes()) {   // Note: groups are nodes
+        const auto item = node != nullptr ? node->getItem() : nullptr;
+        if (item == nullptr)
+            continue;
+        if (overlayActive)
+            item->resetSelectionItem();
+        else if (item->getSelected() &&
+                 item->getSelectionItem() == nullptr)
+            item->setSelectionItem(createSelectionItem(item));
+    }
+    if (_selectionOverlay) {
+        _selectionOverlay->setVisible(overlayActive);
+        _selectionOverlay->requestUpdate();
+    }
+}
+
 void    Graph::configureSelectionItems() noexcept
 {
     // PRECONDITIONS: None
+    if (_selectionOverlay)
+        _selectionOverlay->requestUpdate();
     for (auto node : _selectedNodes)
         if (node != nullptr &&
             node->getItem() != nullptr)
@@ -1321,11 +2225,11 @@ void    addToSelectionImpl(QPointer<Primitive_t> primitive,
 
 void    Graph::addToSelection(qan::Node& node) {
     addToSelectionImpl<qan::Node>(QPointer<qan::Node>(&node), _selectedNodes, *this);
-    emit selectionChanged();
+    notifySelectionChanged();
 }
 void    Graph::addToSelection(qan::Group& group) {
     addToSelectionImpl<qan::Group>(&group, _selectedGroups, *this);
-    emit selectionChanged();
+    notifySelectionChanged();
 }
 void    Graph::addToSelection(qan::Edge& edge)
 {
@@ -1339,7 +2243,7 @@ void    Graph::addToSelection(qan::Edge& edge)
                 edge.getItem()->setSelectionItem(createSelectionItem(edge.getItem()));   // Safe, any argument might be nullptr
             // Note 20220329: primitive.getItem()->configureSelectionItem() is called from setSelectionItem()
         }
-        emit selectionChanged();
+        notifySelectionChanged();
     }
 }
 
@@ -1353,11 +2257,11 @@ void    removeFromSelectionImpl(QPointer<Primitive_t> primitive,
 
 void    Graph::removeFromSelection(qan::Node& node) {
     removeFromSelectionImpl<qan::Node>(&node, _selectedNodes);
-    emit selectionChanged();
+    notifySelectionChanged();
 }
 void    Graph::removeFromSelection(qan::Group& group) {
     removeFromSelectionImpl<qan::Group>(&group, _selectedGroups);
-    emit selectionChanged();
+    notifySelectionChanged();
 }
 
 // Note: Called from
@@ -1366,96 +2270,300 @@ void    Graph::removeFromSelection(QQuickItem* item) {
     if (nodeItem != nullptr &&
         nodeItem->getNode() != nullptr) {
         _selectedNodes.removeAll(nodeItem->getNode());
-        emit selectionChanged();
+        notifySelectionChanged();
     } else {
         const auto groupItem = qobject_cast<qan::GroupItem*>(item);
         if (groupItem != nullptr &&
             groupItem->getGroup() != nullptr) {
             _selectedGroups.removeAll(groupItem->getGroup());
-            emit selectionChanged();
+            notifySelectionChanged();
         } else {
             const auto edgeItem = qobject_cast<qan::EdgeItem*>(item);
             if (edgeItem != nullptr &&
                 edgeItem->getEdge() != nullptr) {
                 _selectedEdges.removeAll(edgeItem->getEdge());
-                emit selectionChanged();
+                notifySelectionChanged();
             }
         }
     }
 }
 
+namespace impl { // qan::impl
+
+/* Replace selectedPrimitives content with primitives and update primitives items selection state,
+ * selectedPrimitives is modified at most once (ie one model reset). Return true if selection
+ * has been modified.
+ */
+template <class Primitive_t>
+bool    setSelectionImpl(const std::vector<Primitive_t*>& primitives,
+                         qcm::Container<std::vector, QPointer<Primitive_t>>& selectedPrimitives)
+{
+    std::unordered_set<const Primitive_t*> selection;
+    selection.reserve(primitives.size());
+    std::vector<Primitive_t*> content;
+    content.reserve(primitives.size());
+    for (const auto primitive : primitives) {
+        if (primitive == nullptr ||
+            primitive->getItem() == nullptr)
+            continue;
+        if (selection.insert(primitive).second)
+            content.push_back(primitive);
+    }
+
+    // Deselect primitives that are no longer selected, a selection with the same size
+    // where all primitives are still selected is unchanged.
+    bool modified = content.size() != static_cast<std::size_t>(selectedPrimitives.size());
+    for (const auto& selected : selectedPrimitives) {
+        if (!selected) {
+            modified = true;
+            continue;
+        }
+        if (selection.find(selected.data()) == selection.end()) {
+            modified = true;
+            if (selected->getItem() != nullptr)
+                selected->getItem()->setSelectedState(false);   // Note: Do not call graph removeFromSelection()
+        }
+    }
+    if (!modified)
+        return false;
+    selectedPrimitives.assign(content);
+    for (const auto primitive : content)
+        if (!primitive->getItem()->getSelected())
+            primitive->getItem()->setSelectedState(true);
+    return true;
+}
+
+// Return currently selected primitives, with primitives in \c except removed.
+template <class Primitive_t>
+std::vector<Primitive_t*>   selectionExcept(const qcm::Container<std::vector, QPointer<Primitive_t>>& selectedPrimitives,
+                                            const std::unordered_set<const QObject*>& except)
+{
+    std::vector<Primitive_t*> selection;
+    selection.reserve(static_cast<std::size_t>(selectedPrimitives.size()));
+    for (const auto& selected : selectedPrimitives)
+        if (selected &&
+            except.find(selected.data()) == except.end())
+            selection.push_back(selected.data());
+    return selection;
+}
+
+// Return true if primitive can be added to selection (ie it is not locked, selectable and not already selected).
+template <class Primitive_t>
+bool    isSelectionCandidate(const Primitive_t* primitive)
+{
+    return primitive != nullptr &&
+           primitive->getItem() != nullptr &&
+           !primitive->getLocked() &&
+           primitive->getItem()->isSelectable() &&
+           !primitive->getItem()->getSelected();
+}
+
+// Dispatch QML \c primitives list in nodes (or groups) and edges, other objects are ignored.
+void    dispatchPrimitives(const QVariantList& primitives, std::vector<qan::Node*>& nodes, std::vector<qan::Edge*>& edges)
+{
+    for (const auto& primitive : primitives) {
+        const auto object = primitive.value<QObject*>();
+        const auto node = qobject_cast<qan::Node*>(object);
+        if (node != nullptr) {
+            nodes.push_back(node);
+            continue;
+        }
+        const auto edge = qobject_cast<qan::Edge*>(object);
+        if (edge != nullptr)
+            edges.push_back(edge);
+    }
+}
+
+} // qan::impl
+
+void    Graph::selectNodes(const std::vector<qan::Node*>& nodes)
+{
+    // Algorithm:
+        // 1. Filter nodes that could be selected, dispatch groups and nodes.
+        // 2. Append new nodes/groups to selection, modifying selection containers once.
+    // 1.
+    auto selectedNodes = impl::selectionExcept(_selectedNodes, {});
+    auto selectedGroups = impl::selectionExcept(_selectedGroups, {});
+    const auto selectionSize = selectedNodes.size() + selectedGroups.size();
+    for (const auto node : nodes) {
+        if (!impl::isSelectionCandidate(node))
+            continue;
+        const auto group = qobject_cast<qan::Group*>(node);
+        if (group != nullptr)
+            selectedGroups.push_back(group);
+        else
+            selectedNodes.push_back(node);
+    }
+    if (selectedNodes.size() + selectedGroups.size() == selectionSize)
+        return;     // Nothing to select
+
+    // 2.
+    beginSelectionBatch();
+    if (impl::setSelectionImpl(selectedNodes, _selectedNodes))
+        notifySelectionChanged();
+    if (impl::setSelectionImpl(selectedGroups, _selectedGroups))
+        notifySelectionChanged();
+    endSelectionBatch();
+}
+
+void    Graph::selectEdges(const std::vector<qan::Edge*>& edges)
+{
+    auto selectedEdges = impl::selectionExcept(_selectedEdges, {});
+    const auto selectionSize = selectedEdges.size();
+    for (const auto edge : edges)
+        if (impl::isSelectionCandidate(edge))
+            selectedEdges.push_back(edge);
+    if (selectedEdges.size() != selectionSize &&
+        impl::setSelectionImpl(selectedEdges, _selectedEdges))
+        notifySelectionChanged();
+}
+
+void    Graph::deselect(const std::vector<qan::Node*>& nodes)
+{
+    if (nodes.empty())
+        return;
+    const std::unordered_set<const QObject*> deselected(nodes.cbegin(), nodes.cend());
+    beginSelectionBatch();
+    if (impl::setSelectionImpl(impl::selectionExcept(_selectedNodes, deselected), _selectedNodes))
+        notifySelectionChanged();
+    if (impl::setSelectionImpl(impl::selectionExcept(_selectedGroups, deselected), _selectedGroups))
+        notifySelectionChanged();
+    endSelectionBatch();
+}
+
+void    Graph::deselect(const std::vector<qan::Edge*>& edges)
+{
+    if (edges.empty())
+        return;
+    const std::unordered_set<const QObject*> deselected(edges.cbegin(), edges.cend());
+    if (impl::setSelectionImpl(impl::selectionExcept(_selectedEdges, deselected), _selectedEdges))
+        notifySelectionChanged();
+}
+
+void    Graph::setSelection(const std::vector<qan::Node*>& nodes,
+                            const std::vector<qan::Group*>& groups,
+                            const std::vector<qan::Edge*>& edges)
+{
+    // Note: Already selected primitives are kept selected, new ones must be valid selection candidates.
+    const auto filter = [](const auto& primitives) {
+        std::remove_const_t<std::remove_reference_t<decltype(primitives)>> candidates;
+        candidates.reserve(primitives.size());
+        for (const auto primitive : primitives)
+            if (primitive != nullptr &&
+                primitive->getItem() != nullptr &&
+                (primitive->getItem()->getSelected() ||
+                 impl::isSelectionCandidate(primitive)))
+                candidates.push_back(primitive);
+        return candidates;
+    };
+    auto selectedNodes = filter(nodes);
+    auto selectedGroups = filter(groups);
+    for (auto it = selectedNodes.begin(); it != selectedNodes.end(); ) {  // Dispatch groups passed as nodes
+        const auto group = qobject_cast<qan::Group*>(*it);
+        if (group != nullptr) {
+            selectedGroups.push_back(group);
+            it = selectedNodes.erase(it);
+        } else
+            ++it;
+    }
+    beginSelectionBatch();
+    if (impl::setSelectionImpl(selectedNodes, _selectedNodes))
+        notifySelectionChanged();
+    if (impl::setSelectionImpl(selectedGroups, _selectedGroups))
+        notifySelectionChanged();
+    if (impl::setSelectionImpl(filter(edges), _selectedEdges))
+        notifySelectionChanged();
+    endSelectionBatch();
+}
+
+void    Graph::selectNodes(const QVariantList& nodes)
+{
+    std::vector<qan::Node*> selectedNodes;
+    std::vector<qan::Edge*> selectedEdges;
+    impl::dispatchPrimitives(nodes, selectedNodes, selectedEdges);
+    selectNodes(selectedNodes);
+}
+
+void    Graph::selectEdges(const QVariantList& edges)
+{
+    std::vector<qan::Node*> selectedNodes;
+    std::vector<qan::Edge*> selectedEdges;
+    impl::dispatchPrimitives(edges, selectedNodes, selectedEdges);
+    selectEdges(selectedEdges);
+}
+
+void    Graph::deselect(const QVariantList& primitives)
+{
+    std::vector<qan::Node*> nodes;
+    std::vector<qan::Edge*> edges;
+    impl::dispatchPrimitives(primitives, nodes, edges);
+    beginSelectionBatch();
+    deselect(nodes);
+    deselect(edges);
+    endSelectionBatch();
+}
+
+void    Graph::setSelection(const QVariantList& primitives)
+{
+    std::vector<qan::Node*> nodes;
+    std::vector<qan::Edge*> edges;
+    impl::dispatchPrimitives(primitives, nodes, edges);
+    setSelection(nodes, {}, edges);     // Note: groups are dispatched from nodes
+}
+
 void    Graph::selectAll()
 {
-    for (const auto node: get_nodes()) {
+    if (getSelectionPolicy() == SelectionPolicy::NoSelection)
+        return;
+    std::vector<qan::Node*> nodes;
+    nodes.reserve(static_cast<std::size_t>(get_node_count()));
+    for (const auto node: get_nodes())
         if (node != nullptr)
-            selectNode(*node, Qt::ControlModifier);
-    }
-    emit selectionChanged();
+            nodes.push_back(node);
+    selectNodes(nodes);
 }
 
 void    Graph::removeSelection()
 {
-    const auto& selectedNodes = getSelectedNodes();
-    for (const auto& node: qAsConst(selectedNodes))
+    // Note: Copy and clear selection before removing primitives, removing a primitive
+    // would otherwise modify selection containers while they are iterated. Edges might be
+    // destroyed with their source or destination nodes, keep track of them with QPointer.
+    const auto copySelection = [](const auto& selectedPrimitives) {
+        return std::vector<typename std::decay_t<decltype(selectedPrimitives)>::value_type>(selectedPrimitives.cbegin(),
+                                                                                           selectedPrimitives.cend());
+    };
+    const auto selectedNodes = copySelection(_selectedNodes.getContainer());
+    const auto selectedGroups = copySelection(_selectedGroups.getContainer());
+    const auto selectedEdges = copySelection(_selectedEdges.getContainer());
+    clearSelection();
+
+    for (const auto& node: selectedNodes)
         if (node &&
             !node->getIsProtected() &&
             !node->getLocked())
             removeNode(node);
 
-    const auto& selectedGroups = getSelectedGroups();
-    for (const auto& group: qAsConst(selectedGroups))
+    for (const auto& group: selectedGroups)
         if (group &&
             !group->getIsProtected() &&
             !group->getLocked())
             removeGroup(group);
 
-    const auto& selectedEdges = getSelectedEdges();
-    for (const auto& edge: qAsConst(selectedEdges))
+    for (const auto& edge: selectedEdges)
         if (edge &&
             !edge->getIsProtected() &&
             !edge->getLocked())
             removeEdge(edge);
-
-    clearSelection();
 }
 
 void    Graph::clearSelection()
 {
-    // Note: getItem()->setSelected() actually _modify_ content
-    // of _selectedNodes and _selectedGroups, a deep copy of theses
-    // container is necessary to avoid iterating on a vector that
-    // has changed while iterator has been modified.
-    SelectedNodes selectedNodesCopy;
-    std::copy(_selectedNodes.cbegin(),
-               _selectedNodes.cend(),
-               std::back_inserter(selectedNodesCopy));
-    for (auto node : selectedNodesCopy)
-        if (node != nullptr &&
-            node->getItem() != nullptr)
-            node->getItem()->setSelected(false);
-    _selectedNodes.clear();
-
-    SelectedGroups selectedGroupsCopy;
-    std::copy(_selectedGroups.cbegin(),
-              _selectedGroups.cend(),
-              std::back_inserter(selectedGroupsCopy));
-    for (auto group : selectedGroupsCopy)
-        if (group != nullptr &&
-            group->getItem() != nullptr)
-            group->getItem()->setSelected(false);
-    _selectedGroups.clear();
-
-    SelectedEdges selectedEdgesCopy;
-    std::copy(_selectedEdges.cbegin(),
-              _selectedEdges.cend(),
-              std::back_inserter(selectedEdgesCopy));
-    for (auto& edge : qAsConst(selectedEdgesCopy))
-        if (edge != nullptr &&
-            edge->getItem() != nullptr)
-            edge->getItem()->setSelected(false);
-    _selectedEdges.clear();
-
-    emit selectionChanged();
+    beginSelectionBatch();
+    impl::setSelectionImpl<qan::Node>({}, _selectedNodes);
+    impl::setSelectionImpl<qan::Group>({}, _selectedGroups);
+    impl::setSelectionImpl<qan::Edge>({}, _selectedEdges);
+    notifySelectionChanged();
+    endSelectionBatch();
 }
 
 bool    Graph::hasSelection() const
@@ -1472,6 +2580,33 @@ bool    Graph::hasMultipleSelection() const
             _selectedEdges.size()) > 1;
 }
 
+void    Graph::beginSelectionBatch() noexcept
+{
+    if (_selectionBatchDepth++ == 0)
+        _selectionBatchModified = false;
+}
+
+void    Graph::endSelectionBatch()
+{
+    if (_selectionBatchDepth <= 0) {
+        qWarning() << "qan::Graph::endSelectionBatch(): Error, no matching beginSelectionBatch() call.";
+        return;
+    }
+    if (--_selectionBatchDepth == 0 &&
+        _selectionBatchModified) {
+        _selectionBatchModified = false;
+        emit selectionChanged();
+    }
+}
+
+void    Graph::notifySelectionChanged()
+{
+    if (_selectionBatchDepth > 0)
+        _selectionBatchModified = true;
+    else
+        emit selectionChanged();
+}
+
 std::vector<QQuickItem*>    Graph::getSelectedItems() const
 {
     using item_vector_t = std::vector<QQuickItem*>;
@@ -1510,6 +2645,16 @@ bool    Graph::setSnapToGridSize(QSizeF snapToGridSize) noexcept
     return false;
 }
 
+bool    Graph::setCoalesceMoves(bool coalesceMoves) noexcept
+{
+    if (coalesceMoves != _coalesceMoves) {
+        _coalesceMoves = coalesceMoves;
+        emit coalesceMovesChanged();
+        return true;
+    }
+    return false;
+}
+
 void    Graph::alignSelectionHorizontalCenter() { alignHorizontalCenter(getSelectedItems()); }
 
 void    Graph::alignSelectionRight() { alignRight(getSelectedItems()); }
@@ -1520,6 +2665,84 @@ void    Graph::alignSelectionTop() { alignTop(getSelectedItems()); }
 
 void    Graph::alignSelectionBottom() { alignBottom(getSelectedItems()); }
 
+void    Graph::beginResizeSelection(qan::NodeItem* item)
+{
+    _selectionResizeItems.clear();
+    _resizeInitialSize = QSizeF{};
+    if (item == nullptr ||
+        !item->getSelected() ||
+        !hasMultipleSelection())
+        return;
+    _resizeInitialSize = QSizeF{item->width(), item->height()};
+    const auto collect = [this, item](qan::Node* node) {
+        if (node == nullptr ||
+            node->getLocked() ||
+            node->getIsProtected())
+            return;
+        const auto nodeItem = node->getItem();
+        if (nodeItem == nullptr ||
+            nodeItem == item ||
+            !nodeItem->getResizable() ||
+            nodeItem->getCollapsed())
+            return;
+        _selectionResizeItems.push_back(SelectionResizeItem{node, QSizeF{nodeItem->width(), nodeItem->height()}});
+        if (node->isGroup())
+            emit groupAboutToBeResized(qobject_cast<qan::Group*>(node));
+        else
+            emit nodeAboutToBeResized(node);
+    };
+    _selectionResizeItems.reserve(static_cast<std::size_t>(_selectedNodes.size() + _selectedGroups.size()));
+    for (const auto& selectedNode: _selectedNodes)
+        collect(selectedNode.data());
+    for (const auto& selectedGroup: _selectedGroups)
+        collect(selectedGroup.data());
+}
+
+void    Graph::endResizeSelection(qan::NodeItem* item)
+{
+    // ALGORITHM:
+        // Compute item scale since beginResizeSelection().
+        // Scale all recorded items initial size, respecting their minimum size, group content and ratio.
+        // Resize each item once.
+    const auto applyResize = [this, item]() {
+        if (item == nullptr ||
+            _resizeInitialSize.width() <= 0. ||
+            _resizeInitialSize.height() <= 0.)
+            return;
+        const auto sx = item->width() / _resizeInitialSize.width();
+        const auto sy = item->height() / _resizeInitialSize.height();
+        if (qFuzzyCompare(sx, 1.) &&
+            qFuzzyCompare(sy, 1.))
+            return;
+        for (const auto& resizeItem: _selectionResizeItems) {
+            const auto node = resizeItem.node.data();
+            const auto nodeItem = node != nullptr ? node->getItem() : nullptr;
+            if (nodeItem == nullptr)
+                continue;
+            QSizeF minimumSize = nodeItem->getMinimumSize();
+            const auto groupItem = qobject_cast<qan::GroupItem*>(nodeItem);
+            if (groupItem != nullptr &&
+                groupItem->getContainer() != nullptr) {    // Do not resize a group below its content
+                const auto childrenRect = groupItem->getContainer()->childrenRect();
+                if (!childrenRect.size().isEmpty())
+                    minimumSize = minimumSize.expandedTo(QSizeF{childrenRect.right(), childrenRect.bottom()});
+            }
+            QSizeF size{std::max(resizeItem.initialSize.width() * sx, minimumSize.width()),
+                        std::max(resizeItem.initialSize.height() * sy, minimumSize.height())};
+            if (nodeItem->getRatio() > 0.)
+                size.setHeight(size.width() * nodeItem->getRatio());
+            nodeItem->setSize(size);
+            if (node->isGroup())
+                emit groupResized(qobject_cast<qan::Group*>(node));
+            else
+                emit nodeResized(node);
+        }
+    };
+    applyResize();
+    _selectionResizeItems.clear();
+    _resizeInitialSize = QSizeF{};
+}
+
 void    Graph::alignHorizontalCenter(std::vector<QQuickItem*>&& items)
 {
     if (items.size() <= 1)
@@ -1856,45 +3079,135 @@ void    Graph::sendToBack(QQuickItem* item)
     nodeItem->setZ(z);
 }
 
+int     Graph::getGroupZRank(const qan::GroupItem* groupItem) const
+{
+    updateGroupsZOrder();
+    const auto rank = _groupsZRank.find(groupItem);
+    return rank != _groupsZRank.end() ? rank->second : -1;
+}
+
+void    Graph::invalidateGroupsZOrder() noexcept
+{
+    _groupsZOrderValid = false;
+    if (_edgeBatchRenderer)     // Batched edges are layered between root groups
+        _edgeBatchRenderer->invalidateLayers();
+}
+
+void    Graph::updateGroupsZOrder() const
+{
+    if (_groupsZOrderValid)
+        return;
+    // Note: O(G.log(G).depth), with G the group count, only when a group z or grouping has
+    // been modified since last update.
+    // Groups are ordered like Qt Quick stack them: a group z is only meaningfull relatively to
+    // it's sibling groups, and a nested group is always on top of it's host group. Group key is
+    // the z path from it's root group to the group, keys are compared lexicographically (an
+    // ancestor path is a prefix of, and thus is less than, it's nested groups paths).
+    std::vector<std::pair<std::vector<qreal>, const qan::GroupItem*>> groupItems;
+    groupItems.reserve(static_cast<std::size_t>(get_groups().size()));
+    for (const auto group : qAsConst(get_groups().getContainer())) {
+        if (group == nullptr ||
+            group->getGroupItem() == nullptr)
+            continue;
+        std::vector<qreal> zPath;
+        for (auto g = group; g != nullptr && g->getGroupItem() != nullptr; g = g->getGroup())
+            zPath.push_back(g->getGroupItem()->z());
+        std::reverse(zPath.begin(), zPath.end());
+        groupItems.push_back({std::move(zPath), group->getGroupItem()});
+    }
+    std::stable_sort(groupItems.begin(), groupItems.end(), [](const auto& g1, const auto& g2) -> bool {
+        return std::lexicographical_compare(g1.first.cbegin(), g1.first.cend(),
+                                            g2.first.cbegin(), g2.first.cend());
+    });
+    _groupsZRank.clear();
+    _groupsZRank.reserve(groupItems.size());
+    int rank = 0;
+    for (const auto& groupItem : groupItems)
+        _groupsZRank[groupItem.second] = rank++;
+    _groupsZOrderValid = true;
+}
+
 void    Graph::updateMinMaxZ() noexcept
 {
-    {
-        auto maxZIt = std::max_element(get_nodes().cbegin(), get_nodes().cend(),
-                                             [](const auto a, const auto b) {
-                                                 return a->getItem() != nullptr &&
-                                                        b->getItem() != nullptr &&
-                                                        a->getItem()->z() < b->getItem()->z();
-                                             });
+    setMaxZ(_zValues.empty() ? 0. : *_zValues.crbegin());
+    setMinZ(_zValues.empty() ? 0. : *_zValues.cbegin());
+}
 
-        const auto maxZ = maxZIt != get_nodes().end() &&
-                          (*maxZIt)->getItem() != nullptr ? (*maxZIt)->getItem()->z() : 0.;
-        setMaxZ(maxZ);
+void    Graph::renormalizeZ()
+{
+    // Algorithm:
+        // 1. Collect tracked items per parent item (ie graph container item or group container).
+        // 2. For all levels, sort items by z and set item z to its dense rank in level: Qt Quick stacking
+        //    order only depends on siblings z and children order, it is preserved.
+        // 3. Update minZ and maxZ from compacted values.
+    std::unordered_map<const QQuickItem*, std::vector<QQuickItem*>> levels;    // 1.
+    for (const auto& tracked : _trackedZ)
+        if (tracked.second.item != nullptr &&
+            tracked.second.item->parentItem() != nullptr)
+            levels[tracked.second.item->parentItem()].push_back(tracked.second.item);
+
+    for (auto& level : levels) {                                                // 2.
+        auto& items = level.second;
+        std::sort(items.begin(), items.end(), [](const auto a, const auto b) { return a->z() < b->z(); });
+        qreal rank = 0.;
+        qreal previousZ = items.front()->z();
+        for (const auto item : items) {
+            const auto z = item->z();   // Note: read before any modification, equal z keep an equal rank
+            if (z != previousZ) {
+                rank += 1.;
+                previousZ = z;
+            }
+            item->setZ(rank);           // Tracked z is updated from zChanged()
+        }
     }
+    updateMinMaxZ();                                                            // 3.
+}
 
-    {
-        auto minZIt = std::min_element(get_nodes().cbegin(), get_nodes().cend(),
-                                       [](const auto a, const auto b) {
-                                           return a->getItem() != nullptr &&
-                                                  b->getItem() != nullptr &&
-                                                  a->getItem()->z() < b->getItem()->z();
-                                       });
+qreal   Graph::zRenormalizationLimit() const noexcept
+{
+    // Note: Compacted z are less than tracked count, relative limit ensure at least
+    // max(threshold, N) nextMaxZ()/nextMinZ() calls between two O(N.log(N)) renormalizations.
+    const auto trackedCount = static_cast<qreal>(_trackedZ.size());
+    return trackedCount + std::max(zRenormalizationThreshold, trackedCount);
+}
 
-        const auto minZ = minZIt != get_nodes().end() &&
-                                  (*minZIt)->getItem() != nullptr ? (*minZIt)->getItem()->z() : 0.;
+void    Graph::trackItemZ(QQuickItem* item)
+{
+    if (item == nullptr ||
+        _trackedZ.find(item) != _trackedZ.end())
+        return;
+    _trackedZ.emplace(item, TrackedZ{item, _zValues.insert(item->z())});
+    connect(item, &QQuickItem::zChanged, this, [this, item]() {
+        auto tracked = _trackedZ.find(item);
+        if (tracked != _trackedZ.end()) {   // O(log(N)) z update
+            _zValues.erase(tracked->second.z);
+            tracked->second.z = _zValues.insert(item->z());
+        }
+    });
+    // Note: item is never dereferenced once destroyed, it is just used as a key
+    connect(item, &QObject::destroyed, this, [this, item]() { untrackItemZ(item); });
+}
 
-        setMinZ(minZ);
+void    Graph::untrackItemZ(const QObject* item)
+{
+    const auto tracked = _trackedZ.find(item);
+    if (tracked != _trackedZ.end()) {
+        _zValues.erase(tracked->second.z);
+        _trackedZ.erase(tracked);
     }
 }
 
 qreal   Graph::getMaxZ() const noexcept { return _maxZ; }
 void    Graph::setMaxZ(const qreal maxZ) noexcept
 {
-    _maxZ = std::min(200000., maxZ);
+    _maxZ = maxZ;
     emit maxZChanged();
 }
 
 qreal   Graph::nextMaxZ() noexcept
 {
+    if (_maxZ + 1. > zRenormalizationLimit())
+        renormalizeZ();
     _maxZ += 1.;
     emit maxZChanged();
     return _maxZ;
@@ -1909,12 +3222,14 @@ void    Graph::updateMaxZ(const qreal z) noexcept
 qreal   Graph::getMinZ() const noexcept { return _minZ; }
 void    Graph::setMinZ(const qreal minZ) noexcept
 {
-    _minZ = std::max(-200000., minZ);
+    _minZ = minZ;
     emit minZChanged();
 }
 
 qreal   Graph::nextMinZ() noexcept
 {
+    if (_minZ - 1. < -zRenormalizationLimit())
+        renormalizeZ();
     _minZ -= 1.;
     emit minZChanged();
     return _minZ;
@@ -37,6 +37,13 @@
 #include "./gtpo/node.h"
 #include "./gtpo/graph.h"
 
+// Std headers
+#include <memory>
+#include <set>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
 // Qt headers
 #include <QString>
 #include <QQuickItem>
@@ -54,6 +61,12 @@
 #include "./qanNavigable.h"
 #include "./qanSelectable.h"
 #include "./qanConnector.h"
+#include "./qanSpatialIndex.h"
+#include "./qanSelectionOverlay.h"
+#include "./qanEdgeBatchRenderer.h"
+#include "./qanEdgeGeometryStore.h"
+#include "./qanDelegatePool.h"
+#include "./qanDelegateIncubator.h"
 
 
 //! Main QuickQanava namespace
@@ -168,11 +181,177 @@ public:
      */
     Q_INVOKABLE QQuickItem* graphChildAt(qreal x, qreal y) const;
 
-    /*! \brief Similar to QQuickItem::childAt() method, except that it only take groups into account (and is hence faster, but still O(n)).
+    /*! \brief Similar to QQuickItem::childAt() method, except that it only take groups into account.
      *
      * \arg except Return every compatible group except \c except (can be nullptr).
      */
     Q_INVOKABLE qan::Group* groupAt(const QPointF& p, const QSizeF& s, const QQuickItem* except = nullptr) const;
+
+    /*! \brief Return visible graph items (nodes, groups and edges) whose bounding rect intersect \c rect.
+     *
+     * \c rect is expressed in graph \c containerItem CS. Query use the graph spatial index and do not
+     * iterate over all graph items, returned items are unordered.
+     */
+    Q_INVOKABLE QList<QQuickItem*>  itemsInRect(const QRectF& rect) const;
+
+public:
+    /*! \brief Spatial index of node, group and edge items bounding rects, expressed in \c containerItem CS.
+     *
+     * Index is updated incrementally on items x/y/width/height changes, grouped node rect are updated when
+     * their group is moved.
+     */
+    const qan::SpatialIndex&    getSpatialIndex() const noexcept { return _spatialIndex; }
+
+    //! Update \c item rect in spatial index, \c item content is updated too when \c item is a group.
+    void                        updateSpatialIndex(QQuickItem* item);
+protected:
+    //! Register \c item in spatial index and monitor it's geometry changes.
+    void                        registerSpatialItem(QQuickItem* item);
+    //! Rebuild spatial index for all graph items (ie when the container item is modified).
+    void                        rebuildSpatialIndex();
+private:
+    //! \copydoc getSpatialIndex()
+    qan::SpatialIndex           _spatialIndex;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Viewport Culling Management *///---------------------------------
+    //@{
+public:
+    /*! \brief Exclude node, group and edge items outside culling rect from scene graph (default to false).
+     *
+     * When enabled, only items whose bounding rect intersect \c cullingRect are rendered, other items are culled
+     * until they enter culling rect again. Graph topology is not modified, and culling never modify items \c visible
+     * property: culled items are skipped at scene graph level (like Qt Quick views culled delegates), \c visible
+     * remains under user (or collapse code) control and is taken into account once items are unculled.
+     *
+     * \note Scene graph culling require Qt Quick private module (\c Qt6::QuickPrivate, a separate development
+     * package since Qt 6.9), when it is not found at configuration, culled items are hidden with \c visible
+     * instead: items hidden by culling are shown again once unculled, even if they have been hidden meanwhile.
+     *
+     * \note Culled items are only excluded from rendering, their delegates are not released in delegate
+     * pool (see delegatePooling).
+     *
+     * Culling rect is usually updated by qan::GraphView (see qan::GraphView::viewportCulling), culled items are
+     * updated once per frame.
+     */
+    Q_PROPERTY(bool viewportCulling READ getViewportCulling WRITE setViewportCulling NOTIFY viewportCullingChanged FINAL)
+    bool            setViewportCulling(bool viewportCulling) noexcept;
+    inline bool     getViewportCulling() const noexcept { return _viewportCulling; }
+private:
+    bool            _viewportCulling = false;
+signals:
+    void            viewportCullingChanged();
+
+public:
+    //! Set current culling rect in \c containerItem CS (usually view rect with a margin), update is delayed until next frame.
+    void            setCullingRect(const QRectF& cullingRect) noexcept;
+    inline QRectF   getCullingRect() const noexcept { return _cullingRect; }
+    //! Return true if \c item is currently culled (ie not rendered because it is outside culling rect).
+    inline bool     isCulled(const QQuickItem* item) const noexcept { return _culledItems.find(const_cast<QQuickItem*>(item)) != _culledItems.end(); }
+    //! Immediately update culled items for current culling rect.
+    void            updateCulling();
+protected:
+    //! Update \c item culling state for it's new \c rect (expressed in container CS).
+    void            updateItemCulling(QQuickItem* item, const QRectF& rect);
+    //! Render again all culled items.
+    void            uncullAll();
+private:
+    void            cullItem(QQuickItem* item);
+    void            uncullItem(QQuickItem* item);
+    //! Forget \c item culling state before it is pooled or removed from graph.
+    void            forgetCulledItem(QQuickItem* item);
+    //! Exclude (or include again) \c item from rendering, using scene graph culling when available.
+    void            setItemCulled(QQuickItem* item, bool culled);
+
+    QRectF          _cullingRect;
+    bool            _cullingDirty = false;
+    //! Items currently culled (excluded from scene graph, independently of their visibility).
+    std::unordered_set<QQuickItem*> _culledItems;
+    //! Items intersecting culling rect during last updateCulling().
+    std::unordered_set<QQuickItem*> _unculledItems;
+    //! Culled items hidden with \c visible (only when Qt Quick private module is unavailable).
+    std::unordered_set<QQuickItem*> _cullingHiddenItems;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Level of Detail Management *///--------------------------------
+    //@{
+public:
+    /*! \brief Adapt node, group and edge delegates level of detail to view zoom (default to false).
+     *
+     * When enabled, graph \c lod is updated from view zoom (usually by qan::GraphView) and propagated to every node,
+     * group and edge item \c lod property:
+     * \li zoom >= \c simplifiedLodZoom: \c Full detail.
+     * \li \c minimalLodZoom <= zoom < \c simplifiedLodZoom: \c Simplified, default delegates disable effects, docks
+     * and ports and abbreviate labels.
+     * \li zoom < \c minimalLodZoom: \c Minimal, delegates content is hidden, groups and nodes are drawn as solid rects
+     * and edges as straight lines by a single qan::EdgeBatchRenderer.
+     *
+     * To avoid flickering when zoom oscillate around a threshold, a finer level is restored only once zoom is above
+     * threshold * (1 + \c lodHysteresis). Level changes are the only operation proportional to items count, zooming
+     * within a level is free. Custom delegates should bind to their \c lod property.
+     */
+    Q_PROPERTY(bool levelOfDetail READ getLevelOfDetail WRITE setLevelOfDetail NOTIFY levelOfDetailChanged FINAL)
+    bool            setLevelOfDetail(bool levelOfDetail) noexcept;
+    inline bool     getLevelOfDetail() const noexcept { return _levelOfDetail; }
+private:
+    bool            _levelOfDetail = false;
+signals:
+    void            levelOfDetailChanged();
+
+public:
+    //! Zoom under which graph switch to \c Simplified level of detail (default to 0.5).
+    Q_PROPERTY(qreal simplifiedLodZoom READ getSimplifiedLodZoom WRITE setSimplifiedLodZoom NOTIFY simplifiedLodZoomChanged FINAL)
+    bool            setSimplifiedLodZoom(qreal simplifiedLodZoom) noexcept;
+    inline qreal    getSimplifiedLodZoom() const noexcept { return _simplifiedLodZoom; }
+private:
+    qreal           _simplifiedLodZoom = 0.5;
+signals:
+    void            simplifiedLodZoomChanged();
+
+public:
+    //! Zoom under which graph switch to \c Minimal level of detail (default to 0.2).
+    Q_PROPERTY(qreal minimalLodZoom READ getMinimalLodZoom WRITE setMinimalLodZoom NOTIFY minimalLodZoomChanged FINAL)
+    bool            setMinimalLodZoom(qreal minimalLodZoom) noexcept;
+    inline qreal    getMinimalLodZoom() const noexcept { return _minimalLodZoom; }
+private:
+    qreal           _minimalLodZoom = 0.2;
+signals:
+    void            minimalLodZoomChanged();
+
+public:
+    //! Relative zoom margin above a threshold required to restore a finer level of detail (default to 0.15, ie 15%).
+    Q_PROPERTY(qreal lodHysteresis READ getLodHysteresis WRITE setLodHysteresis NOTIFY lodHysteresisChanged FINAL)
+    bool            setLodHysteresis(qreal lodHysteresis) noexcept;
+    inline qreal    getLodHysteresis() const noexcept { return _lodHysteresis; }
+private:
+    qreal           _lodHysteresis = 0.15;
+signals:
+    void            lodHysteresisChanged();
+
+public:
+    //! Current graph level of detail (always \c Full when \c levelOfDetail is disabled).
+    Q_PROPERTY(qan::NodeItem::Lod lod READ getLod NOTIFY lodChanged FINAL)
+    inline qan::NodeItem::Lod   getLod() const noexcept { return _lod; }
+    //! Set current view zoom used to select level of detail (usually called from qan::GraphView).
+    void                        setLodZoom(qreal lodZoom) noexcept;
+    inline qreal                getLodZoom() const noexcept { return _lodZoom; }
+
+    /*! \brief Return level of detail for \c zoom when current level is \c lod (see \c levelOfDetail for thresholds and hysteresis).
+     *
+     * \note Pure function, exposed mainly for testing purposes.
+     */
+    static qan::NodeItem::Lod   lodForZoom(qan::NodeItem::Lod lod, qreal zoom,
+                                           qreal simplifiedLodZoom, qreal minimalLodZoom, qreal lodHysteresis) noexcept;
+private:
+    //! Select level of detail for current zoom and propagate it to items if it has changed.
+    void                        updateLod() noexcept;
+
+    qan::NodeItem::Lod          _lod = qan::NodeItem::Lod::Full;
+    qreal                       _lodZoom = 1.;
+signals:
+    void                        lodChanged();
     //@}
     //-------------------------------------------------------------------------
 
@@ -290,6 +469,29 @@ signals:
 private:
     std::unique_ptr<QQmlComponent> _groupDelegate;
 
+public:
+    /*! \brief Use C++ qan::NativeNodeItem and qan::NativeEdgeItem instead of default Node.qml and Edge.qml delegates (default to false).
+     *
+     * Native delegates draw node background, border, label and edge lines directly in scene graph nodes from
+     * qan::NodeStyle and qan::EdgeStyle: there is no QML object per node or edge, creating and rendering large graphs
+     * is significantly faster. Only primitives using default delegates are affected, custom delegates are still
+     * created from their QML component. Modifying \c nativeDelegates do not affect existing items.
+     *
+     * \note Native nodes do not support inline label edition.
+     */
+    Q_PROPERTY(bool nativeDelegates READ getNativeDelegates WRITE setNativeDelegates NOTIFY nativeDelegatesChanged FINAL)
+    bool            setNativeDelegates(bool nativeDelegates) noexcept;
+    inline bool     getNativeDelegates() const noexcept { return _nativeDelegates; }
+private:
+    bool            _nativeDelegates = false;
+signals:
+    void            nativeDelegatesChanged();
+
+private:
+    //! Create a native item for \c node or \c edge if \c nativeDelegates is set and \c component is a default delegate, return nullptr otherwise.
+    QQuickItem*     createNativeItem(QQmlComponent& component, qan::Style& style,
+                                     qan::Node* node, qan::Edge* edge) noexcept;
+
 protected:
     //! Create a _styleable_ graph primitive using the given delegate \c component with either a source \c node or \c edge.
     QQuickItem*             createFromComponent(QQmlComponent* component,
@@ -306,6 +508,9 @@ public:
      *
      *  \note Using setSelectionDelegate(nullptr) from c++ or Qan.Graph.selectionDelegate=null from QML is valid, QuickQanava will
      *  default to a basic selection item delegate.
+     *
+     *  \note Per item selection items are created only when a custom delegate is set or when \c selectionOverlayEnabled
+     *  is false, default selection is drawn with a shared qan::SelectionOverlay.
      */
     Q_PROPERTY(QQmlComponent* selectionDelegate READ getSelectionDelegate WRITE setSelectionDelegate NOTIFY selectionDelegateChanged FINAL)
     //! \copydoc selectionDelegate
@@ -336,6 +541,9 @@ protected:
     using unique_qptr = std::unique_ptr<T, QObjectDeleteLater>;
 
     std::unique_ptr<QQmlComponent>  _selectionDelegate{nullptr};
+private:
+    //! True when \c selectionDelegate has been set to a user defined component.
+    bool                            _customSelectionDelegate = false;
 private:
     //! Secure factory for QML components, errors are reported on stderr.
     std::unique_ptr<QQmlComponent>  createComponent(const QString& url);
@@ -344,6 +552,140 @@ private:
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Delegate Pooling Management *///--------------------------------
+    //@{
+public:
+    /*! \brief Recycle node, group and edge items of removed primitives instead of destroying them (default to false).
+     *
+     * When enabled, removeNode(), removeGroup(), removeEdge() and clear() release removed primitives items
+     * (including edges removed with their source or destination node) in a per component and style pool, the
+     * next insertNode(), insertGroup() or insertEdge() with the same delegate component and style reuse a
+     * pooled item instead of creating a new one from QML component.
+     *
+     * Pooled items are reset (node, group or edge set to nullptr, graph connections removed, unselected, hidden,
+     * geometry and state restored to delegate defaults, see qan::NodeItem::recycle()), node ports items are
+     * destroyed. Custom delegates with a transient state should reset it in qan::NodeItem::pooled() or
+     * qan::EdgeItem::pooled() handler (or initialize it in \c reused() handler).
+     *
+     * \note A group is pooled only once its content has been ungrouped or removed. Setting \c delegatePooling
+     * to false clear the pool.
+     */
+    Q_PROPERTY(bool delegatePooling READ getDelegatePooling WRITE setDelegatePooling NOTIFY delegatePoolingChanged FINAL)
+    bool            setDelegatePooling(bool delegatePooling) noexcept;
+    inline bool     getDelegatePooling() const noexcept { return _delegatePooling; }
+private:
+    bool            _delegatePooling = false;
+signals:
+    void            delegatePoolingChanged();
+
+public:
+    //! Delegate pool used when \c delegatePooling is enabled (pool capacity could be configured from c++).
+    qan::DelegatePool&          getDelegatePool() noexcept { return _delegatePool; }
+    const qan::DelegatePool&    getDelegatePool() const noexcept { return _delegatePool; }
+
+    //! Number of node or edge items reused from delegate pool.
+    Q_INVOKABLE int     getDelegatePoolHits() const noexcept;
+    //! Number of node or edge items created while \c delegatePooling was enabled because no pooled item was available.
+    Q_INVOKABLE int     getDelegatePoolMisses() const noexcept;
+    //! Number of items currently stored in delegate pool.
+    Q_INVOKABLE int     getDelegatePoolSize() const noexcept;
+
+protected:
+    /*! \brief Release \c node (or group) item in delegate pool, \c node item is detached from \c node.
+     *
+     * \return true if item has been pooled, false if item can't be pooled (it is then destroyed with \c node).
+     */
+    bool                poolNodeItem(qan::Node& node);
+    //! \copydoc poolNodeItem()
+    bool                poolEdgeItem(qan::Edge& edge);
+    //! Release \c node in and out edges items in delegate pool (edges are removed implicitly with \c node).
+    void                poolAdjacentEdgeItems(qan::Node& node);
+private:
+    //! Bind a pooled item created from \c component with \c style to \c node, \c edge or \c group, return nullptr if there is no pooled item.
+    QQuickItem*         reusePooledItem(QQmlComponent& component, qan::Style& style,
+                                        qan::Node* node, qan::Edge* edge, qan::Group* group) noexcept;
+    //! Save \c item delegate defaults once it has been created (see qan::NodeItem::saveDelegateDefaults()).
+    static void         saveDelegateDefaults(QQuickItem* item) noexcept;
+
+    qan::DelegatePool   _delegatePool;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Asynchronous Insertion Management *///--------------------------
+    //@{
+public:
+    /*! \brief Create node and edge delegates asynchronously with QQmlIncubator (default to false).
+     *
+     * When enabled, insertNode() and insertEdge() insert topology immediately, but visual items are incubated
+     * asynchronously, within \c incubationBudget ms per frame: bulk insertion of thousands of nodes no longer
+     * block GUI thread. Node and edge items are attached to their primitive once ready, edges are bound to their
+     * source and destination items once both exist. \c pendingItems is the number of items not yet ready,
+     * \c itemsReady() is emitted when all items are ready.
+     *
+     * \warning While an item is incubated, qan::Node::getItem() or qan::Edge::getItem() return nullptr: code
+     * accessing items after insertion (positionning, port binding, etc.) should wait for \c itemsReady().
+     * \note Asynchronous insertion is used only when graph is in a window, groups are always created synchronously.
+     */
+    Q_PROPERTY(bool asynchronousInsertion READ getAsynchronousInsertion WRITE setAsynchronousInsertion NOTIFY asynchronousInsertionChanged FINAL)
+    bool            setAsynchronousInsertion(bool asynchronousInsertion) noexcept;
+    inline bool     getAsynchronousInsertion() const noexcept { return _asynchronousInsertion; }
+private:
+    bool            _asynchronousInsertion = false;
+signals:
+    void            asynchronousInsertionChanged();
+
+public:
+    //! Maximum time spent incubating delegates per frame in ms when \c asynchronousInsertion is enabled (default to 5ms, minimum 1ms).
+    Q_PROPERTY(int incubationBudget READ getIncubationBudget WRITE setIncubationBudget NOTIFY incubationBudgetChanged FINAL)
+    bool            setIncubationBudget(int incubationBudget) noexcept;
+    inline int      getIncubationBudget() const noexcept { return _incubationBudget; }
+private:
+    int             _incubationBudget = 5;
+signals:
+    void            incubationBudgetChanged();
+
+public:
+    //! Number of node and edge items still incubated (see \c asynchronousInsertion).
+    Q_PROPERTY(int pendingItems READ getPendingItems NOTIFY pendingItemsChanged FINAL)
+    inline int      getPendingItems() const noexcept { return _pendingItems; }
+private:
+    int             _pendingItems = 0;
+signals:
+    void            pendingItemsChanged();
+    //! Emitted when all pending items are ready (ie when \c pendingItems become 0).
+    void            itemsReady();
+
+protected:
+    //! Return true if \c asynchronousInsertion is enabled and could be used (graph is in a window with a QML context).
+    bool            useAsynchronousInsertion() const noexcept;
+
+    /*! \brief Start asynchronous creation of a \c node or \c edge item from \c component.
+     *
+     * \return A pooled item immediately available (see \c delegatePooling), or nullptr while the item is incubated.
+     */
+    QQuickItem*     incubateFromComponent(QQmlComponent* component,
+                                          qan::Style& style,
+                                          qan::Node* node = nullptr,
+                                          qan::Edge* edge = nullptr) noexcept;
+
+private:
+    friend class qan::DelegateIncubator;
+    //! Incubate pending items within \c incubationBudget, called once per frame while items are pending.
+    void            incubateDelegates();
+    //! Configure an incubated \c object before it's bindings are evaluated (called from qan::DelegateIncubator).
+    void            initializeIncubatedItem(qan::DelegateIncubator& incubator, QObject* object);
+    //! Attach incubated item to it's node or edge once ready (called from qan::DelegateIncubator).
+    void            delegateIncubated(qan::DelegateIncubator& incubator);
+    //! Abort all incubations in progress.
+    void            clearIncubators() noexcept;
+
+    std::vector<std::unique_ptr<qan::DelegateIncubator>>    _incubators;
+    //! Incubation controller installed on QML engine when engine has none (usually a window controller is available).
+    std::unique_ptr<QQmlIncubationController>               _incubationController;
+    QMetaObject::Connection                                 _incubationFrameConnection;
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Graph Node Management *///---------------------------------------
     //@{
 public:
@@ -402,6 +744,10 @@ public:
     //! Return true if \c node is registered in graph.
     bool                    hasNode(const qan::Node* node) const;
 
+private:
+    //! Bind \c nodeItem to \c node, monitor item clicks and geometry, and bind edges waiting for this item.
+    void                    configureNodeItem(qan::Node& node, qan::NodeItem& nodeItem);
+
 public:
     //! Access the list of nodes with an abstract item model interface.
     Q_PROPERTY(QAbstractItemModel* nodes READ getNodesModel CONSTANT FINAL)
@@ -533,6 +879,8 @@ private:
      */
     bool                    configureEdge(qan::Edge& source, QQmlComponent& edgeComponent, qan::EdgeStyle& style,
                                           qan::Node& src, qan::Node* dst);
+    //! Bind \c edgeItem to \c edge, it's source and destination items (if they already exist) and monitor item clicks.
+    void                    configureEdgeItem(qan::Edge& edge, qan::EdgeItem& edgeItem);
 public:
     template <class Edge_t>
     qan::Edge*              insertNonVisualEdge(qan::Node& src, qan::Node* dstNode);
@@ -579,6 +927,48 @@ signals:
     /*! \brief Emitted immediately _before_ an edge is removed.
      */
     void            onEdgeRemoved(qan::Edge* edge);
+
+public:
+    /*! \brief Queue an \c edgeItem geometry update, all queued edges are updated once before next frame.
+     *
+     * Edges source and destination x/y/z/width/height changes are routed to this queue (see
+     * qan::EdgeItem::scheduleUpdateItem()): moving a node update its adjacent edges only once per frame.
+     * When graph is not in a window, \c edgeItem is updated immediately.
+     */
+    void            scheduleEdgeUpdate(qan::EdgeItem* edgeItem);
+    //! Immediately update all edges queued with scheduleEdgeUpdate().
+    void            flushEdgeUpdates();
+protected:
+    //! Flush the edge update queue.
+    virtual void    updatePolish() override;
+private:
+    //! Edges waiting for an update, an edge is queued at most once (see qan::EdgeItem::isUpdateScheduled()).
+    std::vector<QPointer<qan::EdgeItem>>    _dirtyEdges;
+    //! Structure of arrays geometry for dirty edges updated in batch (see qan::EdgeItem::storeGeometry()).
+    qan::EdgeGeometryStore                  _edgeGeometryStore;
+    //! Edges packed in _edgeGeometryStore, edge index in store is its index in this vector.
+    std::vector<QPointer<qan::EdgeItem>>    _storedEdges;
+
+public:
+    /*! \brief Draw all edges with a single qan::EdgeBatchRenderer instead of per edge delegate shapes (default to false).
+     *
+     * When enabled, existing and inserted edge items \c batchRendered property is set to true, default edge
+     * delegate then do not instantiate any visual content. Edges are drawn under nodes, and stacked with
+     * root groups according to their edge item z (ie an edge between grouped nodes is drawn on top of
+     * its group). Edge items are still used for selection and hit testing.
+     */
+    Q_PROPERTY(bool edgeBatchRendering READ getEdgeBatchRendering WRITE setEdgeBatchRendering NOTIFY edgeBatchRenderingChanged FINAL)
+    bool            setEdgeBatchRendering(bool edgeBatchRendering) noexcept;
+    inline bool     getEdgeBatchRendering() const noexcept { return _edgeBatchRendering; }
+    //! Edge batch renderer, nullptr until \c edgeBatchRendering is enabled or \c Minimal level of detail is used.
+    inline qan::EdgeBatchRenderer*  getEdgeBatchRenderer() const noexcept { return _edgeBatchRenderer.data(); }
+private:
+    //! Create, show or hide edge batch renderer according to \c edgeBatchRendering and current \c lod.
+    void                                updateEdgeBatchRenderer();
+    bool                                _edgeBatchRendering = false;
+    QPointer<qan::EdgeBatchRenderer>    _edgeBatchRenderer;
+signals:
+    void            edgeBatchRenderingChanged();
     //@}
     //-------------------------------------------------------------------------
 
@@ -736,10 +1126,32 @@ private:
 signals:
     void            selectionMarginChanged();
 
+public:
+    /*! \brief Draw nodes and groups selection outlines with a single shared scene graph node (default to true).
+     *
+     * When enabled, per item \c selectionDelegate instances are created only if a custom \c selectionDelegate
+     * has been set, selecting thousands of items then cost no QML object creation. Edges selection is
+     * not affected (it is drawn directly in edge delegate).
+     */
+    Q_PROPERTY(bool selectionOverlayEnabled READ getSelectionOverlayEnabled WRITE setSelectionOverlayEnabled NOTIFY selectionOverlayEnabledChanged FINAL)
+    bool            setSelectionOverlayEnabled(bool selectionOverlayEnabled) noexcept;
+    inline bool     getSelectionOverlayEnabled() const noexcept { return _selectionOverlayEnabled; }
+    //! Return true when selection is actually drawn with the selection overlay (overlay enabled and no custom \c selectionDelegate).
+    inline bool     isSelectionOverlayActive() const noexcept { return _selectionOverlayEnabled && !_customSelectionDelegate; }
+    //! Shared selection overlay, parented to \c containerItem.
+    inline qan::SelectionOverlay*   getSelectionOverlay() const noexcept { return _selectionOverlay.data(); }
+private:
+    bool                            _selectionOverlayEnabled = true;
+    QPointer<qan::SelectionOverlay> _selectionOverlay;
+signals:
+    void            selectionOverlayEnabledChanged();
+
 protected:
     /*! \brief Force a call to qan::Selectable::configureSelectionItem() call on all currently selected primitives (either nodes or group).
      */
     void            configureSelectionItems() noexcept;
+    //! Create or remove per item selection items when switching between selection overlay and selection delegates.
+    void            updateSelectionRendering() noexcept;
 
 public:
     /*! \brief Request insertion of a node in the current selection according to current policy and return true if the node was successfully selected.
@@ -790,15 +1202,69 @@ public:
     //! Remove all selected nodes and groups and clear selection.
     Q_INVOKABLE void    removeSelection();
 
-    //! Clear the current selection.
+    //! Clear the current selection (selection containers are modified once, \c selectionChanged() is emitted once).
     Q_INVOKABLE void    clearSelection();
 
+public:
+    /*! \brief Add \c nodes (either nodes or groups) to the current selection.
+     *
+     * Locked, non selectable or already selected nodes are ignored, graph \c selectionPolicy is not
+     * taken into account. Selection containers are modified only once and \c selectionChanged() is
+     * emitted at most once.
+     */
+    void                selectNodes(const std::vector<qan::Node*>& nodes);
+    //! \copydoc selectNodes()
+    void                selectEdges(const std::vector<qan::Edge*>& edges);
+
+    //! Remove \c nodes (either nodes or groups) from the current selection, see selectNodes().
+    void                deselect(const std::vector<qan::Node*>& nodes);
+    //! \copydoc deselect()
+    void                deselect(const std::vector<qan::Edge*>& edges);
+
+    /*! \brief Replace current selection with \c nodes, \c groups and \c edges.
+     *
+     * Primitives that are not part of new selection are deselected, see selectNodes() for
+     * selection candidates filtering and notification.
+     */
+    void                setSelection(const std::vector<qan::Node*>& nodes,
+                                     const std::vector<qan::Group*>& groups,
+                                     const std::vector<qan::Edge*>& edges);
+
+    /*! \brief QML interface for bulk selection, \c nodes, \c edges or \c primitives are lists of qan::Node, qan::Group or qan::Edge.
+     *
+     * Bulk selection methods taking std::vector are not invokable from QML, theses overloads dispatch primitives
+     * from a QML list (other objects are ignored) and forward to them, \c selectionChanged() is emitted at most once.
+     */
+    Q_INVOKABLE void    selectNodes(const QVariantList& nodes);
+    //! \copydoc selectNodes(const QVariantList&)
+    Q_INVOKABLE void    selectEdges(const QVariantList& edges);
+    //! \copydoc selectNodes(const QVariantList&)
+    Q_INVOKABLE void    deselect(const QVariantList& primitives);
+    //! \copydoc selectNodes(const QVariantList&)
+    Q_INVOKABLE void    setSelection(const QVariantList& primitives);
+
     //! Return true if either a nodes, groups, edges (or multiple nodes, groups, edges) is selected.
     Q_INVOKABLE bool    hasSelection() const;
 
     //! Return true if multiple nodes, groups or edges are selected.
     Q_INVOKABLE bool    hasMultipleSelection() const;
 
+public:
+    /*! \brief Begin a selection batch, \c selectionChanged() is emitted only once at the matching endSelectionBatch() call.
+     *
+     * \c selectionChanged() is not emitted at the end of the batch if selection has not been modified, batches
+     * might be nested.
+     */
+    void                beginSelectionBatch() noexcept;
+    //! \copydoc beginSelectionBatch()
+    void                endSelectionBatch();
+protected:
+    //! Emit \c selectionChanged(), or defer emission to the end of the current selection batch.
+    void                notifySelectionChanged();
+private:
+    int                 _selectionBatchDepth = 0;
+    bool                _selectionBatchModified = false;
+
 public:
     using SelectedNodes = qcm::Container<std::vector, QPointer<qan::Node>>;
 
@@ -875,6 +1341,20 @@ private:
 signals:
     void            snapToGridSizeChanged();
 
+public:
+    /*! \brief Coalesce nodes, groups and edges drag moves to a single move per frame (default to true).
+     *
+     * When true, only the latest pointer position received during a frame is applied (see qan::MoveCoalescer),
+     * drag end position is always the exact last pointer position.
+     */
+    Q_PROPERTY(bool coalesceMoves READ getCoalesceMoves WRITE setCoalesceMoves NOTIFY coalesceMovesChanged FINAL)
+    bool            setCoalesceMoves(bool coalesceMoves) noexcept;
+    bool            getCoalesceMoves() const noexcept { return _coalesceMoves; }
+private:
+    bool            _coalesceMoves = true;
+signals:
+    void            coalesceMovesChanged();
+
 public:
     //! \brief Align selected nodes/groups items horizontal center.
     Q_INVOKABLE void    alignSelectionHorizontalCenter();
@@ -897,6 +1377,25 @@ protected:
     void    alignTop(std::vector<QQuickItem*>&& items);
     //! \brief Align \c items bottom.
     void    alignBottom(std::vector<QQuickItem*>&& items);
+
+public:
+    /*! \brief Record selected nodes/groups initial size before selected \c item is resized with a resizer.
+     *
+     * When \c item resize ends, call endResizeSelection(): \c item scale factor is then applied to all other
+     * selected nodes and groups in a single batch (one size update per item). Locked, protected, collapsed or
+     * non resizable items are ignored.
+     */
+    Q_INVOKABLE void    beginResizeSelection(qan::NodeItem* item);
+    //! Apply \c item scale factor since beginResizeSelection() to selected nodes/groups items.
+    Q_INVOKABLE void    endResizeSelection(qan::NodeItem* item);
+private:
+    struct SelectionResizeItem {
+        QPointer<qan::Node> node;
+        QSizeF              initialSize;
+    };
+    //! Resized item size at the beginning of a selection resize.
+    QSizeF                              _resizeInitialSize{};
+    std::vector<SelectionResizeItem>    _selectionResizeItems;
     //@}
     //-------------------------------------------------------------------------
 
@@ -1022,13 +1521,49 @@ public:
     Q_INVOKABLE void    sendToBack(QQuickItem* item);
 
 public:
-    /*! \brief Iterate over all graph container items, find and update the minZ and maxZ property.
+    /*! \brief Update minZ and maxZ properties to tracked node and group items minimum and maximum z.
      *
-     * \note O(N) with N beeing the graph item count (might be quite costly, mainly defined to update
-     * maxZ after in serialization for example).
+     * \note O(log(N)) with N beeing the graph item count: items z are maintained in an ordered structure
+     * (mainly defined to update maxZ after serialization for example).
      */
     Q_INVOKABLE void    updateMinMaxZ() noexcept;
 
+    /*! \brief Compact node and group items z values without modifying visual stacking order.
+     *
+     * For every group level (ie items sharing the same parent item), items z are replaced by their dense
+     * rank in that level z ordering: items with equal z keep an equal z. Called automatically by
+     * nextMaxZ() and nextMinZ() when absolute z reach tracked items count plus the maximum of
+     * tracked items count and \c zRenormalizationThreshold (amortized O(log(N)) per call).
+     *
+     * \note O(N.log(N)) with N beeing the graph item count.
+     */
+    Q_INVOKABLE void    renormalizeZ();
+
+    //! Minimum z margin above tracked items count before sendToFront()/sendToBack() trigger a renormalizeZ().
+    static constexpr qreal  zRenormalizationThreshold = 100000.;
+    //! Absolute z value reached before nextMaxZ()/nextMinZ() trigger a renormalizeZ() (relative to tracked items count).
+    qreal               zRenormalizationLimit() const noexcept;
+
+    /*! \brief Track \c item z in graph z ordering, used for minZ/maxZ maintenance and renormalizeZ().
+     *
+     * \note Node and group items configured by graph are tracked automatically, items are untracked
+     * when destroyed.
+     */
+    void                trackItemZ(QQuickItem* item);
+    //! Stop tracking \c item z.
+    void                untrackItemZ(const QObject* item);
+    //! Return tracked items count.
+    std::size_t         getTrackedZCount() const noexcept { return _trackedZ.size(); }
+private:
+    //! Tracked items z in ascending order, minimum and maximum tracked z are accessed in O(1).
+    std::multiset<qreal>    _zValues;
+    struct TrackedZ {
+        QQuickItem*                             item = nullptr;
+        std::multiset<qreal>::const_iterator    z;
+    };
+    //! Tracked items, keyed by item (item is never dereferenced after its destruction).
+    std::unordered_map<const QObject*, TrackedZ>    _trackedZ;
+
     /*! \brief Maximum global z for nodes and groups (ie top-most item).
      *
      * \note By global we mean that z value for a node parented to a group is parent(s) group(s)
@@ -1063,6 +1598,25 @@ public:
     qreal               nextMinZ() noexcept;
     //! Update minimum z value if \c z is less than actual \c minZ value.
     Q_INVOKABLE void    updateMinZ(const qreal z) noexcept;
+
+public:
+    /*! \brief Return \c groupItem rank in groups global z ordering (0 for the bottom-most group, -1 if \c groupItem is unknown).
+     *
+     * Groups are ranked in their visual stacking order: sibling groups by z, nested groups above their host group.
+     *
+     * Groups global z ordering is cached and rebuilt lazily only after a group z change (ie sendToFront()
+     * or sendToBack()), group insertion/removal or grouping/ungrouping of a group.
+     */
+    int                 getGroupZRank(const qan::GroupItem* groupItem) const;
+    //! Invalidate cached groups global z ordering, next call to getGroupZRank() or groupAt() will rebuild it.
+    void                invalidateGroupsZOrder() noexcept;
+private:
+    //! Rebuild groups global z ordering cache if it has been invalidated.
+    void                updateGroupsZOrder() const;
+    //! \copydoc getGroupZRank()
+    mutable std::unordered_map<const qan::GroupItem*, int>  _groupsZRank;
+    //! \copydoc getGroupZRank()
+    mutable bool        _groupsZOrderValid = false;
     //@}
     //-------------------------------------------------------------------------
 
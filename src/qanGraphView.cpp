@@ -32,6 +32,10 @@
 // \date	2016 08 15
 //-----------------------------------------------------------------------------
 
+// Std headers
+#include <vector>
+#include <unordered_set>
+
 // Qt headers
 #include <QtNumeric>
 #include <QQuickItem>
@@ -48,6 +52,17 @@ GraphView::GraphView(QQuickItem* parent) :
     qan::Navigable{parent}
 {
     setFocus(true);
+
+    // Update culling rect on view pan, zoom and resize
+    const auto containerItem = getContainerItem();
+    if (containerItem != nullptr) {
+        connect(containerItem,  &QQuickItem::xChanged,      this,   &GraphView::updateCullingRect);
+        connect(containerItem,  &QQuickItem::yChanged,      this,   &GraphView::updateCullingRect);
+        connect(containerItem,  &QQuickItem::scaleChanged,  this,   &GraphView::updateCullingRect);
+    }
+    connect(this,   &QQuickItem::widthChanged,  this,   &GraphView::updateCullingRect);
+    connect(this,   &QQuickItem::heightChanged, this,   &GraphView::updateCullingRect);
+    connect(this,   &qan::Navigable::zoomChanged,   this,   &GraphView::updateLodZoom);
 }
 
 void    GraphView::setGraph(qan::Graph* graph)
@@ -92,12 +107,59 @@ void    GraphView::setGraph(qan::Graph* graph)
                 this,   &qan::GraphView::groupRightClicked);
         connect(_graph, &qan::Graph::groupDoubleClicked,
                 this,   &qan::GraphView::groupDoubleClicked);
+        _graph->setViewportCulling(_viewportCulling);
+        updateCullingRect();
+        updateLodZoom();
         emit graphChanged();
     }
 }
 //-----------------------------------------------------------------------------
 
 
+/* Viewport Culling Management *///--------------------------------------------
+void    GraphView::setViewportCulling(bool viewportCulling) noexcept
+{
+    if (viewportCulling == _viewportCulling)
+        return;
+    _viewportCulling = viewportCulling;
+    if (_graph) {
+        _graph->setViewportCulling(_viewportCulling);
+        updateCullingRect();
+    }
+    emit viewportCullingChanged();
+}
+
+void    GraphView::setViewportCullingMargin(qreal viewportCullingMargin) noexcept
+{
+    if (qFuzzyCompare(1. + viewportCullingMargin, 1. + _viewportCullingMargin))
+        return;
+    _viewportCullingMargin = viewportCullingMargin;
+    updateCullingRect();
+    emit viewportCullingMarginChanged();
+}
+
+void    GraphView::updateCullingRect()
+{
+    if (!_graph ||
+        !_graph->getViewportCulling() ||
+        getContainerItem() == nullptr ||
+        width() <= 0. || height() <= 0.)
+        return;
+    const qreal m = _viewportCullingMargin;
+    _graph->setCullingRect(getContainerItem()->mapRectFromItem(this, QRectF{-m, -m, width() + (2. * m), height() + (2. * m)}));
+}
+//-----------------------------------------------------------------------------
+
+
+/* Level of Detail Management *///---------------------------------------------
+void    GraphView::updateLodZoom()
+{
+    if (_graph)
+        _graph->setLodZoom(getZoom());
+}
+//-----------------------------------------------------------------------------
+
+
 /* GraphView Interactions Management *///--------------------------------------
 void    GraphView::navigableClicked(QPointF pos, QPointF globalPos)
 {
@@ -122,6 +184,34 @@ QString GraphView::urlToLocalFile(QUrl url) const noexcept
 
 
 /* Selection Rectangle Management *///-----------------------------------------
+namespace impl { // ::qan::impl
+
+// Return \c a - \c b rect difference as (at most 4) non overlapping rects.
+static std::vector<QRectF> subtractRect(const QRectF& a, const QRectF& b)
+{
+    std::vector<QRectF> r;
+    if (a.isEmpty())
+        return r;
+    if (b.isEmpty() ||
+        !a.intersects(b)) {
+        r.push_back(a);
+        return r;
+    }
+    const auto top = std::max(a.top(), b.top());
+    const auto bottom = std::min(a.bottom(), b.bottom());
+    if (b.top() > a.top())
+        r.push_back(QRectF{QPointF{a.left(), a.top()}, QPointF{a.right(), b.top()}});
+    if (b.bottom() < a.bottom())
+        r.push_back(QRectF{QPointF{a.left(), b.bottom()}, QPointF{a.right(), a.bottom()}});
+    if (b.left() > a.left())
+        r.push_back(QRectF{QPointF{a.left(), top}, QPointF{b.left(), bottom}});
+    if (b.right() < a.right())
+        r.push_back(QRectF{QPointF{b.right(), top}, QPointF{a.right(), bottom}});
+    return r;
+}
+
+} // ::qan::impl
+
 void    GraphView::selectionRectActivated(const QRectF& rect)
 {
     if (!_graph ||
@@ -130,81 +220,90 @@ void    GraphView::selectionRectActivated(const QRectF& rect)
     if (rect.isEmpty())
         return;
     // Algorithm:
-    // 1. Iterate over all already selected items, remove one that are no longer inside selection rect
-    //    (for example, if selection rect has grown down...)
-    // 2. Iterate over all graph items, select items inside selection rect.
+    // 1. Collect items whose selection might have changed: an item contained in only one of
+    //    the previous or current selection rect necessarilly overlap the difference between
+    //    theses rects. Candidates are queried from graph spatial index, only graph container
+    //    direct childs (ie non grouped nodes, groups and edges) are taken into account.
+    // 2. Sort candidates in items to select and items to deselect, skipping items whose selection
+    //    state does not change. Only items selected by this selection rect are deselected.
+    // 3. Apply selection changes in a single selection batch (ie one selectionChanged() emission).
+    const auto containerItem = _graph->getContainerItem();
+    const auto& spatialIndex = _graph->getSpatialIndex();
+    const auto previousRect = _selectionRect;
+    _selectionRect = rect;
 
     // 1.
-    QSetIterator<QQuickItem*> selectedItem(_selectedItems);
-    while (selectedItem.hasNext()) {
-        const auto item = selectedItem.next();
-        auto nodeItem = qobject_cast<qan::NodeItem*>(item);
-        if (nodeItem != nullptr &&
-            nodeItem->getNode() != nullptr ) {
-            const auto itemBr = item->mapRectToItem(_graph->getContainerItem(),
-                                                    item->boundingRect());
-            if (!rect.contains(itemBr)) {
-                _graph->setNodeSelected(*nodeItem->getNode(), false);
-                _selectedItems.remove(item);
-            }
-        } else {
-            auto edgeItem = qobject_cast<qan::EdgeItem*>(item);
-            if (edgeItem != nullptr &&
-                edgeItem->getEdge() != nullptr) {
-                auto itemBr = item->mapRectToItem(_graph->getContainerItem(),
-                                                        item->boundingRect());
-                if (qFuzzyIsNull(itemBr.height()))  // Note: rect.contains does not work with 0 width/height
-                    itemBr.setHeight(0.5);          // br, set minimum width/height to 0.5, to allow vertical /
-                if (qFuzzyIsNull(itemBr.width()))   // horizontal line selection for example.
-                    itemBr.setWidth(0.5);
-                if (!rect.contains(itemBr)) {
-                    _graph->setEdgeSelected(edgeItem->getEdge(), false);
-                    _selectedItems.remove(item);
-                }
-            }
-        }
-    }
+    std::unordered_set<QQuickItem*> candidates;
+    const auto collectCandidates = [&candidates, &spatialIndex, containerItem](const QRectF& a, const QRectF& b) {
+        for (const auto& r : impl::subtractRect(a, b))
+            for (const auto item : spatialIndex.itemsIntersecting(r))
+                if (item != nullptr &&
+                    item->parentItem() == containerItem)
+                    candidates.insert(item);
+    };
+    collectCandidates(rect, previousRect);
+    collectCandidates(previousRect, rect);
+    if (candidates.empty())
+        return;
 
     // 2.
-    const auto items = _graph->getContainerItem()->childItems();
-    for (const auto item: items) {
-        auto nodeItem = qobject_cast<qan::NodeItem*>(item);
+    // Note: Do not use QRectF::contains(), it does not work with 0 width/height br (ie
+    // vertical or horizontal edges).
+    const auto isInside = [&rect](const QRectF& itemRect) -> bool {
+        return rect.left() <= itemRect.left() && itemRect.right() <= rect.right() &&
+               rect.top() <= itemRect.top() && itemRect.bottom() <= rect.bottom();
+    };
+    std::vector<qan::Node*> selectNodes, deselectNodes;
+    std::vector<qan::Edge*> selectEdges, deselectEdges;
+    for (const auto item : candidates) {
+        const auto inside = isInside(spatialIndex.getRect(item));
+        const auto nodeItem = qobject_cast<qan::NodeItem*>(item);
         if (nodeItem != nullptr &&
-            nodeItem->isSelectable() &&
             nodeItem->getNode() != nullptr) {
-            auto node = nodeItem->getNode();
-            const auto itemBr = item->mapRectToItem(_graph->getContainerItem(),
-                                                    item->boundingRect());
-            if (rect.contains(itemBr)) {
-                _graph->setNodeSelected(*node, true);
+            if (inside &&
+                nodeItem->isSelectable() &&
+                !nodeItem->getSelected()) {
+                selectNodes.push_back(nodeItem->getNode());
                 // Note we assume that items are not deleted while the selection
                 // is in progress... (QPointer can't be trivially inserted in QSet)
-                _selectedItems.insert(nodeItem);
+                _selectedItems.insert(item);
+            } else if (!inside &&
+                       nodeItem->getSelected() &&
+                       _selectedItems.contains(item)) {
+                deselectNodes.push_back(nodeItem->getNode());
+                _selectedItems.remove(item);
             }
-        } else {
-            // 3. Edge selection...
-            auto edgeItem = qobject_cast<qan::EdgeItem*>(item);
-            if (edgeItem != nullptr &&
-                edgeItem->getEdge() != nullptr) {
-                auto itemBr = item->mapRectToItem(_graph->getContainerItem(),
-                                                  item->boundingRect());
-                if (qFuzzyIsNull(itemBr.height()))  // Note: rect.contains does not work with 0 width/height
-                    itemBr.setHeight(0.5);          // br, set minimum width/height to 0.5, to allow vertical /
-                if (qFuzzyIsNull(itemBr.width()))   // horizontal line selection for example.
-                    itemBr.setWidth(0.5);
-                if (rect.contains(itemBr)) {
-                    auto edge = edgeItem->getEdge();
-                    _graph->setEdgeSelected(edge, true);
-                    _selectedItems.insert(edgeItem);
-                }
+            continue;
+        }
+        const auto edgeItem = qobject_cast<qan::EdgeItem*>(item);
+        if (edgeItem != nullptr &&
+            edgeItem->getEdge() != nullptr) {
+            if (inside &&
+                !edgeItem->getSelected()) {
+                selectEdges.push_back(edgeItem->getEdge());
+                _selectedItems.insert(item);
+            } else if (!inside &&
+                       edgeItem->getSelected() &&
+                       _selectedItems.contains(item)) {
+                deselectEdges.push_back(edgeItem->getEdge());
+                _selectedItems.remove(item);
             }
         }
     }
+
+    // 3.
+    _graph->beginSelectionBatch();
+    _graph->deselect(deselectNodes);
+    _graph->deselect(deselectEdges);
+    _graph->selectNodes(selectNodes);
+    _graph->selectEdges(selectEdges);
+    _graph->endSelectionBatch();
 }
 
 void    GraphView::selectionRectEnd()
 {
     _selectedItems.clear();  // Clear selection cache
+    _selectionRect = QRectF{};
 }
 
 void    GraphView::keyPressEvent(QKeyEvent *event)
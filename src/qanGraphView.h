@@ -76,6 +76,47 @@ signals:
     //-------------------------------------------------------------------------
 
 
+    /*! \name Viewport Culling Management *///---------------------------------
+    //@{
+public:
+    /*! \brief Exclude graph items outside of view (plus \c viewportCullingMargin) from scene graph (default to false).
+     *
+     * Items are rendered again when they scroll into view, graph topology and items visibility are not modified.
+     * \sa qan::Graph::viewportCulling
+     */
+    Q_PROPERTY(bool viewportCulling READ getViewportCulling WRITE setViewportCulling NOTIFY viewportCullingChanged FINAL)
+    void            setViewportCulling(bool viewportCulling) noexcept;
+    inline bool     getViewportCulling() const noexcept { return _viewportCulling; }
+private:
+    bool            _viewportCulling = false;
+signals:
+    void            viewportCullingChanged();
+
+public:
+    //! Margin around view in pixels where items are not culled (default to 200.), avoid items popping in while panning.
+    Q_PROPERTY(qreal viewportCullingMargin READ getViewportCullingMargin WRITE setViewportCullingMargin NOTIFY viewportCullingMarginChanged FINAL)
+    void            setViewportCullingMargin(qreal viewportCullingMargin) noexcept;
+    inline qreal    getViewportCullingMargin() const noexcept { return _viewportCullingMargin; }
+private:
+    qreal           _viewportCullingMargin = 200.;
+signals:
+    void            viewportCullingMarginChanged();
+
+protected slots:
+    //! Update graph culling rect with current view rect (mapped to container CS) and culling margin.
+    void            updateCullingRect();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Level of Detail Management *///--------------------------------
+    //@{
+protected slots:
+    //! Forward current view zoom to graph level of detail selection (see qan::Graph::levelOfDetail).
+    void            updateLodZoom();
+    //@}
+    //-------------------------------------------------------------------------
+
+
     /*! \name GraphView Interactions Management *///---------------------------
     //@{
 protected:
@@ -118,7 +159,10 @@ protected:
     //! \copydoc qan::Navigable::selectionRectEnd()
     virtual void    selectionRectEnd() override;
 private:
+    //! Items selected by the current selection rect interaction.
     QSet<QQuickItem*>   _selectedItems;
+    //! Previous selection rect (in containerItem CS), used to compute selection delta.
+    QRectF              _selectionRect;
 
 protected:
     virtual void    keyPressEvent(QKeyEvent *event) override;
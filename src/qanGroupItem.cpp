@@ -81,11 +81,18 @@ bool    GroupItem::setGroup(qan::Group* group) noexcept
         if (group != nullptr &&            // Warning: Do that after having set _group
             group->getItem() != this)
             group->setItem(this);
+        emit groupChanged();
         return true;
     }
     return false;
 }
 
+void    GroupItem::recycle()
+{
+    setGroup(nullptr);      // Note: Reset group first, collapsing a pooled item must not modify old group edges
+    qan::NodeItem::recycle();
+}
+
 auto    GroupItem::setRect(const QRectF& r) noexcept -> void
 {
     // PRECONDITIONS:
@@ -146,7 +153,7 @@ void    GroupItem::groupMoved()
         for (auto edge : adjacentEdges) {
             if (edge != nullptr &&
                 edge->getItem() != nullptr)
-                edge->getItem()->updateItem(); // Edge is updated even is edge item visible=false, updateItem() will take care of visibility
+                edge->getItem()->scheduleUpdateItem(); // Edge is updated even is edge item visible=false, updateItem() will take care of visibility
         }
     }
 }
@@ -71,12 +71,23 @@ public:
     /*! \name Topology Management *///-----------------------------------------
     //@{
 public:
-    Q_PROPERTY(qan::Group* group READ getGroup CONSTANT FINAL)
+    //! Item group, could change when item is reused from qan::Graph delegate pool.
+    Q_PROPERTY(qan::Group* group READ getGroup NOTIFY groupChanged FINAL)
     auto            getGroup() noexcept -> qan::Group*;
     auto            getGroup() const noexcept -> const qan::Group*;
     virtual bool    setGroup(qan::Group* group) noexcept;
 protected:
     QPointer<qan::Group> _group{nullptr};
+signals:
+    void            groupChanged();
+
+public:
+    /*! \brief Detach this item from it's group before it is stored in qan::Graph delegate pool (internal).
+     *
+     * Group is reset to nullptr before qan::NodeItem::recycle(), group content must already have been
+     * removed or ungrouped.
+     */
+    virtual void    recycle() override;
 
 public:
     //! Utility function to ease initialization from c++, call setX(), setY(), setWidth() and setHEight() with the content of \c rect bounding rect.
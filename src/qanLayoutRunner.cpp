@@ -0,0 +1,515 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanLayoutRunner.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+// Qt headers
+#include <QQuickWindow>
+
+// QuickQanava headers
+#include "./qanLayoutRunner.h"
+#include "./qanNodeItem.h"
+#include "./qanGroupItem.h"
+
+namespace qan { // ::qan
+
+/* LayoutRunner Object Management *///-----------------------------------------
+LayoutRunner::LayoutRunner(QObject* parent) noexcept :
+    QObject{parent}
+{
+}
+
+LayoutRunner::~LayoutRunner()
+{
+    // Note: Do not emit anything, just release worker thread. Cancelled workers are joined: they might
+    // still run library code (ie force directed worker pool) that must not outlive the runner.
+    if (_job)
+        release(_job->task);
+    else if (_thread.joinable())
+        _thread.join();
+    joinCancelledWorkers(true);
+}
+
+bool    LayoutRunner::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph == _graph)
+        return false;
+    if (_job)
+        stop(true);
+    for (const auto& connection : _graphConnections)
+        QObject::disconnect(connection);
+    _graphConnections.clear();
+    _graph = graph;
+    if (graph != nullptr) {
+        const auto modified = [this]() { ++_generation; };
+        _graphConnections = {
+            connect(graph, &qan::Graph::nodeInserted,   this, modified),
+            connect(graph, &qan::Graph::nodeRemoved,    this, modified),
+            connect(graph, &qan::Graph::edgeInserted,   this, modified),
+            connect(graph, &qan::Graph::onEdgeRemoved,  this, modified),
+            connect(graph, &qan::Graph::nodeGrouped,    this, modified),
+            connect(graph, &qan::Graph::nodeUngrouped,  this, modified),
+            connect(graph, &qan::Graph::nodeResized,    this, modified),
+            connect(graph, &qan::Graph::groupResized,   this, modified)
+        };
+    }
+    emit graphChanged();
+    return true;
+}
+
+bool    LayoutRunner::setAnimationFrames(int animationFrames) noexcept
+{
+    animationFrames = std::max(0, animationFrames);
+    if (animationFrames != _animationFrames) {
+        _animationFrames = animationFrames;
+        emit animationFramesChanged();
+        return true;
+    }
+    return false;
+}
+//-----------------------------------------------------------------------------
+
+/* Layout Snapshot *///--------------------------------------------------------
+LayoutRunner::Snapshot  LayoutRunner::takeSnapshot(qan::Graph& graph, qan::Node* root, std::vector<qan::Node*>& nodes)
+{
+    Snapshot snapshot;
+    nodes.clear();
+    std::unordered_map<const qan::Node*, std::size_t> indexes;
+    if (root != nullptr) {      // BFS from root
+        snapshot.rooted = true;
+        if (root->getItem() == nullptr)
+            return snapshot;
+        indexes.emplace(root, 0);
+        nodes.push_back(root);
+        for (std::size_t n = 0; n < nodes.size(); ++n)
+            for (const auto outNode : nodes[n]->get_out_nodes())
+                if (outNode != nullptr &&
+                    outNode->getItem() != nullptr &&
+                    indexes.emplace(outNode, nodes.size()).second)
+                    nodes.push_back(outNode);
+    } else {
+        for (const auto node : graph.get_nodes())
+            if (node != nullptr &&
+                node->getItem() != nullptr) {
+                indexes.emplace(node, nodes.size());
+                nodes.push_back(node);
+            }
+    }
+
+    // Note: Collect positions in graph container item CS (grouped nodes are children of their group container)
+    const auto containerItem = graph.getContainerItem();
+    std::unordered_map<const qan::Group*, std::size_t> containers;
+    for (const auto node : nodes) {
+        const auto item = node->getItem();
+        snapshot.positions.push_back(containerItem != nullptr ? item->mapToItem(containerItem, QPointF{0., 0.}) :
+                                                                item->position());
+        snapshot.sizes.emplace_back(item->width(), item->height());
+        snapshot.pinned.push_back(node->getLocked());
+        snapshot.groups.push_back(node->isGroup());
+        auto containerIndex = noContainer;
+        const auto group = node->getGroup();
+        const auto groupItem = group != nullptr ? group->getGroupItem() : nullptr;
+        const auto groupContainer = groupItem != nullptr ? groupItem->getContainer() : nullptr;
+        if (groupContainer != nullptr) {
+            const auto container = containers.find(group);
+            if (container == containers.end()) {
+                containerIndex = snapshot.containers.size();
+                containers.emplace(group, containerIndex);
+                const QRectF rect{0., 0., groupContainer->width(), groupContainer->height()};
+                snapshot.containers.push_back(containerItem != nullptr ? groupContainer->mapRectToItem(containerItem, rect) :
+                                                                         rect);
+            } else
+                containerIndex = container->second;
+        }
+        snapshot.containerIndexes.push_back(containerIndex);
+    }
+    for (std::size_t src = 0; src < nodes.size(); ++src)
+        for (const auto edge : nodes[src]->get_out_edges()) {
+            if (edge == nullptr)
+                continue;
+            const auto dst = indexes.find(edge->get_dst());
+            if (dst == indexes.end())
+                continue;
+            snapshot.edges.emplace_back(src, dst->second);
+            snapshot.weights.push_back(edge->getWeight());
+        }
+    return snapshot;
+}
+//-----------------------------------------------------------------------------
+
+/* Layout Management *///------------------------------------------------------
+LayoutRunner::Algorithm LayoutRunner::orgTreeAlgorithm(const qan::OrgTreeLayout& layout, qreal xSpacing, qreal ySpacing)
+{
+    const auto orientation = layout.getLayoutOrientation();
+    return [orientation, xSpacing, ySpacing](const Snapshot& snapshot, const Progress& progress) -> std::vector<QPointF> {
+        if (!snapshot.rooted ||
+            snapshot.positions.empty())
+            return {};
+        qan::OrgTreeLayout::Children children(snapshot.positions.size());
+        for (const auto& [src, dst] : snapshot.edges)
+            children[src].push_back(dst);
+        qan::OrgTreeLayout orgTreeLayout;
+        orgTreeLayout.setLayoutOrientation(orientation);
+        auto positions = orgTreeLayout.computeLayout(children, snapshot.sizes, xSpacing, ySpacing, progress);
+        for (auto& position : positions)    // Root is not moved
+            position += snapshot.positions[0];
+        return positions;
+    };
+}
+
+LayoutRunner::Algorithm LayoutRunner::sugiyamaAlgorithm(const qan::SugiyamaLayout& layout, qreal xSpacing, qreal ySpacing)
+{
+    const auto crossingSweeps = layout.getCrossingSweeps();
+    return [crossingSweeps, xSpacing, ySpacing](const Snapshot& snapshot, const Progress& progress) -> std::vector<QPointF> {
+        // Note: Same nodes than qan::SugiyamaLayout::layout(): root subgraph keeping root in place, or
+        // graph top level nodes and groups keeping their bounding rect top left.
+        std::vector<std::size_t> vertices;
+        std::vector<std::size_t> indexes(snapshot.positions.size(), noContainer);
+        for (std::size_t n = 0; n < snapshot.positions.size(); ++n)
+            if (snapshot.rooted ||
+                snapshot.containerIndexes[n] == noContainer) {
+                indexes[n] = vertices.size();
+                vertices.push_back(n);
+            }
+        if (vertices.empty())
+            return {};
+        std::vector<QSizeF> sizes;
+        QPointF origin{std::numeric_limits<qreal>::max(), std::numeric_limits<qreal>::max()};
+        for (const auto n : vertices) {
+            sizes.push_back(snapshot.sizes[n]);
+            origin.setX(std::min(origin.x(), snapshot.positions[n].x()));
+            origin.setY(std::min(origin.y(), snapshot.positions[n].y()));
+        }
+        qan::SugiyamaLayout::Edges edges;
+        for (const auto& [src, dst] : snapshot.edges)
+            if (indexes[src] != noContainer &&
+                indexes[dst] != noContainer)
+                edges.emplace_back(indexes[src], indexes[dst]);
+
+        qan::SugiyamaLayout sugiyamaLayout;
+        sugiyamaLayout.setCrossingSweeps(crossingSweeps);
+        const auto layoutPositions = sugiyamaLayout.computeLayout(sizes, edges, xSpacing, ySpacing, progress);
+        if (layoutPositions.size() != vertices.size())
+            return {};
+        if (snapshot.rooted)
+            origin = snapshot.positions[0] - layoutPositions[0];
+        auto positions = snapshot.positions;
+        for (std::size_t v = 0; v < vertices.size(); ++v)
+            positions[vertices[v]] = layoutPositions[v] + origin;
+        return positions;
+    };
+}
+
+LayoutRunner::Algorithm LayoutRunner::forceDirectedAlgorithm(const qan::ForceDirectedLayout& layout)
+{
+    const auto iterations = layout.getIterations();
+    const auto convergenceThreshold = layout.getConvergenceThreshold();
+    const auto springLength = layout.getSpringLength();
+    const auto theta = layout.getTheta();
+    const auto gravity = layout.getGravity();
+    const auto useEdgeWeight = layout.getUseEdgeWeight();
+    const auto threadCount = layout.getThreadCount();
+    return [=](const Snapshot& snapshot, const Progress& progress) -> std::vector<QPointF> {
+        // Note: Same nodes than qan::ForceDirectedLayout::layout(): groups are not moved.
+        qan::ForceDirectedLayout::Input input;
+        std::vector<std::size_t> vertices;
+        std::vector<std::size_t> indexes(snapshot.positions.size(), noContainer);
+        for (std::size_t n = 0; n < snapshot.positions.size(); ++n) {
+            if (snapshot.groups[n])
+                continue;
+            indexes[n] = vertices.size();
+            vertices.push_back(n);
+            input.positions.push_back(snapshot.positions[n]);
+            input.sizes.push_back(snapshot.sizes[n]);
+            input.pinned.push_back(snapshot.pinned[n]);
+            input.containerIndexes.push_back(snapshot.containerIndexes[n]);
+        }
+        input.containers = snapshot.containers;
+        for (std::size_t e = 0; e < snapshot.edges.size(); ++e) {
+            const auto& [src, dst] = snapshot.edges[e];
+            if (indexes[src] == noContainer ||
+                indexes[dst] == noContainer)
+                continue;
+            input.edges.emplace_back(indexes[src], indexes[dst]);
+            input.weights.push_back(useEdgeWeight ? std::abs(snapshot.weights[e]) : 1.);
+        }
+
+        qan::ForceDirectedLayout forceDirectedLayout;
+        forceDirectedLayout.setIterations(iterations);
+        forceDirectedLayout.setConvergenceThreshold(convergenceThreshold);
+        forceDirectedLayout.setSpringLength(springLength);
+        forceDirectedLayout.setTheta(theta);
+        forceDirectedLayout.setGravity(gravity);
+        forceDirectedLayout.setThreadCount(threadCount);
+        const auto layoutPositions = forceDirectedLayout.computeLayout(input, progress);
+        if (layoutPositions.size() != vertices.size())
+            return {};
+        auto positions = snapshot.positions;
+        for (std::size_t v = 0; v < vertices.size(); ++v)
+            positions[vertices[v]] = layoutPositions[v];
+        return positions;
+    };
+}
+
+bool    LayoutRunner::run(Algorithm algorithm, qan::Node* root)
+{
+    if (!_graph) {
+        qWarning() << "qan::LayoutRunner::run(): Error: No graph configured.";
+        return false;
+    }
+    if (!algorithm)
+        return false;
+    if (_job)
+        stop(true);
+
+    // Algorithm:
+        // 1. Snapshot graph on GUI thread.
+        // 2. Run algorithm on a worker thread, progress and result are posted back to GUI thread.
+        // 3. onComputed() discard stale result, or apply it (eventually animated).
+    std::vector<qan::Node*> nodes;
+    auto snapshot = std::make_shared<const Snapshot>(takeSnapshot(*_graph, root, nodes));
+    if (nodes.empty())
+        return false;
+    auto job = std::make_unique<Job>();
+    job->task = std::make_shared<Task>();
+    job->task->snapshot = std::move(snapshot);
+    job->nodes.assign(nodes.cbegin(), nodes.cend());
+    job->generation = _generation;
+    job->edgeCount = _graph->get_edge_count();
+    const auto task = job->task;
+    _job = std::move(job);
+    setProgress(0.);
+    emit runningChanged();
+
+    // Note: Worker never access this directly, it post to task->runner that is reset when a cancelled
+    // worker is released, queued calls are then dropped with runner.
+    task->runner = this;
+    _thread = std::thread([task, algorithm = std::move(algorithm)]() {
+        const Progress progress = [task](qreal p) -> bool {
+            const auto permille = static_cast<int>(std::clamp(p, 0., 1.) * 1000.);
+            if (task->progress.exchange(permille) / 10 != permille / 10) {  // Post at most 100 progress updates
+                const std::lock_guard<std::mutex> lock{task->mutex};
+                if (task->runner != nullptr)
+                    QMetaObject::invokeMethod(task->runner, [runner = task->runner, task]() {
+                        if (runner->_job && runner->_job->task == task)
+                            runner->setProgress(task->progress / 1000.);
+                    }, Qt::QueuedConnection);
+            }
+            return !task->cancelled;
+        };
+        auto positions = task->cancelled ? std::vector<QPointF>{} :
+                                           algorithm(*task->snapshot, progress);
+        {
+            const std::lock_guard<std::mutex> lock{task->mutex};
+            if (task->runner != nullptr)
+                QMetaObject::invokeMethod(task->runner, [runner = task->runner, task, positions = std::move(positions)]() mutable {
+                    runner->onComputed(task, std::move(positions));
+                }, Qt::QueuedConnection);
+        }
+        task->done = true;
+    });
+    return true;
+}
+
+bool    LayoutRunner::runOrgTree(qan::OrgTreeLayout* layout, qan::Node* root, qreal xSpacing, qreal ySpacing)
+{
+    if (layout == nullptr ||
+        root == nullptr)
+        return false;
+    return run(orgTreeAlgorithm(*layout, xSpacing, ySpacing), root);
+}
+
+bool    LayoutRunner::runSugiyama(qan::SugiyamaLayout* layout, qan::Node* root, qreal xSpacing, qreal ySpacing)
+{
+    if (layout == nullptr)
+        return false;
+    return run(sugiyamaAlgorithm(*layout, xSpacing, ySpacing), root);
+}
+
+bool    LayoutRunner::runForceDirected(qan::ForceDirectedLayout* layout)
+{
+    if (layout == nullptr)
+        return false;
+    return run(forceDirectedAlgorithm(*layout), nullptr);
+}
+
+void    LayoutRunner::cancel()
+{
+    if (_job)
+        stop(true);
+}
+
+void    LayoutRunner::onComputed(const std::shared_ptr<Task>& task, std::vector<QPointF> positions)
+{
+    if (!_job ||
+        _job->task != task)     // Result from a cancelled run
+        return;
+    if (_thread.joinable())     // Note: worker is done, it just posted this result
+        _thread.join();
+    if (positions.size() != _job->nodes.size() ||
+        isStale(*_job)) {
+        stop(false);
+        emit discarded();
+        return;
+    }
+    setProgress(1.);
+
+    const auto window = _graph->window();
+    if (_animationFrames <= 0 ||
+        window == nullptr) {
+        apply(*_job, positions);
+        stop(false);
+        emit finished();
+        return;
+    }
+    // Animate from current nodes positions
+    const auto containerItem = _graph->getContainerItem();
+    _job->from.clear();
+    for (const auto& node : _job->nodes) {
+        const auto item = node ? node->getItem() : nullptr;
+        _job->from.push_back(item == nullptr ? QPointF{} :
+                             containerItem != nullptr ? item->mapToItem(containerItem, QPointF{0., 0.}) :
+                                                        item->position());
+    }
+    _job->to = std::move(positions);
+    _job->frame = 0;
+    _frameConnection = connect(window, &QQuickWindow::afterAnimating,
+                               this,   &LayoutRunner::animate);
+    window->update();
+}
+
+bool    LayoutRunner::isStale(const Job& job) const
+{
+    if (!_graph ||
+        job.generation != _generation ||
+        job.edgeCount != _graph->get_edge_count())
+        return true;
+    const auto& sizes = job.task->snapshot->sizes;
+    for (std::size_t n = 0; n < job.nodes.size(); ++n) {
+        const auto item = job.nodes[n] ? job.nodes[n]->getItem() : nullptr;
+        if (item == nullptr ||
+            QSizeF{item->width(), item->height()} != sizes[n])
+            return true;
+    }
+    return false;
+}
+
+void    LayoutRunner::animate()
+{
+    if (!_job ||
+        !_graph)
+        return;
+    const auto t = std::min(1., static_cast<qreal>(++_job->frame) / _animationFrames);
+    const auto s = t * t * (3. - 2. * t);   // Smoothstep
+    std::vector<QPointF> positions(_job->to.size());
+    for (std::size_t n = 0; n < positions.size(); ++n)
+        positions[n] = _job->from[n] + (_job->to[n] - _job->from[n]) * s;
+    apply(*_job, positions);
+    if (t >= 1.) {
+        stop(false);
+        emit finished();
+    } else if (_graph->window() != nullptr)
+        _graph->window()->update();
+}
+
+void    LayoutRunner::apply(const Job& job, const std::vector<QPointF>& positions)
+{
+    if (!_graph)
+        return;
+    const auto containerItem = _graph->getContainerItem();
+    for (std::size_t n = 0; n < job.nodes.size() && n < positions.size(); ++n) {
+        const auto item = job.nodes[n] ? job.nodes[n]->getItem() : nullptr;
+        if (item == nullptr)
+            continue;
+        const auto parentItem = item->parentItem();
+        item->setPosition(parentItem != nullptr && containerItem != nullptr && parentItem != containerItem ?
+                              containerItem->mapToItem(parentItem, positions[n]) : positions[n]);
+    }
+}
+
+void    LayoutRunner::stop(bool cancel)
+{
+    if (!_job)
+        return;
+    release(_job->task);
+    QObject::disconnect(_frameConnection);
+    _job.reset();
+    emit runningChanged();
+    if (cancel)
+        emit cancelled();
+}
+
+void    LayoutRunner::release(const std::shared_ptr<Task>& task)
+{
+    // Note: A cancelled worker is not joined immediately: algorithm might not check progress often, it
+    // finish in background and its result is never posted. Worker is joined once done (or on destruction).
+    if (!task)
+        return;
+    task->cancelled = true;
+    {
+        const std::lock_guard<std::mutex> lock{task->mutex};
+        task->runner = nullptr;
+    }
+    if (_thread.joinable())
+        _cancelledWorkers.push_back(CancelledWorker{task, std::move(_thread)});
+    joinCancelledWorkers(false);
+}
+
+void    LayoutRunner::joinCancelledWorkers(bool wait)
+{
+    // Note: A done worker no longer access its task, join is not blocking.
+    for (auto worker = _cancelledWorkers.begin(); worker != _cancelledWorkers.end(); ) {
+        if (wait ||
+            worker->task->done) {
+            if (worker->thread.joinable())
+                worker->thread.join();
+            worker = _cancelledWorkers.erase(worker);
+        } else
+            ++worker;
+    }
+}
+
+void    LayoutRunner::setProgress(qreal progress) noexcept
+{
+    if (!qFuzzyCompare(1. + progress, 1. + _progress)) {
+        _progress = progress;
+        emit progressChanged();
+    }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,272 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanLayoutRunner.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Qt headers
+#include <QObject>
+#include <QPointer>
+#include <QPointF>
+#include <QRectF>
+#include <QSizeF>
+#include <QMetaObject>
+#include <QtQml>
+
+// QuickQanava headers
+#include "./qanGraph.h"
+#include "./qanTreeLayouts.h"
+#include "./qanSugiyamaLayout.h"
+#include "./qanForceDirectedLayout.h"
+
+namespace qan { // ::qan
+
+/*! \brief Run a layout algorithm on a worker thread and apply its result to graph in one batch.
+ *
+ * Layout run in three steps:
+ *   1. An immutable Snapshot of nodes topology, sizes and positions is taken on GUI thread.
+ *   2. Layout algorithm is run on a worker thread on the snapshot only (no QQuickItem is accessed),
+ *      \c progress is updated and cancel() might be called from GUI thread at any time.
+ *   3. Result is applied to nodes items on GUI thread in one batch, or interpolated over
+ *      \c animationFrames frames.
+ *
+ * Result is discarded (and discarded() emitted) if graph topology or nodes sizes have been modified
+ * while the layout was running. Starting a new run cancel the current one.
+ *
+ * \code
+ *   // From QML:
+ *   Qan.LayoutRunner { id: layoutRunner; graph: graph; animationFrames: 20 }
+ *   Qan.SugiyamaLayout { id: sugiyamaLayout }
+ *   layoutRunner.runSugiyama(sugiyamaLayout)
+ * \endcode
+ * \nosubgrouping
+ */
+class LayoutRunner : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    /*! \name LayoutRunner Object Management *///------------------------------
+    //@{
+public:
+    explicit LayoutRunner(QObject* parent = nullptr) noexcept;
+    //! Cancel a running layout and join all cancelled worker threads (algorithms stop on their next progress check).
+    virtual ~LayoutRunner() override;
+    LayoutRunner(const LayoutRunner&) = delete;
+    LayoutRunner& operator=(const LayoutRunner&) = delete;
+    LayoutRunner(LayoutRunner&&) = delete;
+    LayoutRunner& operator=(LayoutRunner&&) = delete;
+
+public:
+    //! Graph laid out by this runner, modifying graph cancel current run.
+    Q_PROPERTY(qan::Graph* graph READ getGraph WRITE setGraph NOTIFY graphChanged FINAL)
+    bool            setGraph(qan::Graph* graph) noexcept;
+    qan::Graph*     getGraph() const noexcept { return _graph.data(); }
+protected:
+    QPointer<qan::Graph>    _graph;
+    //! Connections to graph modification signals.
+    std::vector<QMetaObject::Connection>    _graphConnections;
+signals:
+    void            graphChanged();
+
+public:
+    //! Number of frames used to interpolate nodes from their current to their laid out position (default to 0, ie no animation).
+    Q_PROPERTY(int animationFrames READ getAnimationFrames WRITE setAnimationFrames NOTIFY animationFramesChanged FINAL)
+    bool            setAnimationFrames(int animationFrames) noexcept;
+    int             getAnimationFrames() const noexcept { return _animationFrames; }
+protected:
+    int             _animationFrames = 0;
+signals:
+    void            animationFramesChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Layout Snapshot *///---------------------------------------------
+    //@{
+public:
+    static constexpr std::size_t    noContainer = std::numeric_limits<std::size_t>::max();
+
+    /*! \brief Immutable copy of laid out nodes topology and geometry, positions are in graph container item CS.
+     *
+     * When the snapshot has been taken from a root node, root index is 0 and nodes are in BFS order.
+     */
+    struct Snapshot {
+        //! Nodes top left positions.
+        std::vector<QPointF>    positions;
+        std::vector<QSizeF>     sizes;
+        //! Edges in source node out edges order.
+        std::vector<std::pair<std::size_t, std::size_t>>    edges;
+        std::vector<qreal>      weights;
+        //! Locked nodes.
+        std::vector<bool>       pinned;
+        //! True for group nodes.
+        std::vector<bool>       groups;
+        //! Group containers rects, nodes inside a group reference their container in \c containerIndexes.
+        std::vector<QRectF>     containers;
+        std::vector<std::size_t> containerIndexes;
+        //! True if snapshot has been taken from a root node.
+        bool                    rooted = false;
+    };
+
+    /*! \brief Take a snapshot of \c root and nodes reachable from \c root, or of all \c graph nodes if \c root is nullptr.
+     *
+     * Only nodes with an item are collected, \c nodes is filled with snapshot nodes in snapshot order.
+     */
+    static Snapshot     takeSnapshot(qan::Graph& graph, qan::Node* root, std::vector<qan::Node*>& nodes);
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Layout Management *///-------------------------------------------
+    //@{
+public:
+    //! Progress callback called with a [0, 1] progress, algorithm must stop and return an empty result if it return false.
+    using Progress = std::function<bool(qreal)>;
+
+    /*! \brief Layout algorithm: return nodes top left positions in snapshot CS (ie graph container item CS).
+     *
+     * Algorithm is run on a worker thread and must only access its snapshot, an empty or partial result
+     * is ignored.
+     */
+    using Algorithm = std::function<std::vector<QPointF>(const Snapshot&, const Progress&)>;
+
+    //! Return an org chart layout algorithm configured with \c layout current settings (snapshot must be rooted).
+    static Algorithm    orgTreeAlgorithm(const qan::OrgTreeLayout& layout, qreal xSpacing = 25., qreal ySpacing = 25.);
+    //! Return a layered layout algorithm configured with \c layout current settings, see qan::SugiyamaLayout::layout().
+    static Algorithm    sugiyamaAlgorithm(const qan::SugiyamaLayout& layout, qreal xSpacing = 25., qreal ySpacing = 50.);
+    //! Return a force directed layout algorithm configured with \c layout current settings, see qan::ForceDirectedLayout::layout().
+    static Algorithm    forceDirectedAlgorithm(const qan::ForceDirectedLayout& layout);
+
+    /*! \brief Snapshot \c root subgraph (or whole graph when \c root is nullptr) and run \c algorithm on a worker thread.
+     *
+     * Current run is cancelled, return false if there is nothing to lay out.
+     */
+    bool                run(Algorithm algorithm, qan::Node* root = nullptr);
+
+    //! Run \c layout asynchronously on \c root and nodes reachable from \c root, see qan::OrgTreeLayout::layout().
+    Q_INVOKABLE bool    runOrgTree(qan::OrgTreeLayout* layout, qan::Node* root, qreal xSpacing = 25., qreal ySpacing = 25.);
+    //! Run \c layout asynchronously on \c root subgraph, or on whole graph if \c root is nullptr, see qan::SugiyamaLayout::layout().
+    Q_INVOKABLE bool    runSugiyama(qan::SugiyamaLayout* layout, qan::Node* root = nullptr, qreal xSpacing = 25., qreal ySpacing = 50.);
+    //! Run \c layout asynchronously on whole graph, see qan::ForceDirectedLayout::layout().
+    Q_INVOKABLE bool    runForceDirected(qan::ForceDirectedLayout* layout);
+
+    //! Cancel current run (without waiting for worker thread), or current animation (nodes stay where they are), cancelled() is emitted.
+    Q_INVOKABLE void    cancel();
+
+    //! True while a layout is computed or applied.
+    Q_PROPERTY(bool running READ getRunning NOTIFY runningChanged FINAL)
+    bool                getRunning() const noexcept { return _job != nullptr; }
+    //! Current layout computation progress in [0, 1].
+    Q_PROPERTY(qreal progress READ getProgress NOTIFY progressChanged FINAL)
+    qreal               getProgress() const noexcept { return _progress; }
+
+signals:
+    void                runningChanged();
+    void                progressChanged();
+    //! Emitted when result has been fully applied to graph.
+    void                finished();
+    //! Emitted when run has been cancelled with cancel() or by a new run.
+    void                cancelled();
+    //! Emitted when result has been discarded since graph has been modified during the run.
+    void                discarded();
+
+protected:
+    //! State shared with worker thread.
+    struct Task {
+        std::shared_ptr<const Snapshot>     snapshot;
+        std::atomic<bool>                   cancelled{false};
+        std::atomic<int>                    progress{0};    // Per thousand
+        //! Set by worker thread once it no longer access task, its thread can then be joined without blocking.
+        std::atomic<bool>                   done{false};
+        //! Runner results and progress are posted to, nullptr once worker has been released.
+        std::mutex                          mutex;
+        LayoutRunner*                       runner = nullptr;   // Protected by mutex
+    };
+    struct Job {
+        std::shared_ptr<Task>               task;
+        std::vector<QPointer<qan::Node>>    nodes;
+        std::size_t                         generation = 0;
+        std::size_t                         edgeCount = 0;
+        // Animation
+        std::vector<QPointF>                from;
+        std::vector<QPointF>                to;
+        int                                 frame = 0;
+    };
+
+    //! Called on GUI thread when worker thread has finished computing \c task.
+    void                onComputed(const std::shared_ptr<Task>& task, std::vector<QPointF> positions);
+    //! True if graph has been modified since \c job snapshot.
+    bool                isStale(const Job& job) const;
+    //! Apply animation next frame (called when graph window emit afterAnimating()).
+    void                animate();
+    //! Set nodes items position from \c positions in graph container item CS.
+    void                apply(const Job& job, const std::vector<QPointF>& positions);
+    //! Release current job and worker thread, optionally emitting cancelled().
+    void                stop(bool cancel);
+    /*! \brief Cancel \c task, worker no longer post anything to this runner.
+     *
+     * Worker thread is not waited for, it is kept in cancelled workers and joined once done, or at runner destruction.
+     */
+    void                release(const std::shared_ptr<Task>& task);
+    //! Join cancelled workers that are done, or all cancelled workers when \c wait is true.
+    void                joinCancelledWorkers(bool wait);
+    void                setProgress(qreal progress) noexcept;
+
+protected:
+    std::unique_ptr<Job>    _job;
+    std::thread             _thread;
+    struct CancelledWorker {
+        std::shared_ptr<Task>   task;
+        std::thread             thread;
+    };
+    std::vector<CancelledWorker>    _cancelledWorkers;
+    qreal                   _progress = 0.;
+    //! Incremented on each graph topology or geometry modification.
+    std::size_t             _generation = 0;
+    QMetaObject::Connection _frameConnection;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::LayoutRunner)
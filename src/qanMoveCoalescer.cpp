@@ -0,0 +1,113 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanMoveCoalescer.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Qt headers
+#include <QQuickItem>
+#include <QQuickWindow>
+
+// QuickQanava headers
+#include "./qanMoveCoalescer.h"
+
+namespace qan { // ::qan
+
+class MoveCoalescer::PolishItem : public QQuickItem
+{
+public:
+    explicit PolishItem(MoveCoalescer& coalescer) :
+        QQuickItem{},
+        _coalescer{coalescer}
+    {
+        setParent(&coalescer);      // Note: Owned by coalescer, window content item is only a visual parent
+        setVisible(false);
+    }
+protected:
+    virtual void    updatePolish() override { _coalescer.frame(); }
+private:
+    MoveCoalescer&  _coalescer;
+};
+
+/* MoveCoalescer Object Management *///----------------------------------------
+MoveCoalescer::MoveCoalescer(Handler handler, QObject* parent) :
+    QObject{parent},
+    _handler{std::move(handler)}
+{ }
+//-----------------------------------------------------------------------------
+
+/* Coalescing Management *///--------------------------------------------------
+void    MoveCoalescer::move(const QPointF& p, QQuickWindow* window)
+{
+    ++_moves;
+    if (window == nullptr) {        // No frame to synchronize with: apply immediately
+        flush();                    // Keep moves ordered if window has been reset during a drag
+        ++_applied;
+        if (_handler)
+            _handler(p);
+        return;
+    }
+    if (window != _window.data()) {
+        _window = window;
+        if (_polishItem == nullptr)
+            _polishItem = new PolishItem{*this};
+        _polishItem->setParentItem(window->contentItem());
+    }
+    _pendingPos = p;
+    _pending = true;
+    _polishItem->polish();          // Request a frame and apply move in its polish pass (no-op when already scheduled)
+}
+
+bool    MoveCoalescer::flush()
+{
+    if (!_pending)
+        return false;
+    _pending = false;
+    ++_applied;
+    if (_handler)
+        _handler(_pendingPos);
+    return true;
+}
+
+void    MoveCoalescer::cancel() noexcept { _pending = false; }
+
+void    MoveCoalescer::frame() { flush(); }
+//-----------------------------------------------------------------------------
+
+/* Coalescing Statistics *///--------------------------------------------------
+void    MoveCoalescer::resetStatistics() noexcept
+{
+    _moves = 0;
+    _applied = 0;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,126 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanMoveCoalescer.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstddef>
+#include <functional>
+
+// Qt headers
+#include <QObject>
+#include <QPointer>
+#include <QPointF>
+
+QT_BEGIN_NAMESPACE
+class QQuickWindow;
+QT_END_NAMESPACE
+
+namespace qan { // ::qan
+
+/*! \brief Coalesce high frequency pointer moves to a single move per rendered frame.
+ *
+ * Pointer devices might deliver several move events per frame: move() only record the latest position,
+ * handler is called once with the latest position during window next polish pass (ie on GUI thread,
+ * before the frame is synchronized with render thread). Items polished by handler (for example graph
+ * edge updates, culling or selection overlay) are polished in the same pass and thus in the same frame.
+ *
+ * A pending move must be applied synchronously with flush() before ending a drag or resize, so that
+ * final position is always the exact last pointer position.
+ *
+ * \nosubgrouping
+ */
+class MoveCoalescer : public QObject
+{
+    /*! \name MoveCoalescer Object Management *///-----------------------------
+    //@{
+    Q_OBJECT
+public:
+    using Handler = std::function<void(const QPointF&)>;
+
+    //! Construct a coalescer calling \c handler with coalesced positions.
+    explicit MoveCoalescer(Handler handler, QObject* parent = nullptr);
+    virtual ~MoveCoalescer() override = default;
+    MoveCoalescer(const MoveCoalescer&) = delete;
+private:
+    Handler     _handler;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Coalescing Management *///---------------------------------------
+    //@{
+public:
+    /*! \brief Record move to \c p, handler is called on \c window next frame.
+     *
+     * When \c window is nullptr (or coalescing is disabled by caller), move is applied immediately.
+     */
+    void        move(const QPointF& p, QQuickWindow* window);
+
+    //! Apply an eventual pending move synchronously, return true if handler has been called.
+    bool        flush();
+
+    //! Drop an eventual pending move without calling handler.
+    void        cancel() noexcept;
+
+    inline bool isPending() const noexcept { return _pending; }
+
+    //! Apply pending move (called from window polish pass).
+    void        frame();
+
+private:
+    bool                    _pending = false;
+    QPointF                 _pendingPos{0., 0.};
+    QPointer<QQuickWindow>  _window;
+    //! Invisible item parented to window content item, call frame() from its updatePolish().
+    class PolishItem;
+    PolishItem*             _polishItem = nullptr;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Coalescing Statistics *///---------------------------------------
+    //@{
+public:
+    //! Number of moves recorded with move().
+    inline std::size_t  getMoves() const noexcept { return _moves; }
+    //! Number of handler calls, ie number of moves actually applied.
+    inline std::size_t  getApplied() const noexcept { return _applied; }
+    void                resetStatistics() noexcept;
+private:
+    std::size_t         _moves = 0;
+    std::size_t         _applied = 0;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
@@ -0,0 +1,117 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanNativeEdgeItem.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+
+// Qt headers
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+
+// QuickQanava headers
+#include "./qanNativeEdgeItem.h"
+#include "./qanEdgeBatchRenderer.h"
+#include "./qanGraph.h"
+#include "./qanUtils.h"
+
+namespace qan { // ::qan
+
+/* NativeEdgeItem Object Management *///---------------------------------------
+NativeEdgeItem::NativeEdgeItem(QQuickItem* parent) :
+    qan::EdgeItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+    for (const auto signal : {&qan::EdgeItem::lineGeometryChanged,  &qan::EdgeItem::controlPointsChanged,
+                              &qan::EdgeItem::dstAngleChanged,      &qan::EdgeItem::srcAngleChanged,
+                              &qan::EdgeItem::dstArrowGeometryChanged, &qan::EdgeItem::srcArrowGeometryChanged,
+                              &qan::EdgeItem::dstShapeChanged,      &qan::EdgeItem::srcShapeChanged,
+                              &qan::EdgeItem::selectedChanged,      &qan::EdgeItem::hiddenChanged,
+                              &qan::EdgeItem::batchRenderedChanged, &qan::EdgeItem::lodChanged})
+        connect(this, signal, this, &NativeEdgeItem::requestUpdate);
+    connect(this, &qan::EdgeItem::styleChanged,
+            this, &NativeEdgeItem::monitorStyle);
+}
+
+void    NativeEdgeItem::monitorStyle()
+{
+    if (_monitoredStyle)
+        disconnect(_monitoredStyle, nullptr, this, nullptr);
+    _monitoredStyle = getStyle();
+    qan::connectNotifySignals(_monitoredStyle, this, "requestUpdate()");
+    requestUpdate();
+}
+//-----------------------------------------------------------------------------
+
+/* Native Rendering *///-------------------------------------------------------
+void    NativeEdgeItem::requestUpdate() noexcept { polish(); }
+
+void    NativeEdgeItem::updatePolish()
+{
+    _vertices.clear();
+    if (!getHidden() &&
+        !getBatchRendered() &&      // Edge is drawn by graph edge batch renderer
+        getLod() != qan::NodeItem::Lod::Minimal) {
+        const auto graph = getGraph();
+        const auto selectionColor = graph != nullptr ? graph->getSelectionColor() : QColor{Qt::darkBlue};
+        qan::EdgeBatchRenderer::appendEdge(_vertices, _polyline, *this, QPointF{0., 0.}, selectionColor);
+    }
+    update();
+}
+
+QSGNode*    NativeEdgeItem::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data);
+    if (_vertices.empty()) {
+        delete oldNode;
+        return nullptr;
+    }
+    auto node = static_cast<QSGGeometryNode*>(oldNode);
+    if (node == nullptr) {
+        node = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_ColoredPoint2D(), 0};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGVertexColorMaterial{});
+        node->setFlag(QSGNode::OwnsMaterial);
+    }
+    const auto vertexCount = static_cast<int>(_vertices.size());
+    node->geometry()->allocate(vertexCount);
+    std::copy_n(_vertices.data(), vertexCount, node->geometry()->vertexDataAsColoredPoint2D());
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,95 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanNativeEdgeItem.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <vector>
+
+// Qt headers
+#include <QQuickItem>
+#include <QPointer>
+#include <QSGGeometry>
+
+// QuickQanava headers
+#include "./qanEdgeItem.h"
+
+namespace qan { // ::qan
+
+/*! \brief Default edge delegate implemented in C++, edge line, selection and end shapes are drawn in a single scene graph node.
+ *
+ * NativeEdgeItem is a lightweight alternative to the default Edge.qml delegate: line is tessellated on CPU with the
+ * same code than qan::EdgeBatchRenderer and do not rely on a QML Shape. It is created by qan::Graph instead of
+ * Edge.qml when qan::Graph::nativeDelegates is enabled.
+ *
+ * \note Line is not antialiased, enable multisampling on the window for smooth edges.
+ * \nosubgrouping
+ */
+class NativeEdgeItem : public qan::EdgeItem
+{
+    /*! \name NativeEdgeItem Object Management *///----------------------------
+    //@{
+    Q_OBJECT
+    QML_ELEMENT
+public:
+    explicit NativeEdgeItem(QQuickItem* parent = nullptr);
+    virtual ~NativeEdgeItem() override = default;
+    NativeEdgeItem(const NativeEdgeItem&) = delete;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Native Rendering *///--------------------------------------------
+    //@{
+public slots:
+    //! Schedule edge tessellation before next frame (ie after a geometry, selection or style change).
+    void            requestUpdate() noexcept;
+
+protected:
+    virtual void        updatePolish() override;
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+private:
+    //! Monitor current edge style properties.
+    void            monitorStyle();
+
+    QPointer<qan::EdgeStyle>                    _monitoredStyle;
+    std::vector<QSGGeometry::ColoredPoint2D>    _vertices;
+    std::vector<QPointF>                        _polyline;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::NativeEdgeItem)
@@ -0,0 +1,350 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanNativeNodeItem.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+
+// Qt headers
+#include <QGuiApplication>
+#include <QFontMetricsF>
+#include <QQuickWindow>
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+#include <QTextLine>
+#include <QtMath>
+#if QT_VERSION >= QT_VERSION_CHECK(6, 7, 0)
+#include <QSGTextNode>
+#else
+#include <QPainter>
+#include <QSGImageNode>
+#endif
+
+// QuickQanava headers
+#include "./qanNativeNodeItem.h"
+#include "./qanNode.h"
+#include "./qanStyle.h"
+#include "./qanUtils.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::anonymous
+
+using Vertex = QSGGeometry::ColoredPoint2D;
+
+//! QSGVertexColorMaterial expect premultiplied colors.
+Vertex  makeVertex(const QPointF& p, const QColor& color) noexcept
+{
+    const auto a = color.alphaF();
+    Vertex v;
+    v.set(static_cast<float>(p.x()), static_cast<float>(p.y()),
+          static_cast<uchar>(qRound(color.redF() * a * 255.)),
+          static_cast<uchar>(qRound(color.greenF() * a * 255.)),
+          static_cast<uchar>(qRound(color.blueF() * a * 255.)),
+          static_cast<uchar>(qRound(a * 255.)));
+    return v;
+}
+
+QColor  mixColors(const QColor& a, const QColor& b, qreal t) noexcept
+{
+    t = std::clamp(t, 0., 1.);
+    return QColor::fromRgbF(static_cast<float>(a.redF() + (b.redF() - a.redF()) * t),
+                            static_cast<float>(a.greenF() + (b.greenF() - a.greenF()) * t),
+                            static_cast<float>(a.blueF() + (b.blueF() - a.blueF()) * t),
+                            static_cast<float>(a.alphaF() + (b.alphaF() - a.alphaF()) * t));
+}
+
+/*! \brief Generate \c rect rounded rectangle outline with \c segments segments per corner (clockwise, top left corner first).
+ *
+ * Outline always has 4 * (segments + 1) points, even for a null radius, so that an outline and its inset
+ * outline could be joined point to point.
+ */
+void    roundedOutline(std::vector<QPointF>& outline, const QRectF& rect, qreal radius, int segments)
+{
+    outline.clear();
+    radius = std::clamp(radius, 0., std::min(rect.width(), rect.height()) / 2.);
+    const QPointF centers[4] = { {rect.left() + radius, rect.top() + radius},
+                                 {rect.right() - radius, rect.top() + radius},
+                                 {rect.right() - radius, rect.bottom() - radius},
+                                 {rect.left() + radius, rect.bottom() - radius} };
+    for (int corner = 0; corner < 4; corner++) {
+        const auto start = M_PI + corner * (M_PI / 2.);     // Top left corner start on the left side
+        for (int s = 0; s <= segments; s++) {
+            const auto angle = start + s * (M_PI / 2.) / segments;
+            outline.emplace_back(centers[corner].x() + radius * std::cos(angle),
+                                 centers[corner].y() + radius * std::sin(angle));
+        }
+    }
+}
+
+} // ::qan::anonymous
+
+/* NativeNodeItem Object Management *///---------------------------------------
+NativeNodeItem::NativeNodeItem(QQuickItem* parent) :
+    qan::NodeItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+    setSize(QSizeF{110., 50.});     // Default to Node.qml size
+    connect(this, &qan::NodeItem::nodeChanged,
+            this, &NativeNodeItem::monitorNode);
+    connect(this, &qan::NodeItem::styleChanged,
+            this, &NativeNodeItem::monitorStyle);
+    connect(this, &qan::NodeItem::lodChanged,
+            this, &NativeNodeItem::requestUpdate);
+}
+
+void    NativeNodeItem::monitorNode()
+{
+    if (_monitoredNode)
+        disconnect(_monitoredNode, nullptr, this, nullptr);
+    _monitoredNode = getNode();
+    if (_monitoredNode)
+        connect(_monitoredNode, &qan::Node::labelChanged,
+                this,           &NativeNodeItem::requestUpdate);
+    requestUpdate();
+}
+
+void    NativeNodeItem::monitorStyle()
+{
+    if (_monitoredStyle)
+        disconnect(_monitoredStyle, nullptr, this, nullptr);
+    _monitoredStyle = getStyle();
+    qan::connectNotifySignals(_monitoredStyle, this, "requestUpdate()");
+    requestUpdate();
+}
+//-----------------------------------------------------------------------------
+
+/* Native Rendering *///-------------------------------------------------------
+void    NativeNodeItem::appendBackground(std::vector<QSGGeometry::ColoredPoint2D>& vertices,
+                                         const QRectF& rect, qreal radius, qreal borderWidth,
+                                         const QColor& topColor, const QColor& bottomColor, const QColor& borderColor)
+{
+    // Algorithm:
+        // 1. Generate outer outline and inner (inset by border width) outline with the same point count.
+        // 2. Fill inner outline with a triangle fan from rect center, vertex color interpolated on y.
+        // 3. Join outer and inner outlines with quads for border.
+    if (!rect.isValid())
+        return;
+    borderWidth = std::clamp(borderWidth, 0., std::min(rect.width(), rect.height()) / 2.);
+    radius = std::clamp(radius, 0., std::min(rect.width(), rect.height()) / 2.);
+    const int segments = std::clamp(static_cast<int>(radius / 2.), 1, 8);
+
+    std::vector<QPointF> outer, inner;
+    roundedOutline(outer, rect, radius, segments);
+    if (borderWidth > 0.)
+        roundedOutline(inner, rect.adjusted(borderWidth, borderWidth, -borderWidth, -borderWidth),
+                       std::max(0., radius - borderWidth), segments);
+    else
+        inner = outer;
+
+    const auto colorAt = [&](const QPointF& p) {
+        return mixColors(topColor, bottomColor, (p.y() - rect.top()) / rect.height());
+    };
+    const auto center = rect.center();
+    const auto centerVertex = makeVertex(center, colorAt(center));
+    const auto n = inner.size();
+    vertices.reserve(vertices.size() + n * (borderWidth > 0. ? 9 : 3));
+    for (std::size_t i = 0; i < n; i++) {
+        const auto& a = inner[i];
+        const auto& b = inner[(i + 1) % n];
+        vertices.push_back(centerVertex);
+        vertices.push_back(makeVertex(a, colorAt(a)));
+        vertices.push_back(makeVertex(b, colorAt(b)));
+    }
+    if (borderWidth > 0.) {
+        for (std::size_t i = 0; i < n; i++) {
+            const auto j = (i + 1) % n;
+            const auto oi = makeVertex(outer[i], borderColor);
+            const auto oj = makeVertex(outer[j], borderColor);
+            const auto ii = makeVertex(inner[i], borderColor);
+            const auto ij = makeVertex(inner[j], borderColor);
+            vertices.insert(vertices.end(), {oi, oj, ii, ii, oj, ij});
+        }
+    }
+}
+
+void    NativeNodeItem::requestUpdate() noexcept { polish(); }
+
+void    NativeNodeItem::geometryChange(const QRectF& newGeometry, const QRectF& oldGeometry)
+{
+    qan::NodeItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size())
+        requestUpdate();
+}
+
+void    NativeNodeItem::updatePolish()
+{
+    _vertices.clear();
+    const auto style = getStyle();
+    const auto node = getNode();
+    const QRectF rect{0., 0., width(), height()};
+    _labelLayout.reset();
+    _labelDirty = true;
+    const auto effectType = style != nullptr ? style->getEffectType() : qan::NodeStyle::EffectType::EffectNone;
+    const bool effect = getLod() == Lod::Full &&
+                        (effectType == qan::NodeStyle::EffectType::EffectShadow ||
+                         effectType == qan::NodeStyle::EffectType::EffectGlow);
+    if (effect &&
+        !_effect) {
+        _effect = new qan::RectEffect{this};
+        _effect->setZ(-1.);     // Under node background
+    }
+    if (_effect) {
+        _effect->setVisible(effect);
+        _effect->setSize(size());
+        _effect->setStyle(style);
+        _effect->setEffectType(effectType);
+    }
+    if (style == nullptr ||
+        !rect.isValid() ||
+        getLod() == Lod::Minimal) {     // Minimal level of detail is drawn by graph batch renderer
+        update();
+        return;
+    }
+
+    // Background and border
+    const auto radius = style->getBackRadius();
+    setBoundingShapeRadius(radius);
+    const auto opacity = std::clamp(style->getBackOpacity(), 0., 1.);
+    const auto withOpacity = [opacity](QColor c) {
+        c.setAlphaF(static_cast<float>(c.alphaF() * opacity));
+        return c;
+    };
+    const bool gradient = style->getFillType() == qan::NodeStyle::FillType::FillGradient;
+    // Note: In gradient mode Node.qml draw an opaque border over a transparent background
+    appendBackground(_vertices, rect, radius, style->getBorderWidth(),
+                     withOpacity(gradient ? style->getBaseColor() : style->getBackColor()),
+                     withOpacity(style->getBackColor()),
+                     gradient ? style->getBorderColor() : withOpacity(style->getBorderColor()));
+
+    // Label, abbreviated to a single line when level of detail is simplified
+    const auto label = node != nullptr ? node->getLabel() : QString{};
+    if (!label.isEmpty()) {
+        auto font = QGuiApplication::font();
+        if (style->getFontPointSize() > 0)
+            font.setPointSize(style->getFontPointSize());
+        font.setBold(style->getFontBold());
+        const auto margin = std::max(radius / 2., 2.) + style->getBorderWidth();
+        const auto lineWidth = std::max(1., rect.width() - 2. * margin);
+
+        const auto maxLines = getLod() == Lod::Full ? maxLabelLines : 1;
+        _labelLayout = std::make_unique<QTextLayout>(maxLines > 1 ? label :
+                                                                    QFontMetricsF{font}.elidedText(label, Qt::ElideRight, lineWidth),
+                                                     font);
+        QTextOption option{Qt::AlignHCenter};
+        option.setWrapMode(QTextOption::WrapAtWordBoundaryOrAnywhere);
+        _labelLayout->setTextOption(option);
+        _labelLayout->beginLayout();
+        qreal labelHeight = 0.;
+        for (int l = 0; l < maxLines; l++) {
+            auto line = _labelLayout->createLine();
+            if (!line.isValid())
+                break;
+            line.setLineWidth(lineWidth);
+            line.setPosition(QPointF{0., labelHeight});
+            labelHeight += line.height();
+        }
+        _labelLayout->endLayout();
+        _labelPosition = QPointF{margin, (rect.height() - labelHeight) / 2.};
+        _labelColor = style->getLabelColor();
+#if QT_VERSION < QT_VERSION_CHECK(6, 7, 0)
+        const auto dpr = window() != nullptr ? window()->effectiveDevicePixelRatio() : 1.;
+        _labelImage = QImage{QSize{qCeil(lineWidth * dpr), qCeil(labelHeight * dpr)},
+                             QImage::Format_ARGB32_Premultiplied};
+        _labelImage.setDevicePixelRatio(dpr);
+        _labelImage.fill(Qt::transparent);
+        QPainter painter{&_labelImage};
+        painter.setPen(_labelColor);
+        _labelLayout->draw(&painter, QPointF{0., 0.});
+#endif
+    }
+    update();
+}
+
+QSGNode*    NativeNodeItem::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data);
+    if (_vertices.empty() ||
+        window() == nullptr) {
+        delete oldNode;
+        return nullptr;
+    }
+    // Root node own a background geometry node and an optional label node
+    if (oldNode == nullptr)
+        _labelDirty = true;
+    auto root = oldNode != nullptr ? oldNode : new QSGNode{};
+    auto background = static_cast<QSGGeometryNode*>(root->firstChild());
+    if (background == nullptr) {
+        background = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_ColoredPoint2D(), 0};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        background->setGeometry(geometry);
+        background->setFlag(QSGNode::OwnsGeometry);
+        background->setMaterial(new QSGVertexColorMaterial{});
+        background->setFlag(QSGNode::OwnsMaterial);
+        root->appendChildNode(background);
+    }
+    const auto vertexCount = static_cast<int>(_vertices.size());
+    background->geometry()->allocate(vertexCount);
+    std::copy_n(_vertices.data(), vertexCount, background->geometry()->vertexDataAsColoredPoint2D());
+    background->markDirty(QSGNode::DirtyGeometry);
+
+    if (_labelDirty) {
+        _labelDirty = false;
+        if (auto label = background->nextSibling()) {
+            root->removeChildNode(label);
+            delete label;
+        }
+        if (_labelLayout) {
+#if QT_VERSION >= QT_VERSION_CHECK(6, 7, 0)
+            auto label = window()->createTextNode();
+            label->setColor(_labelColor);
+            label->addTextLayout(_labelPosition, _labelLayout.get());
+            root->appendChildNode(label);
+#else
+            if (!_labelImage.isNull()) {
+                auto label = window()->createImageNode();
+                label->setTexture(window()->createTextureFromImage(_labelImage));
+                label->setOwnsTexture(true);
+                label->setRect(QRectF{_labelPosition, _labelImage.deviceIndependentSize()});
+                root->appendChildNode(label);
+            }
+#endif
+        }
+    }
+    return root;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,132 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanNativeNodeItem.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <memory>
+#include <vector>
+
+// Qt headers
+#include <QQuickItem>
+#include <QPointer>
+#include <QSGGeometry>
+#include <QTextLayout>
+#include <QImage>
+
+// QuickQanava headers
+#include "./qanNodeItem.h"
+#include "./qanRectEffect.h"
+
+namespace qan { // ::qan
+
+/*! \brief Default node delegate implemented in C++, background, border and label are drawn directly in scene graph nodes.
+ *
+ * NativeNodeItem is a lightweight alternative to the default Node.qml delegate (RectNodeTemplate, background
+ * loader, effects, label editor): a node is a single QQuickItem with no QML object. It is created by qan::Graph
+ * instead of Node.qml when qan::Graph::nativeDelegates is enabled.
+ *
+ * Following qan::NodeStyle properties are supported: \c backRadius, \c backOpacity, \c fillType (solid and vertical
+ * gradient), \c backColor, \c baseColor, \c borderColor, \c borderWidth, \c fontPointSize, \c fontBold and
+ * \c labelColor. Label is centered and wrapped on at most \c maxLabelLines lines, \c lod is supported. Shadow
+ * and glow \c effectType are drawn with a qan::RectEffect child item.
+ *
+ * \note Node label can't be edited with a double click, background is not antialiased (enable multisampling on
+ * the window for smooth corners).
+ * \nosubgrouping
+ */
+class NativeNodeItem : public qan::NodeItem
+{
+    /*! \name NativeNodeItem Object Management *///----------------------------
+    //@{
+    Q_OBJECT
+    QML_ELEMENT
+public:
+    explicit NativeNodeItem(QQuickItem* parent = nullptr);
+    virtual ~NativeNodeItem() override = default;
+    NativeNodeItem(const NativeNodeItem&) = delete;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Native Rendering *///--------------------------------------------
+    //@{
+public:
+    //! Maximum number of label lines.
+    static constexpr int    maxLabelLines = 3;
+
+    /*! \brief Append \c rect background triangles rounded with \c radius to \c vertices.
+     *
+     * Background is filled with a vertical gradient from \c topColor to \c bottomColor inside a \c borderWidth wide
+     * \c borderColor border. Colors are expected with their final opacity.
+     */
+    static void     appendBackground(std::vector<QSGGeometry::ColoredPoint2D>& vertices,
+                                     const QRectF& rect, qreal radius, qreal borderWidth,
+                                     const QColor& topColor, const QColor& bottomColor, const QColor& borderColor);
+
+public slots:
+    //! Schedule background and label update before next frame (ie after a style, label or size change).
+    void            requestUpdate() noexcept;
+
+protected:
+    virtual void        updatePolish() override;
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+    virtual void        geometryChange(const QRectF& newGeometry, const QRectF& oldGeometry) override;
+
+private:
+    //! Monitor current node label and style properties.
+    void            monitorNode();
+    void            monitorStyle();
+
+    QPointer<qan::Node>         _monitoredNode;
+    QPointer<qan::NodeStyle>    _monitoredStyle;
+    //! Shadow or glow effect item, created when style \c effectType require one.
+    QPointer<qan::RectEffect>   _effect;
+
+    std::vector<QSGGeometry::ColoredPoint2D>    _vertices;
+    std::unique_ptr<QTextLayout>                _labelLayout;
+    QPointF                                     _labelPosition;
+    QColor                                      _labelColor;
+    //! True when label scene graph node must be generated again.
+    bool                                        _labelDirty = true;
+#if QT_VERSION < QT_VERSION_CHECK(6, 7, 0)
+    //! Label rasterized with QPainter when QSGTextNode is not available.
+    QImage                                      _labelImage;
+#endif
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::NativeNodeItem)
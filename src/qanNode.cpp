@@ -87,6 +87,13 @@ void    Node::setItem(qan::NodeItem* nodeItem) noexcept
             nodeItem->setNode(this);
     }
 }
+
+qan::NodeItem*  Node::takeItem() noexcept
+{
+    const auto item = _item.data();
+    _item.clear();
+    return item;
+}
 //-----------------------------------------------------------------------------
 
 /* Node Static Factories *///--------------------------------------------------
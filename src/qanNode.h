@@ -97,6 +97,8 @@ public:
     qan::NodeItem*          getItem() noexcept;
     const qan::NodeItem*    getItem() const noexcept;
     virtual void            setItem(qan::NodeItem* nodeItem) noexcept;
+    //! Detach and return node item without destroying it (item is no longer destroyed with this node).
+    qan::NodeItem*          takeItem() noexcept;
 protected:
     QPointer<qan::NodeItem> _item;
     //@}
@@ -35,6 +35,8 @@
 // Std headers
 #include <algorithm>    // std::for_each
 #include <utility>      // std::as_const
+#include <cmath>
+#include <limits>
 
 // Qt headers
 #include <QPainter>
@@ -43,6 +45,7 @@
 // QuickQanava headers
 #include "./qanNode.h"
 #include "./qanNodeItem.h"
+#include "./qanEdgeGeometryStore.h"
 #include "./qanGraph.h"
 #include "./qanDraggableCtrl.h"
 
@@ -96,6 +99,7 @@ auto    NodeItem::setNode(qan::Node* node) noexcept -> void {
         _node = node;
         const auto nodeDraggableCtrl = static_cast<DraggableCtrl*>(_draggableCtrl.get());
         nodeDraggableCtrl->setTarget(node);
+        emit nodeChanged();
     }
 }
 
@@ -211,6 +215,41 @@ void    NodeItem::collapseChilds(bool collapsed)
 }
 //-----------------------------------------------------------------------------
 
+/* Delegate Pooling Management *///--------------------------------------------
+void    NodeItem::saveDelegateDefaults() noexcept
+{
+    _delegateDefaults.saved = true;
+    _delegateDefaults.position = position();
+    _delegateDefaults.size = size();
+    _delegateDefaults.minimumSize = _minimumSize;
+    _delegateDefaults.resizable = _resizable;
+    _delegateDefaults.collapsed = _collapsed;
+}
+
+void    NodeItem::recycle()
+{
+    setSelectedState(false);    // Note: do not use setSelected(), node has already been removed from graph selection
+    setNode(nullptr);
+    setDragged(false);
+    setLod(Lod::Full);
+    if (_delegateDefaults.saved) {
+        setCollapsed(_delegateDefaults.collapsed);
+        setResizable(_delegateDefaults.resizable);
+        setMinimumSize(_delegateDefaults.minimumSize);
+        setPosition(_delegateDefaults.position);
+        setSize(_delegateDefaults.size);
+    }
+    setVisible(false);
+    setParentItem(nullptr);
+    emit pooled();
+}
+
+void    NodeItem::reuse()
+{
+    emit reused();
+}
+//-----------------------------------------------------------------------------
+
 /* Selection Management *///---------------------------------------------------
 void    NodeItem::onWidthChanged() { configureSelectionItem(); }
 
@@ -395,6 +434,17 @@ void    NodeItem::styleDestroyed(QObject* style)
 //-----------------------------------------------------------------------------
 
 
+/* Level of Detail Management *///-------------------------------------------
+bool    NodeItem::setLod(Lod lod) noexcept
+{
+    if (lod == _lod)
+        return false;
+    _lod = lod;
+    emit lodChanged();
+    return true;
+}
+//-----------------------------------------------------------------------------
+
 /* Intersection Shape Management *///------------------------------------------
 QPolygonF   NodeItem::getBoundingShape()
 {
@@ -406,20 +456,36 @@ QPolygonF   NodeItem::getBoundingShape()
 void    NodeItem::setBoundingShape(const QPolygonF& boundingShape)
 {
     _boundingShape = boundingShape;
+    _boundingShapeType = BoundingShapeType::Polygon;
     emit boundingShapeChanged();
 }
 
 void    NodeItem::setDefaultBoundingShape()
 {
-    setBoundingShape(generateDefaultBoundingShape());
+    if (_boundingShapeType == BoundingShapeType::Polygon)
+        _boundingShapeType = BoundingShapeType::RoundedRect;
+    _boundingShape.clear();     // Note: polygon is lazily regenerated in getBoundingShape()
+    emit boundingShapeChanged();
 }
 
 QPolygonF    NodeItem::generateDefaultBoundingShape() const
 {
+    const QRectF br{0., 0., width(), height()};
+    switch (_boundingShapeType) {
+    case BoundingShapeType::Rect:
+        return QPolygonF{br};
+    case BoundingShapeType::Ellipse: {
+        QPainterPath path;
+        path.addEllipse(br);
+        return path.toFillPolygon(QTransform{});
+    }
+    case BoundingShapeType::Polygon:    // [[fallthrough]] Polygon default to rounded rectangle
+    case BoundingShapeType::RoundedRect:
+        break;
+    }
     // Generate a rounded rectangular intersection shape for this node rect new geometry
     QPainterPath path;
-    qreal shapeRadius = 5.;   // In percentage = 5% !
-    path.addRoundedRect(QRectF{ 0., 0., width(), height() }, shapeRadius, shapeRadius);
+    path.addRoundedRect(br, _boundingShapeRadius, _boundingShapeRadius);
     return path.toFillPolygon(QTransform{});
 }
 
@@ -429,15 +495,86 @@ void    NodeItem::setBoundingShape(QVariantList boundingShape)
     int p = 0;
     for (const auto& vp : boundingShape)
         shape[p++] = vp.toPointF();
-    _boundingShape = (!shape.isEmpty( ) ? shape : generateDefaultBoundingShape());
-    emit boundingShapeChanged();
+    if (shape.isEmpty())
+        setDefaultBoundingShape();
+    else
+        setBoundingShape(shape);
 }
 
 bool    NodeItem::isInsideBoundingShape(QPointF p)
 {
+    if (_boundingShapeType != BoundingShapeType::Polygon) {
+        const QRectF br{0., 0., width(), height()};
+        const auto c = br.center();
+        const qreal t = boundingShapeRayExit(_boundingShapeType, _boundingShapeRadius,
+                                             p.x() - c.x(), p.y() - c.y(), br.width() / 2., br.height() / 2.);
+        return t >= 1.;
+    }
     if (_boundingShape.isEmpty())
-        setBoundingShape(generateDefaultBoundingShape());
-    return _boundingShape.containsPoint(p, Qt::OddEvenFill);
+        setDefaultBoundingShape();
+    return getBoundingShape().containsPoint(p, Qt::OddEvenFill);
+}
+
+void    NodeItem::setBoundingShapeType(BoundingShapeType boundingShapeType)
+{
+    if (boundingShapeType == _boundingShapeType)
+        return;
+    _boundingShapeType = boundingShapeType;
+    if (_boundingShapeType != BoundingShapeType::Polygon)
+        _boundingShape.clear();
+    emit boundingShapeChanged();
+}
+
+void    NodeItem::setBoundingShapeRadius(qreal boundingShapeRadius)
+{
+    if (qFuzzyCompare(1. + boundingShapeRadius, 1. + _boundingShapeRadius))
+        return;
+    _boundingShapeRadius = boundingShapeRadius;
+    if (_boundingShapeType == BoundingShapeType::RoundedRect)
+        _boundingShape.clear();
+    emit boundingShapeChanged();
+}
+
+auto    NodeItem::getBoundingShapeDescriptor() const noexcept -> BoundingShapeDescriptor
+{
+    BoundingShapeDescriptor descriptor;
+    descriptor.type = _boundingShapeType;
+    descriptor.rect = QRectF{0., 0., width(), height()};
+    descriptor.radius = _boundingShapeType == BoundingShapeType::RoundedRect ? _boundingShapeRadius : 0.;
+    return descriptor;
+}
+
+bool    NodeItem::intersectBoundingShape(BoundingShapeType type, qreal radius,
+                                         const QRectF& br, const QPointF& p, QPointF& intersection) noexcept
+{
+    if (type == BoundingShapeType::Polygon)
+        return false;
+    const auto c = br.center();
+    const qreal dx = p.x() - c.x();
+    const qreal dy = p.y() - c.y();
+    const qreal t = boundingShapeRayExit(type, radius, dx, dy, br.width() / 2., br.height() / 2.);
+    if (t >= 1.)
+        return false;
+    intersection = QPointF{c.x() + (dx * t), c.y() + (dy * t)};
+    return true;
+}
+
+qreal   NodeItem::boundingShapeRayExit(BoundingShapeType type, qreal radius,
+                                       qreal dx, qreal dy, qreal hw, qreal hh) noexcept
+{
+    constexpr qreal inf = std::numeric_limits<qreal>::infinity();
+    const qreal adx = std::abs(dx);     // Solve in first quadrant, all shapes are symmetric
+    const qreal ady = std::abs(dy);
+    if (type == BoundingShapeType::Ellipse) {
+        if (hw <= 0. || hh <= 0.)
+            return 0.;
+        const qreal ex = adx / hw;
+        const qreal ey = ady / hh;
+        const qreal e2 = (ex * ex) + (ey * ey);
+        return e2 > 0. ? 1. / std::sqrt(e2) : inf;
+    }
+    // Note: Rect and rounded rect solver is shared with qan::EdgeGeometryStore batch kernels.
+    return qan::impl::roundedRectRayExit(dx, dy, hw, hh, type == BoundingShapeType::RoundedRect ? radius : 0.);
 }
 //-----------------------------------------------------------------------------
 
@@ -44,6 +44,7 @@
 #include <QPolygonF>
 #include <QDrag>
 #include <QPointer>
+#include <QQmlComponent>
 
 // QuickQanava headers
 #include "./qanStyle.h"
@@ -72,6 +73,9 @@ class Graph;
  *
  * Optionally, you could choose to set \c complexBoundingShape to false and override \c generateDefaultBoundingShape() method.
  *
+ * For rectangular, rounded rectangular and elliptic nodes, prefer setting \c boundingShapeType: edges ends are then
+ * generated analytically with no polygon generation.
+ *
  * \warning NodeItem \c objectName property is set to "qan::NodeItem" and should not be changed in subclasses.
  *
  * \nosubgrouping
@@ -101,12 +105,15 @@ public:
     /*! \name Topology Management *///-----------------------------------------
     //@{
 public:
-    Q_PROPERTY(qan::Node* node READ getNode CONSTANT FINAL)
+    //! Item node, could change when item is reused from qan::Graph delegate pool.
+    Q_PROPERTY(qan::Node* node READ getNode NOTIFY nodeChanged FINAL)
     auto        getNode() noexcept -> qan::Node*;
     auto        getNode() const noexcept -> const qan::Node*;
     auto        setNode(qan::Node* node) noexcept -> void;
 private:
     QPointer<qan::Node> _node{nullptr};
+signals:
+    void        nodeChanged();
 
 public:
     //! Secure shortcut to getNode().getGraph().
@@ -156,6 +163,52 @@ public:
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Delegate Pooling Management *///--------------------------------
+    //@{
+public:
+    //! Component used to create this item, set by qan::Graph (used to pool item, see qan::Graph::delegatePooling).
+    inline QQmlComponent*   getDelegateComponent() const noexcept { return _delegateComponent.data(); }
+    //! \copydoc getDelegateComponent()
+    inline void             setDelegateComponent(QQmlComponent* delegateComponent) noexcept { _delegateComponent = delegateComponent; }
+private:
+    QPointer<QQmlComponent> _delegateComponent;
+
+public:
+    //! Save current geometry and state as delegate defaults restored by recycle() (internal, called by qan::Graph once item is created).
+    void            saveDelegateDefaults() noexcept;
+private:
+    struct DelegateDefaults {
+        bool    saved = false;
+        QPointF position;
+        QSizeF  size;
+        QSizeF  minimumSize;
+        bool    resizable = true;
+        bool    collapsed = false;
+    };
+    DelegateDefaults    _delegateDefaults;
+
+public:
+    /*! \brief Detach this item from it's node before it is stored in qan::Graph delegate pool (internal).
+     *
+     * Item is unselected, hidden and removed from graph container, node is reset to nullptr. Position, size,
+     * minimum size, resizable and collapsed state are restored to delegate defaults (see saveDelegateDefaults()),
+     * dragged is reset and level of detail is set to \c Full, then \c pooled() is emitted.
+     */
+    virtual void    recycle();
+    //! Called by qan::Graph once a pooled item has been bound to a new node (internal), emit \c reused().
+    virtual void    reuse();
+signals:
+    /*! \brief Emitted when this item has been released to qan::Graph delegate pool.
+     *
+     * Custom delegates with transient state (animations, text edition, custom size, etc.) should reset
+     * it from this handler, since item could later be reused for another node.
+     */
+    void            pooled();
+    //! Emitted when this item is reused from qan::Graph delegate pool, \c node, \c graph and \c style are already set.
+    void            reused();
+    //@}
+    //-------------------------------------------------------------------------
+
 
     /*! \name Selection Management *///----------------------------------------
     //@{
@@ -343,6 +396,34 @@ private slots:
     //@}
     //-------------------------------------------------------------------------
 
+    /*! \name Level of Detail Management *///--------------------------------
+    //@{
+public:
+    /*! \brief Level of detail used to render node, group and edge delegates (see qan::Graph::levelOfDetail).
+     *
+     * \li \c Full: Full detail rendering (effects, ports, full labels).
+     * \li \c Simplified: Delegates should disable effects, ports and docks and abbreviate labels.
+     * \li \c Minimal: Delegates should not render anything, nodes, groups and edges are drawn as solid rects and
+     * straight lines by qan::Graph edge batch renderer.
+     */
+    enum class Lod : unsigned int {
+        Full        = 0,
+        Simplified  = 1,
+        Minimal     = 2
+    };
+    Q_ENUM(Lod)
+
+    //! Current item level of detail, set by qan::Graph according to view zoom, custom delegates could bind to it (default to Full).
+    Q_PROPERTY(qan::NodeItem::Lod lod READ getLod NOTIFY lodChanged FINAL)
+    inline Lod      getLod() const noexcept { return _lod; }
+    bool            setLod(Lod lod) noexcept;
+private:
+    Lod             _lod = Lod::Full;
+signals:
+    void            lodChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
     /*! \name Intersection Shape Management *///-------------------------------
     //@{
 signals:
@@ -366,16 +447,75 @@ public:
     Q_INVOKABLE void    setBoundingShape(const QPolygonF& boundingShape);
 
 public slots:
-    //! Generate a default bounding shape (rounded rectangle) and set it as current bounding shape.
+    //! Generate a default bounding shape (of \c boundingShapeType, rounded rectangle if type was Polygon) and set it as current bounding shape.
     Q_INVOKABLE void    setDefaultBoundingShape();
 signals:
     void                boundingShapeChanged();
     //! signal is Emitted when the bounding shape become invalid and should be regenerated from QML.
     void                requestUpdateBoundingShape();
 public:
+    //! Generate a polygon for current \c boundingShapeType analytic shape (rounded rectangle for Polygon type).
     QPolygonF           generateDefaultBoundingShape() const;
+    //! Default bounding shape corner radius.
+    static constexpr qreal  defaultBoundingShapeRadius = 5.;
 private:
     QPolygonF           _boundingShape;
+
+public:
+    //! Bounding shape type, analytic types are intersected with edges without polygon walking.
+    enum class BoundingShapeType : unsigned int {
+        //! Arbitrary polygon set with setBoundingShape().
+        Polygon     = 0,
+        //! Node rectangle.
+        Rect        = 1,
+        //! Node rectangle with \c boundingShapeRadius rounded corners (default).
+        RoundedRect = 2,
+        //! Ellipse inscribed in node rectangle.
+        Ellipse     = 3
+    };
+    Q_ENUM(BoundingShapeType)
+
+    /*! \brief Node bounding shape type (default to RoundedRect).
+     *
+     * Automatically set to Polygon when a custom polygon is set with setBoundingShape(), for analytic types (Rect,
+     * RoundedRect and Ellipse) edges ends are generated analytically and bounding shape polygon is generated lazily
+     * only when \c boundingShape is accessed.
+     */
+    Q_PROPERTY(BoundingShapeType boundingShapeType READ getBoundingShapeType WRITE setBoundingShapeType NOTIFY boundingShapeChanged FINAL)
+    inline BoundingShapeType    getBoundingShapeType() const noexcept { return _boundingShapeType; }
+    void                        setBoundingShapeType(BoundingShapeType boundingShapeType);
+    //! Rounded corners radius for RoundedRect \c boundingShapeType (default to defaultBoundingShapeRadius).
+    Q_PROPERTY(qreal boundingShapeRadius READ getBoundingShapeRadius WRITE setBoundingShapeRadius NOTIFY boundingShapeChanged FINAL)
+    inline qreal                getBoundingShapeRadius() const noexcept { return _boundingShapeRadius; }
+    void                        setBoundingShapeRadius(qreal boundingShapeRadius);
+private:
+    BoundingShapeType   _boundingShapeType = BoundingShapeType::RoundedRect;
+    qreal               _boundingShapeRadius = defaultBoundingShapeRadius;
+
+public:
+    //! Node local bounding shape descriptor, shape is \c type inscribed in \c rect (radius is 0. except for RoundedRect).
+    struct BoundingShapeDescriptor {
+        BoundingShapeType   type = BoundingShapeType::RoundedRect;
+        QRectF              rect;
+        qreal               radius = 0.;
+        inline bool         isAnalytic() const noexcept { return type != BoundingShapeType::Polygon; }
+    };
+    //! Return current bounding shape descriptor in item local CS.
+    BoundingShapeDescriptor getBoundingShapeDescriptor() const noexcept;
+
+    /*! \brief Intersect segment (\c br center, \c p) with an analytic shape of type \c type inscribed in \c br.
+     *
+     * \c br could be expressed in any CS with no rotation (usually graph container CS). Return false and leave
+     * \c intersection unchanged if \c p is inside shape or if \c type is Polygon.
+     */
+    static bool         intersectBoundingShape(BoundingShapeType type, qreal radius,
+                                               const QRectF& br, const QPointF& p, QPointF& intersection) noexcept;
+    /*! \brief Return ray (center, center + \c dx, \c dy) parameter where it exit an analytic \c type shape of half size (\c hw, \c hh).
+     *
+     * Return infinity for a null direction.
+     */
+    static qreal        boundingShapeRayExit(BoundingShapeType type, qreal radius,
+                                             qreal dx, qreal dy, qreal hw, qreal hh) noexcept;
 protected:
     /*! \brief Invoke this method from a concrete node component in QML for non rectangular nodes.
      * \code
@@ -0,0 +1,171 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanRectEffect.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+
+// Qt headers
+#include <QQuickWindow>
+#include <QSGGeometryNode>
+#include <QSGTextureMaterial>
+
+// QuickQanava headers
+#include "./qanRectEffect.h"
+#include "./qanUtils.h"
+
+namespace qan { // ::qan
+
+/* RectEffect Object Management *///-------------------------------------------
+RectEffect::RectEffect(QQuickItem* parent) :
+    QQuickItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+    setEnabled(false);      // Effect do not handle any input
+}
+//-----------------------------------------------------------------------------
+
+/* Effect Configuration *///---------------------------------------------------
+void    RectEffect::setStyle(qan::NodeStyle* style) noexcept
+{
+    if (style == _style)
+        return;
+    if (_style)
+        disconnect(_style, nullptr, this, nullptr);
+    _style = style;
+    qan::connectNotifySignals(_style, this, "requestUpdate()");
+    requestUpdate();
+    emit styleChanged();
+}
+
+void    RectEffect::setEffectType(qan::NodeStyle::EffectType effectType) noexcept
+{
+    if (effectType == _effectType)
+        return;
+    _effectType = effectType;
+    requestUpdate();
+    emit effectTypeChanged();
+}
+
+void    RectEffect::requestUpdate() noexcept { update(); }
+//-----------------------------------------------------------------------------
+
+/* Effect Rendering *///-------------------------------------------------------
+void    RectEffect::itemChange(ItemChange change, const ItemChangeData& data)
+{
+    QQuickItem::itemChange(change, data);
+    if (change == QQuickItem::ItemSceneChange)
+        _atlas = qan::EffectAtlas::forWindow(data.window);
+}
+
+void    RectEffect::geometryChange(const QRectF& newGeometry, const QRectF& oldGeometry)
+{
+    QQuickItem::geometryChange(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size())
+        requestUpdate();
+}
+
+QSGNode*    RectEffect::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data);
+    // Note: GUI thread is blocked, style could be accessed safely
+    const auto style = _style.data();
+    const bool enabled = style != nullptr &&
+                         style->getEffectEnabled() &&
+                         (_effectType == qan::NodeStyle::EffectType::EffectShadow ||
+                          _effectType == qan::NodeStyle::EffectType::EffectGlow);
+    if (!enabled ||
+        !_atlas ||
+        width() <= 0. || height() <= 0.) {
+        delete oldNode;
+        return nullptr;
+    }
+    const auto shadow = _effectType == qan::NodeStyle::EffectType::EffectShadow;
+    const auto key = qan::EffectAtlas::makeKey(style->getBackRadius(), style->getEffectRadius(),
+                                               shadow ? style->getEffectOffset() : 0., style->getEffectColor());
+    const auto texture = _atlas->texture(key);
+    if (texture == nullptr) {
+        delete oldNode;
+        return nullptr;
+    }
+
+    auto node = static_cast<QSGGeometryNode*>(oldNode);
+    if (node == nullptr) {
+        node = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_TexturedPoint2D(), 16, 54};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGTextureMaterial{});
+        node->setFlag(QSGNode::OwnsMaterial);
+        const auto indices = geometry->indexDataAsUShort();     // 3x3 patches, two triangles per patch
+        for (int row = 0, i = 0; row < 3; row++)
+            for (int column = 0; column < 3; column++) {
+                const auto v = static_cast<quint16>((row * 4) + column);
+                for (const auto index : {v, quint16(v + 1), quint16(v + 4), quint16(v + 1), quint16(v + 5), quint16(v + 4)})
+                    indices[i++] = index;
+            }
+    }
+    auto material = static_cast<QSGTextureMaterial*>(node->material());
+    if (material->texture() != texture) {
+        material->setTexture(texture);
+        material->setFiltering(QSGTexture::Linear);
+        node->markDirty(QSGNode::DirtyMaterial);
+    }
+
+    // Nine-patch quad cover item rect moved by offset and expanded by blur extent, corners are not scaled
+    // unless item is smaller than two corners.
+    const qreal offset = key.offset;
+    const QRectF quad = QRectF{0., 0., width(), height()}.translated(offset, offset)
+                                                         .adjusted(-key.blur, -key.blur, key.blur, key.blur);
+    const qreal corner = qan::EffectAtlas::cornerSize(key);
+    const qreal imageSize = (2. * corner) + 1.;
+    const qreal cx = std::min(corner, quad.width() / 2.);
+    const qreal cy = std::min(corner, quad.height() / 2.);
+    const qreal xs[4] = {quad.left(), quad.left() + cx, quad.right() - cx, quad.right()};
+    const qreal ys[4] = {quad.top(), quad.top() + cy, quad.bottom() - cy, quad.bottom()};
+    // Sample center of texture middle pixel for stretched patches
+    const qreal ts[4] = {0., corner / imageSize, (corner + 1.) / imageSize, 1.};
+    const auto sub = texture->normalizedTextureSubRect();      // Texture might be in an atlas
+    auto vertices = node->geometry()->vertexDataAsTexturedPoint2D();
+    for (int row = 0; row < 4; row++)
+        for (int column = 0; column < 4; column++)
+            vertices[(row * 4) + column].set(static_cast<float>(xs[column]), static_cast<float>(ys[row]),
+                                             static_cast<float>(sub.left() + (ts[column] * sub.width())),
+                                             static_cast<float>(sub.top() + (ts[row] * sub.height())));
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,114 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanRectEffect.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QQuickItem>
+#include <QPointer>
+
+// QuickQanava headers
+#include "./qanStyle.h"
+#include "./qanEffectAtlas.h"
+
+namespace qan { // ::qan
+
+/*! \brief Draw a node or group rounded rect shadow or glow effect with a shared nine-patch texture.
+ *
+ * Effect is configured from \c style \c backRadius, \c effectEnabled, \c effectColor, \c effectRadius and
+ * \c effectOffset (for shadows), node shape is knocked out from the effect. Effect texture is shared with all
+ * effects using the same style values in the window (see qan::EffectAtlas): there is no per node offscreen
+ * pass, and moving a node never re-render its effect.
+ *
+ * Item is usually anchored to node background, effect is drawn outside of item bounds.
+ * \nosubgrouping
+ */
+class RectEffect : public QQuickItem
+{
+    /*! \name RectEffect Object Management *///--------------------------------
+    //@{
+    Q_OBJECT
+    QML_ELEMENT
+public:
+    explicit RectEffect(QQuickItem* parent = nullptr);
+    virtual ~RectEffect() override = default;
+    RectEffect(const RectEffect&) = delete;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Effect Configuration *///----------------------------------------
+    //@{
+public:
+    //! Style used to configure effect (effect is not drawn when style is nullptr).
+    Q_PROPERTY(qan::NodeStyle* style READ getStyle WRITE setStyle NOTIFY styleChanged FINAL)
+    void                setStyle(qan::NodeStyle* style) noexcept;
+    inline qan::NodeStyle* getStyle() const noexcept { return _style.data(); }
+private:
+    QPointer<qan::NodeStyle>    _style;
+signals:
+    void                styleChanged();
+
+public:
+    //! Effect drawn by this item, either \c EffectShadow or \c EffectGlow (default to shadow, style \c effectType is ignored).
+    Q_PROPERTY(qan::NodeStyle::EffectType effectType READ getEffectType WRITE setEffectType NOTIFY effectTypeChanged FINAL)
+    void                setEffectType(qan::NodeStyle::EffectType effectType) noexcept;
+    inline qan::NodeStyle::EffectType getEffectType() const noexcept { return _effectType; }
+private:
+    qan::NodeStyle::EffectType  _effectType = qan::NodeStyle::EffectType::EffectShadow;
+signals:
+    void                effectTypeChanged();
+
+public slots:
+    //! Schedule effect geometry update (after a style or size change).
+    void                requestUpdate() noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Effect Rendering *///--------------------------------------------
+    //@{
+protected:
+    virtual void        itemChange(ItemChange change, const ItemChangeData& data) override;
+    virtual void        geometryChange(const QRectF& newGeometry, const QRectF& oldGeometry) override;
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+private:
+    //! Current window effect atlas (set from GUI thread when item window change).
+    QPointer<qan::EffectAtlas>  _atlas;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::RectEffect)
@@ -74,13 +74,19 @@ void    Selectable::setSelectable(bool selectable) noexcept
 void    Selectable::setSelected(bool selected) noexcept
 {
     if (_target &&
-        _graph) {  // Eventually create selection item
-        if (selected &&
-            getSelectionItem() == nullptr )
-            setSelectionItem(_graph->createSelectionItem(_target.data()));
-        else if (!selected)
-            _graph->removeFromSelection(_target.data());
-    }
+        _graph &&
+        !selected)
+        _graph->removeFromSelection(_target.data());
+    setSelectedState(selected);
+}
+
+void    Selectable::setSelectedState(bool selected) noexcept
+{
+    if (_target &&
+        _graph &&
+        selected &&
+        getSelectionItem() == nullptr)  // Eventually create selection item
+        setSelectionItem(_graph->createSelectionItem(_target.data()));
     if (_selected != selected) {  // Binding loop protection
         _selected = selected;
         emitSelectedChanged();
@@ -97,13 +103,7 @@ void    Selectable::setSelectionItem(QQuickItem* selectionItem) noexcept
     if (selectionItem == nullptr)
         return;
     if (selectionItem != _selectionItem) {
-        if (_selectionItem) {      // Clean the old selection item
-            _selectionItem->setParentItem(nullptr); // Force QML garbage collection
-            _selectionItem->setEnabled(false);      // Disable and hide item in case it is not
-            _selectionItem->setVisible(false);      // immediately destroyed or garbage collected
-            if (QQmlEngine::objectOwnership(_selectionItem.data()) == QQmlEngine::CppOwnership)
-                _selectionItem->deleteLater();
-        }
+        releaseSelectionItem();     // Clean the old selection item
 
         if (selectionItem) {
             _selectionItem = QPointer<QQuickItem>(selectionItem);
@@ -123,6 +123,26 @@ void    Selectable::setSelectionItem(QQuickItem* selectionItem) noexcept
     }
 }
 
+void    Selectable::resetSelectionItem() noexcept
+{
+    if (_selectionItem) {
+        releaseSelectionItem();
+        _selectionItem.clear();
+        emitSelectionItemChanged();
+    }
+}
+
+void    Selectable::releaseSelectionItem() noexcept
+{
+    if (_selectionItem) {
+        _selectionItem->setParentItem(nullptr); // Force QML garbage collection
+        _selectionItem->setEnabled(false);      // Disable and hide item in case it is not
+        _selectionItem->setVisible(false);      // immediately destroyed or garbage collected
+        if (QQmlEngine::objectOwnership(_selectionItem.data()) == QQmlEngine::CppOwnership)
+            _selectionItem->deleteLater();
+    }
+}
+
 void    Selectable::configureSelectionItem()
 {
     if (_target &&
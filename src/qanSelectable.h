@@ -81,6 +81,13 @@ public:
     inline bool     getSelected() const noexcept { return _selected; }
 protected:
     virtual void    emitSelectedChanged() = 0;
+public:
+    /*! \brief Set selection state and update selection item without modifying graph selection.
+     *
+     * \note Used internally by qan::Graph bulk selection methods, use setSelected() or qan::Graph selection
+     * methods in user code.
+     */
+    void            setSelectedState(bool selected) noexcept;
 private:
     bool            _selected = false;
 
@@ -93,10 +100,14 @@ public:
     inline QQuickItem*  getSelectionItem() noexcept { return _selectionItem.data(); }
     //! \copydoc getSelectionItem()
     void                setSelectionItem(QQuickItem* selectionItem) noexcept;
+    //! Destroy current selection item if any (selection is then expected to be drawn by qan::Graph selection overlay).
+    void                resetSelectionItem() noexcept;
 protected:
     //! \copydoc getSelectionItem()
     virtual void        emitSelectionItemChanged() = 0;
 private:
+    //! Detach, hide and eventually schedule destruction of current selection item (item pointer is not reset).
+    void                releaseSelectionItem() noexcept;
     //! \copydoc getSelectionItem()
     QPointer<QQuickItem>  _selectionItem{nullptr};
 
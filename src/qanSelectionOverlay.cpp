@@ -0,0 +1,169 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanSelectionOverlay.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+
+// Qt headers
+#include <QSGGeometryNode>
+#include <QSGFlatColorMaterial>
+
+// QuickQanava headers
+#include "./qanSelectionOverlay.h"
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/* SelectionOverlay Object Management *///------------------------------------
+SelectionOverlay::SelectionOverlay(QQuickItem* parent) :
+    QQuickItem{parent}
+{
+    setFlag(QQuickItem::ItemHasContents, true);
+    setEnabled(false);      // Never grab mouse events
+    setAntialiasing(true);
+}
+
+void    SelectionOverlay::setGraph(qan::Graph* graph) noexcept
+{
+    if (graph != _graph) {
+        if (_graph)
+            disconnect(_graph, nullptr, this, nullptr);
+        _graph = graph;
+        if (_graph)
+            connect(_graph, &qan::Graph::selectionChanged,
+                    this,   &qan::SelectionOverlay::requestUpdate);
+        requestUpdate();
+    }
+}
+
+void    SelectionOverlay::requestUpdate() noexcept
+{
+    polish();   // Coalesced by Qt Quick, updatePolish() is called at most once per frame
+}
+//-----------------------------------------------------------------------------
+
+/* Outlines Rendering *///-----------------------------------------------------
+void    SelectionOverlay::updatePolish()
+{
+    _outlines.clear();
+    if (!_graph ||
+        !isVisible()) {
+        update();
+        return;
+    }
+    // Outline outer rect match qan::Selectable::configureSelectionItem() selection item geometry,
+    // stroke is drawn inside the outer rect.
+    const auto& index = _graph->getSpatialIndex();
+    _weight = _graph->getSelectionWeight();
+    const auto offset = (_weight / 2.) + _graph->getSelectionMargin();
+    QRectF br;
+    const auto collect = [&](QQuickItem* item) {
+        if (item == nullptr ||
+            !item->isVisible() ||
+            _graph->isCulled(item) ||
+            !index.contains(item))
+            return;
+        const auto outline = index.getRect(item).adjusted(-offset, -offset, offset, offset);
+        _outlines.push_back(outline);
+        br = br.united(outline);
+    };
+    for (const auto& node : _graph->getSelectedNodes())
+        if (node)
+            collect(node->getItem());
+    for (const auto& group : _graph->getSelectedGroups())
+        if (group)
+            collect(group->getItem());
+
+    // Overlay geometry is set to the selection bounding rect to avoid modifying
+    // container childrenRect when there is no selection.
+    setPosition(br.topLeft());
+    setSize(br.size());
+    for (auto& outline : _outlines)
+        outline.translate(-br.topLeft());
+    _color = _graph->getSelectionColor();
+    _color.setAlphaF(_color.alphaF() * 0.8);   // Match default SelectionItem.qml opacity
+    update();
+}
+
+QSGNode*    SelectionOverlay::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data)
+{
+    Q_UNUSED(data);
+    auto node = static_cast<QSGGeometryNode*>(oldNode);
+    if (_outlines.empty()) {
+        delete node;
+        return nullptr;
+    }
+    if (node == nullptr) {
+        node = new QSGGeometryNode{};
+        auto geometry = new QSGGeometry{QSGGeometry::defaultAttributes_Point2D(), 0};
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGFlatColorMaterial{});
+        node->setFlag(QSGNode::OwnsMaterial);
+    }
+
+    // Every outline is made of 4 quads (top, bottom, left, right) of 2 triangles.
+    constexpr int verticesPerOutline = 4 * 6;
+    auto geometry = node->geometry();
+    geometry->allocate(static_cast<int>(_outlines.size()) * verticesPerOutline);
+    auto v = geometry->vertexDataAsPoint2D();
+    const auto quad = [&v](float x1, float y1, float x2, float y2) {
+        v[0].set(x1, y1); v[1].set(x2, y1); v[2].set(x1, y2);
+        v[3].set(x2, y1); v[4].set(x2, y2); v[5].set(x1, y2);
+        v += 6;
+    };
+    for (const auto& outline : _outlines) {
+        const auto l = static_cast<float>(outline.left());
+        const auto t = static_cast<float>(outline.top());
+        const auto r = static_cast<float>(outline.right());
+        const auto b = static_cast<float>(outline.bottom());
+        const auto w = std::min(static_cast<float>(_weight), std::min(r - l, b - t) / 2.f);
+        quad(l, t, r, t + w);               // Top
+        quad(l, b - w, r, b);               // Bottom
+        quad(l, t + w, l + w, b - w);       // Left
+        quad(r - w, t + w, r, b - w);       // Right
+    }
+    node->markDirty(QSGNode::DirtyGeometry);
+
+    auto material = static_cast<QSGFlatColorMaterial*>(node->material());
+    if (material->color() != _color) {
+        material->setColor(_color);
+        node->markDirty(QSGNode::DirtyMaterial);
+    }
+    return node;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
@@ -0,0 +1,104 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanSelectionOverlay.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <vector>
+
+// Qt headers
+#include <QQuickItem>
+#include <QPointer>
+#include <QColor>
+#include <QRectF>
+
+namespace qan { // ::qan
+
+class Graph;
+
+/*! \brief Draw all selected nodes and groups selection outlines with a single scene graph node.
+ *
+ * Overlay is created and owned by qan::Graph, it is parented to the graph \c containerItem with
+ * a very high z and is used instead of per item \c selectionDelegate instances unless a custom
+ * \c selectionDelegate has been set (see qan::Graph::selectionOverlayEnabled).
+ *
+ * Outlines geometry is collected from the graph spatial index during polish, overlay item
+ * geometry is set to the selection bounding rect.
+ *
+ * \nosubgrouping
+ */
+class SelectionOverlay : public QQuickItem
+{
+    Q_OBJECT
+    /*! \name SelectionOverlay Object Management *///--------------------------
+    //@{
+public:
+    explicit SelectionOverlay(QQuickItem* parent = nullptr);
+    virtual ~SelectionOverlay() override = default;
+    SelectionOverlay(const SelectionOverlay&) = delete;
+
+public:
+    void        setGraph(qan::Graph* graph) noexcept;
+private:
+    QPointer<qan::Graph>    _graph;
+
+public:
+    //! Schedule an outlines update before next frame (ie after a selection or selected item geometry change).
+    void        requestUpdate() noexcept;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Outlines Rendering *///------------------------------------------
+    //@{
+protected:
+    //! Collect selected items outlines from graph spatial index.
+    virtual void        updatePolish() override;
+    virtual QSGNode*    updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+public:
+    //! Return selection outlines outer rects (in overlay local CS) collected during last polish.
+    const std::vector<QRectF>&  getOutlines() const noexcept { return _outlines; }
+
+private:
+    //! Selection outlines outer rects in overlay local CS.
+    std::vector<QRectF> _outlines;
+    QColor              _color;
+    qreal               _weight = 3.;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::SelectionOverlay)
@@ -0,0 +1,296 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanSpatialIndex.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <cmath>
+
+// Qt headers
+#include <QDebug>
+
+// QuickQanava headers
+#include "./qanSpatialIndex.h"
+
+namespace qan { // ::qan
+
+namespace impl { // ::qan::impl
+
+// Note: QRectF::intersects() and QRectF::contains() return false for null width or height
+// rects, use closed rect tests to support horizontal/vertical edges bounding rects.
+inline bool intersectsClosed(const QRectF& a, const QRectF& b) noexcept
+{
+    return a.left() <= b.right() && b.left() <= a.right() &&
+           a.top() <= b.bottom() && b.top() <= a.bottom();
+}
+
+inline bool containsClosed(const QRectF& container, const QRectF& r) noexcept
+{
+    return container.left() <= r.left() && r.right() <= container.right() &&
+           container.top() <= r.top() && r.bottom() <= container.bottom();
+}
+
+} // ::qan::impl
+
+/* SpatialIndex Object Management *///-----------------------------------------
+SpatialIndex::SpatialIndex(qreal cellSize) noexcept
+{
+    setCellSize(cellSize);
+}
+
+void    SpatialIndex::setCellSize(qreal cellSize) noexcept
+{
+    if (!_entries.empty()) {
+        qWarning() << "qan::SpatialIndex::setCellSize(): Error, cell size can't be modified on a non empty index.";
+        return;
+    }
+    if (cellSize > 1.)
+        _cellSize = cellSize;
+}
+
+void    SpatialIndex::clear() noexcept
+{
+    _entries.clear();
+    _levels.clear();
+}
+//-----------------------------------------------------------------------------
+
+/* Items Management *///-------------------------------------------------------
+void    SpatialIndex::insert(QQuickItem* item, const QRectF& rect)
+{
+    // PRECONDITIONS:
+        // item can't be nullptr
+        // rect must not contains NaN values
+    if (item == nullptr)
+        return;
+    const auto r = rect.normalized();
+    if (std::isnan(r.x()) || std::isnan(r.y()) ||
+        std::isnan(r.width()) || std::isnan(r.height()))
+        return;
+
+    Entry entry;
+    entry.item = item;
+    entry.rect = r;
+    entry.level = levelFor(r, entry.cells);
+
+    auto existing = _entries.find(item);
+    if (existing != _entries.end()) {
+        // Fast path: item has moved inside it's actual cells, just update rect
+        if (existing->second.level == entry.level &&
+            existing->second.cells == entry.cells) {
+            existing->second.rect = r;
+            return;
+        }
+        unregisterEntry(existing->second);
+        existing->second = entry;
+    } else
+        _entries.emplace(item, entry);
+    registerEntry(entry);
+}
+
+bool    SpatialIndex::remove(const QQuickItem* item)
+{
+    const auto existing = _entries.find(item);
+    if (existing == _entries.end())
+        return false;
+    unregisterEntry(existing->second);
+    _entries.erase(existing);
+    return true;
+}
+
+bool    SpatialIndex::contains(const QQuickItem* item) const noexcept
+{
+    return _entries.find(item) != _entries.end();
+}
+
+QRectF  SpatialIndex::getRect(const QQuickItem* item) const noexcept
+{
+    const auto existing = _entries.find(item);
+    return existing != _entries.end() ? existing->second.rect : QRectF{};
+}
+
+std::vector<QQuickItem*>    SpatialIndex::getItems() const
+{
+    std::vector<QQuickItem*> items;
+    items.reserve(_entries.size());
+    for (const auto& entry : _entries)
+        items.push_back(entry.second.item);
+    return items;
+}
+//-----------------------------------------------------------------------------
+
+/* Spatial Queries *///--------------------------------------------------------
+std::vector<QQuickItem*>    SpatialIndex::itemsAt(const QPointF& p) const
+{
+    return query(QRectF{p, QSizeF{0., 0.}}, false);
+}
+
+std::vector<QQuickItem*>    SpatialIndex::itemsIntersecting(const QRectF& rect) const
+{
+    return query(rect.normalized(), false);
+}
+
+std::vector<QQuickItem*>    SpatialIndex::itemsContained(const QRectF& rect) const
+{
+    return query(rect.normalized(), true);
+}
+
+std::vector<QQuickItem*>    SpatialIndex::query(const QRectF& rect, bool contained) const
+{
+    std::vector<QQuickItem*> items;
+    if (_entries.empty())
+        return items;
+
+    const auto accept = [&rect, contained](const Entry& entry) -> bool {
+        return contained ? impl::containsClosed(rect, entry.rect) :
+                           impl::intersectsClosed(rect, entry.rect);
+    };
+
+    // Algorithm:
+        // For every non empty level, visit level cells overlapped by query rect and test
+        // cell items. An item is registered in a single level, and an item overlapping
+        // multiple cells is reported only from the first cell of the query/item cells
+        // intersection (it's "reference cell"), avoiding any deduplication set.
+        // When the query range is larger than the number of non empty level cells (ie
+        // selection rect covering the whole graph), iterate over non empty cells instead.
+    for (int level = 0; level < static_cast<int>(_levels.size()); ++level) {
+        const auto& levelCells = _levels[level].cells;
+        if (levelCells.empty())
+            continue;
+        const auto range = cellsRange(rect, level);
+        const auto visitCell = [&](int cx, int cy, const std::vector<QQuickItem*>& cellItems) {
+            for (const auto item : cellItems) {
+                const auto entry = _entries.find(item);
+                if (entry == _entries.end())
+                    continue;
+                const auto& e = entry->second;
+                if (cx != std::max(e.cells.left(), range.left()) ||
+                    cy != std::max(e.cells.top(), range.top()))
+                    continue;   // Not the reference cell for this item
+                if (accept(e))
+                    items.push_back(item);
+            }
+        };
+        const auto rangeCellCount = static_cast<qint64>(range.width()) * static_cast<qint64>(range.height());
+        if (rangeCellCount > static_cast<qint64>(levelCells.size())) {
+            for (const auto& cell : levelCells) {
+                const int cx = static_cast<int>(static_cast<qint32>(cell.first >> 32));
+                const int cy = static_cast<int>(static_cast<qint32>(cell.first & 0xFFFFFFFFu));
+                if (range.contains(cx, cy))
+                    visitCell(cx, cy, cell.second);
+            }
+        } else {
+            for (int cy = range.top(); cy <= range.bottom(); ++cy)
+                for (int cx = range.left(); cx <= range.right(); ++cx) {
+                    const auto cell = levelCells.find(cellKey(cx, cy));
+                    if (cell != levelCells.end())
+                        visitCell(cx, cy, cell->second);
+                }
+        }
+    }
+    return items;
+}
+//-----------------------------------------------------------------------------
+
+/* Grid Management *///--------------------------------------------------------
+QRect   SpatialIndex::cellsRange(const QRectF& rect, int level) const noexcept
+{
+    // Note: clamp cell coordinates to avoid int overflow on (very) large rects.
+    constexpr qreal maxCell = static_cast<qreal>(1 << 28);
+    const qreal levelCellSize = std::ldexp(_cellSize, level);
+    const auto toCell = [levelCellSize, maxCell](qreal v) -> int {
+        return static_cast<int>(std::clamp(std::floor(v / levelCellSize), -maxCell, maxCell));
+    };
+    return QRect{QPoint{toCell(rect.left()), toCell(rect.top())},
+                 QPoint{toCell(rect.right()), toCell(rect.bottom())}};
+}
+
+SpatialIndex::CellKey   SpatialIndex::cellKey(int x, int y) noexcept
+{
+    return (static_cast<CellKey>(static_cast<quint32>(x)) << 32) |
+            static_cast<CellKey>(static_cast<quint32>(y));
+}
+
+int     SpatialIndex::levelFor(const QRectF& rect, QRect& cells) const noexcept
+{
+    // Start from the level where rect largest extent roughly fit in maxCellsPerAxis
+    // cells, then go up while rect (depending on it's alignment) overlap more cells.
+    const qreal extent = std::max(rect.width(), rect.height());
+    int level = 0;
+    if (extent > _cellSize * (maxCellsPerAxis - 1))
+        level = std::max(0, static_cast<int>(std::floor(std::log2(extent / (_cellSize * (maxCellsPerAxis - 1))))));
+    level = std::min(level, maxLevels - 1);
+    cells = cellsRange(rect, level);
+    while (level < maxLevels - 1 &&
+           (cells.width() > maxCellsPerAxis || cells.height() > maxCellsPerAxis)) {
+        ++level;
+        cells = cellsRange(rect, level);
+    }
+    return level;
+}
+
+void    SpatialIndex::registerEntry(const Entry& entry)
+{
+    if (static_cast<int>(_levels.size()) <= entry.level)
+        _levels.resize(static_cast<std::size_t>(entry.level) + 1);
+    auto& level = _levels[entry.level];
+    for (int cy = entry.cells.top(); cy <= entry.cells.bottom(); ++cy)
+        for (int cx = entry.cells.left(); cx <= entry.cells.right(); ++cx)
+            level.cells[cellKey(cx, cy)].push_back(entry.item);
+}
+
+void    SpatialIndex::unregisterEntry(const Entry& entry)
+{
+    if (entry.level >= static_cast<int>(_levels.size()))
+        return;
+    const auto removeFrom = [](std::vector<QQuickItem*>& items, const QQuickItem* item) {
+        const auto it = std::find(items.begin(), items.end(), item);
+        if (it != items.end()) {    // Swap and pop, order is irrelevant
+            *it = items.back();
+            items.pop_back();
+        }
+    };
+    auto& level = _levels[entry.level];
+    for (int cy = entry.cells.top(); cy <= entry.cells.bottom(); ++cy)
+        for (int cx = entry.cells.left(); cx <= entry.cells.right(); ++cx) {
+            const auto cell = level.cells.find(cellKey(cx, cy));
+            if (cell == level.cells.end())
+                continue;
+            removeFrom(cell->second, entry.item);
+            if (cell->second.empty())
+                level.cells.erase(cell);
+        }
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
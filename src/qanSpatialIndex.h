@@ -0,0 +1,170 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanSpatialIndex.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <vector>
+#include <unordered_map>
+
+// Qt headers
+#include <QRectF>
+#include <QRect>
+#include <QPointF>
+#include <QQuickItem>
+
+namespace qan { // ::qan
+
+/*! \brief Spatial index of graph items bounding rects (nodes, groups and edges) in graph container CS.
+ *
+ * Index is a sparse hierarchical grid ("bucket grid" levels): level \c l cells are
+ * \c cellSize * 2^l wide, each item is registered in the finest level where its bounding rect
+ * overlap at most \c maxCellsPerAxis x \c maxCellsPerAxis cells. Large items (ie long edges
+ * or big groups) thus end up in a few cells of a coarse level instead of a linearly scanned
+ * list. Insertion/update/removal are O(1) cells, point and rect queries are
+ * O(levels + visited cells + k).
+ *
+ * \note Index only store item pointers as keys, items are never dereferenced, it is up to
+ * the caller to remove an item when it is destroyed (qan::Graph do it automatically).
+ *
+ * \nosubgrouping
+ */
+class SpatialIndex
+{
+    /*! \name SpatialIndex Object Management *///-----------------------------
+    //@{
+public:
+    explicit SpatialIndex(qreal cellSize = 256.) noexcept;
+    ~SpatialIndex() = default;
+    SpatialIndex(const SpatialIndex&) = delete;
+    SpatialIndex& operator=(const SpatialIndex&) = delete;
+    SpatialIndex(SpatialIndex&&) = delete;
+    SpatialIndex& operator=(SpatialIndex&&) = delete;
+
+public:
+    //! Grid cell size (in container CS units), modify only on an empty index.
+    void        setCellSize(qreal cellSize) noexcept;
+    //! \copydoc setCellSize()
+    qreal       getCellSize() const noexcept { return _cellSize; }
+
+    //! Remove all items from the index.
+    void        clear() noexcept;
+
+    //! Return the number of indexed items.
+    std::size_t size() const noexcept { return _entries.size(); }
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Items Management *///-------------------------------------------
+    //@{
+public:
+    /*! \brief Insert \c item with bounding rect \c rect, or update \c item rect if it is already indexed.
+     *
+     * \c rect is expected in graph container CS, zero width or height rect (ie vertical or
+     * horizontal edges) are supported.
+     */
+    void        insert(QQuickItem* item, const QRectF& rect);
+
+    //! Remove \c item from index, return false if \c item was not indexed.
+    bool        remove(const QQuickItem* item);
+
+    //! Return true if \c item is indexed.
+    bool        contains(const QQuickItem* item) const noexcept;
+
+    //! Return \c item indexed rect, or an invalid rect if \c item is not indexed.
+    QRectF      getRect(const QQuickItem* item) const noexcept;
+
+    //! Return all indexed items (unordered).
+    std::vector<QQuickItem*>    getItems() const;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Spatial Queries *///--------------------------------------------
+    //@{
+public:
+    //! Return items whose bounding rect contains \c p (unordered).
+    std::vector<QQuickItem*>    itemsAt(const QPointF& p) const;
+
+    //! Return items whose bounding rect intersect \c rect (unordered).
+    std::vector<QQuickItem*>    itemsIntersecting(const QRectF& rect) const;
+
+    //! Return items whose bounding rect is fully contained in \c rect (unordered).
+    std::vector<QQuickItem*>    itemsContained(const QRectF& rect) const;
+
+private:
+    //! Internal query, return items intersecting \c rect, and eventually contained in \c rect if \c contained is true.
+    std::vector<QQuickItem*>    query(const QRectF& rect, bool contained) const;
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Grid Management *///--------------------------------------------
+    //@{
+private:
+    using CellKey = quint64;
+
+    struct Entry {
+        QQuickItem* item = nullptr;
+        QRectF      rect;
+        int         level = 0;          //!< Grid level where item is registered.
+        QRect       cells;              //!< Covered cells range in \c level (inclusive).
+    };
+
+    struct Level {
+        std::unordered_map<CellKey, std::vector<QQuickItem*>>   cells;
+    };
+
+    //! Return the (inclusive) range of \c level cells overlapped by \c rect.
+    QRect           cellsRange(const QRectF& rect, int level) const noexcept;
+    static CellKey  cellKey(int x, int y) noexcept;
+
+    //! Return the finest level where \c rect overlap at most maxCellsPerAxis cells per axis, set \c cells to the covered cells.
+    int             levelFor(const QRectF& rect, QRect& cells) const noexcept;
+
+    void            registerEntry(const Entry& entry);
+    void            unregisterEntry(const Entry& entry);
+
+    //! Maximum number of cells (per axis) an item may cover in it's level.
+    static constexpr int    maxCellsPerAxis = 4;
+    //! Maximum number of levels, last level cells are \c cellSize * 2^(maxLevels - 1) wide.
+    static constexpr int    maxLevels = 24;
+
+    qreal           _cellSize = 256.;
+
+    std::unordered_map<const QQuickItem*, Entry>    _entries;
+    std::vector<Level>                              _levels;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
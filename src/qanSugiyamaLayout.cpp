@@ -0,0 +1,655 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanSugiyamaLayout.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include <unordered_set>
+
+// QuickQanava headers
+#include "./qanSugiyamaLayout.h"
+#include "./qanNodeItem.h"
+
+namespace qan { // ::qan
+
+namespace { // ::qan::
+
+constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+/* Layered graph: vertices [0, realCount) are input vertices, [realCount, size) are long edges dummy vertices.
+ * Dummy vertices have exactly one upper and one lower neighbour.
+ */
+struct LayeredGraph {
+    std::size_t                             realCount = 0;
+    std::vector<std::size_t>                layer;      // Vertex layer
+    std::vector<std::size_t>                pos;        // Vertex position in its layer
+    std::vector<qreal>                      width;
+    std::vector<qreal>                      height;
+    std::vector<std::vector<std::size_t>>   upper;      // Vertex neighbours in previous layer
+    std::vector<std::vector<std::size_t>>   lower;      // Vertex neighbours in next layer
+    std::vector<std::vector<std::size_t>>   layers;     // Ordered vertices per layer
+
+    inline bool isDummy(std::size_t v) const noexcept { return v >= realCount; }
+    inline std::size_t size() const noexcept { return layer.size(); }
+    void    updatePositions() noexcept {
+        for (const auto& l : layers)
+            for (std::size_t k = 0; k < l.size(); ++k)
+                pos[l[k]] = k;
+    }
+};
+
+using Edges = SugiyamaLayout::Edges;
+
+// Return an acyclic copy of edges (self loops removed), back edges found during an iterative DFS are reversed.
+Edges   removeCycles(std::size_t n, const Edges& edges, std::size_t& reversedCount)
+{
+    std::vector<std::vector<std::size_t>> out(n);
+    for (const auto& [src, dst] : edges)
+        if (src < n && dst < n && src != dst)
+            out[src].push_back(dst);
+    enum : unsigned char { Unvisited, Visiting, Visited };
+    std::vector<unsigned char> state(n, Unvisited);
+    Edges dag;
+    dag.reserve(edges.size());
+    reversedCount = 0;
+    std::vector<std::pair<std::size_t, std::size_t>> stack;    // Vertex, next out edge
+    for (std::size_t s = 0; s < n; ++s) {
+        if (state[s] != Unvisited)
+            continue;
+        state[s] = Visiting;
+        stack.emplace_back(s, 0);
+        while (!stack.empty()) {
+            const auto v = stack.back().first;
+            auto& e = stack.back().second;
+            if (e < out[v].size()) {
+                const auto w = out[v][e++];
+                if (state[w] == Visiting) {     // Back edge
+                    dag.emplace_back(w, v);
+                    ++reversedCount;
+                } else {
+                    dag.emplace_back(v, w);
+                    if (state[w] == Unvisited) {
+                        state[w] = Visiting;
+                        stack.emplace_back(w, 0);
+                    }
+                }
+            } else {
+                state[v] = Visited;
+                stack.pop_back();
+            }
+        }
+    }
+    return dag;
+}
+
+// Longest path layering of an acyclic graph, sources are then pulled down just above their first successor.
+std::vector<std::size_t>    assignLayers(std::size_t n, const Edges& dag)
+{
+    std::vector<std::vector<std::size_t>> out(n);
+    std::vector<std::size_t> inDegree(n, 0);
+    for (const auto& [src, dst] : dag) {
+        out[src].push_back(dst);
+        ++inDegree[dst];
+    }
+    std::vector<std::size_t> layer(n, 0);
+    std::vector<std::size_t> order;     // Topological order
+    order.reserve(n);
+    for (std::size_t v = 0; v < n; ++v)
+        if (inDegree[v] == 0)
+            order.push_back(v);
+    std::vector<bool> isSource(n, false);
+    for (const auto v : order)
+        isSource[v] = true;
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        const auto v = order[i];
+        for (const auto w : out[v]) {
+            layer[w] = std::max(layer[w], layer[v] + 1);
+            if (--inDegree[w] == 0)
+                order.push_back(w);
+        }
+    }
+    for (const auto v : order) {    // Successors of a source are never sources, their layer is final
+        if (!isSource[v] ||
+            out[v].empty())
+            continue;
+        auto minLayer = npos;
+        for (const auto w : out[v])
+            minLayer = std::min(minLayer, layer[w]);
+        layer[v] = minLayer - 1;
+    }
+    return layer;
+}
+
+// Build layered graph for dag and layering, long edges are split with dummy vertices.
+LayeredGraph    buildLayeredGraph(const std::vector<QSizeF>& sizes, const Edges& dag, std::vector<std::size_t>&& layer)
+{
+    LayeredGraph lg;
+    lg.realCount = sizes.size();
+    lg.layer = std::move(layer);
+    lg.width.reserve(lg.realCount);
+    lg.height.reserve(lg.realCount);
+    for (const auto& size : sizes) {
+        lg.width.push_back(std::max(0., size.width()));
+        lg.height.push_back(std::max(0., size.height()));
+    }
+    lg.upper.resize(lg.realCount);
+    lg.lower.resize(lg.realCount);
+    const auto link = [&lg](std::size_t u, std::size_t v) {
+        lg.lower[u].push_back(v);
+        lg.upper[v].push_back(u);
+    };
+    for (const auto& [src, dst] : dag) {
+        auto prev = src;
+        for (auto l = lg.layer[src] + 1; l < lg.layer[dst]; ++l) {
+            const auto dummy = lg.size();
+            lg.layer.push_back(l);
+            lg.width.push_back(0.);
+            lg.height.push_back(0.);
+            lg.upper.emplace_back();
+            lg.lower.emplace_back();
+            link(prev, dummy);
+            prev = dummy;
+        }
+        link(prev, dst);
+    }
+    std::size_t layerCount = 0;
+    for (const auto l : lg.layer)
+        layerCount = std::max(layerCount, l + 1);
+    lg.layers.resize(layerCount);
+    for (std::size_t v = 0; v < lg.size(); ++v)
+        lg.layers[lg.layer[v]].push_back(v);
+    lg.pos.resize(lg.size());
+    lg.updatePositions();
+    return lg;
+}
+
+// Count crossings between layer l and l + 1 with an accumulator tree (Barth, Jünger, Mutzel), O(E log V).
+std::size_t countCrossings(const LayeredGraph& lg, std::size_t l)
+{
+    const auto lowerSize = lg.layers[l + 1].size();
+    if (lowerSize <= 1 ||
+        lg.layers[l].size() <= 1)
+        return 0;
+    std::vector<std::size_t> southSequence;
+    std::vector<std::size_t> positions;
+    for (const auto u : lg.layers[l]) {
+        positions.clear();
+        for (const auto w : lg.lower[u])
+            positions.push_back(lg.pos[w]);
+        std::sort(positions.begin(), positions.end());
+        southSequence.insert(southSequence.end(), positions.begin(), positions.end());
+    }
+    std::size_t firstIndex = 1;
+    while (firstIndex < lowerSize)
+        firstIndex *= 2;
+    std::vector<std::size_t> tree(2 * firstIndex - 1, 0);
+    --firstIndex;
+    std::size_t crossings = 0;
+    for (const auto p : southSequence) {
+        auto index = p + firstIndex;
+        ++tree[index];
+        while (index > 0) {
+            if (index % 2 != 0)
+                crossings += tree[index + 1];
+            index = (index - 1) / 2;
+            ++tree[index];
+        }
+    }
+    return crossings;
+}
+
+std::size_t countCrossings(const LayeredGraph& lg)
+{
+    std::size_t crossings = 0;
+    for (std::size_t l = 0; l + 1 < lg.layers.size(); ++l)
+        crossings += countCrossings(lg, l);
+    return crossings;
+}
+
+// Order layer l by barycenter of upper (or lower) neighbours, vertices without neighbours keep their position.
+void    orderLayer(LayeredGraph& lg, std::size_t l, bool useUpper)
+{
+    auto& layer = lg.layers[l];
+    std::vector<std::pair<qreal, std::size_t>> keys;
+    keys.reserve(layer.size());
+    for (const auto v : layer) {
+        const auto& neighbours = useUpper ? lg.upper[v] : lg.lower[v];
+        qreal key = static_cast<qreal>(lg.pos[v]);
+        if (!neighbours.empty()) {
+            qreal sum = 0.;
+            for (const auto w : neighbours)
+                sum += static_cast<qreal>(lg.pos[w]);
+            key = sum / static_cast<qreal>(neighbours.size());
+        }
+        keys.emplace_back(key, v);
+    }
+    std::stable_sort(keys.begin(), keys.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    for (std::size_t k = 0; k < keys.size(); ++k) {
+        layer[k] = keys[k].second;
+        lg.pos[layer[k]] = k;
+    }
+}
+
+// Alternate down and up barycenter sweeps, keep ordering with less crossings, return crossing count.
+std::size_t minimizeCrossings(LayeredGraph& lg, int sweeps)
+{
+    auto bestCrossings = countCrossings(lg);
+    auto bestLayers = lg.layers;
+    const auto layerCount = lg.layers.size();
+    for (int sweep = 0; sweep < sweeps && bestCrossings > 0; ++sweep) {
+        if (sweep % 2 == 0) {
+            for (std::size_t l = 1; l < layerCount; ++l)
+                orderLayer(lg, l, /*useUpper*/true);
+        } else {
+            for (std::size_t l = layerCount - 1; l > 0; --l)
+                orderLayer(lg, l - 1, /*useUpper*/false);
+        }
+        const auto crossings = countCrossings(lg);
+        if (crossings < bestCrossings) {
+            bestCrossings = crossings;
+            bestLayers = lg.layers;
+        }
+    }
+    lg.layers = std::move(bestLayers);
+    lg.updatePositions();
+    return bestCrossings;
+}
+
+/* Brandes-Köpf coordinate assignment *///-------------------------------------
+using Conflicts = std::unordered_set<std::uint64_t>;
+
+inline std::uint64_t    segmentKey(std::size_t upper, std::size_t lower) noexcept
+{
+    return (static_cast<std::uint64_t>(upper) << 32) | static_cast<std::uint64_t>(lower);
+}
+
+// Mark type 1 conflicts: non inner segments crossing an inner segment (a segment between two dummy vertices).
+Conflicts   markConflicts(const LayeredGraph& lg)
+{
+    Conflicts conflicts;
+    const auto innerSegmentUpper = [&lg](std::size_t v) -> std::size_t {
+        if (lg.isDummy(v))
+            for (const auto u : lg.upper[v])
+                if (lg.isDummy(u))
+                    return u;
+        return npos;
+    };
+    for (std::size_t i = 0; i + 1 < lg.layers.size(); ++i) {
+        const auto& upperLayer = lg.layers[i];
+        const auto& lowerLayer = lg.layers[i + 1];
+        if (upperLayer.empty())
+            continue;
+        std::size_t k0 = 0;
+        std::size_t l = 0;
+        for (std::size_t l1 = 0; l1 < lowerLayer.size(); ++l1) {
+            const auto innerUpper = innerSegmentUpper(lowerLayer[l1]);
+            if (l1 + 1 != lowerLayer.size() &&
+                innerUpper == npos)
+                continue;
+            const auto k1 = innerUpper != npos ? lg.pos[innerUpper] : upperLayer.size() - 1;
+            for (; l <= l1; ++l) {
+                const auto w = lowerLayer[l];
+                for (const auto u : lg.upper[w]) {
+                    const auto k = lg.pos[u];
+                    if ((k < k0 || k > k1) &&
+                        !(lg.isDummy(u) && lg.isDummy(w)))
+                        conflicts.insert(segmentKey(u, w));
+                }
+            }
+            k0 = k1;
+        }
+    }
+    return conflicts;
+}
+
+// Vertical alignment and horizontal compaction for one of the four directions, return vertices center x.
+std::vector<qreal>  alignAndCompact(const LayeredGraph& lg, const Conflicts& conflicts,
+                                    bool topDown, bool leftToRight, qreal xSpacing)
+{
+    const auto count = lg.size();
+    const auto layerCount = lg.layers.size();
+    const auto layerAt = [&lg, topDown, layerCount](std::size_t i) -> const std::vector<std::size_t>& {
+        return lg.layers[topDown ? i : layerCount - 1 - i];
+    };
+    const auto vertexAt = [leftToRight](const std::vector<std::size_t>& layer, std::size_t k) {
+        return leftToRight ? layer[k] : layer[layer.size() - 1 - k];
+    };
+    std::vector<std::size_t> lpos(count);   // Position in direction local order
+    for (const auto& layer : lg.layers)
+        for (std::size_t k = 0; k < layer.size(); ++k)
+            lpos[vertexAt(layer, k)] = k;
+
+    // Vertical alignment: align each vertex with its median neighbour(s) in previous layer
+    std::vector<std::size_t> root(count);
+    std::vector<std::size_t> align(count);
+    std::iota(root.begin(), root.end(), 0);
+    std::iota(align.begin(), align.end(), 0);
+    std::vector<std::size_t> neighbours;
+    for (std::size_t i = 1; i < layerCount; ++i) {
+        const auto& layer = layerAt(i);
+        auto r = npos;
+        for (std::size_t k = 0; k < layer.size(); ++k) {
+            const auto v = vertexAt(layer, k);
+            const auto& vNeighbours = topDown ? lg.upper[v] : lg.lower[v];
+            if (vNeighbours.empty())
+                continue;
+            neighbours.assign(vNeighbours.begin(), vNeighbours.end());
+            std::sort(neighbours.begin(), neighbours.end(), [&lpos](auto a, auto b) { return lpos[a] < lpos[b]; });
+            const auto d = neighbours.size();
+            for (const auto m : {(d - 1) / 2, d / 2}) {
+                if (align[v] != v)
+                    break;
+                const auto u = neighbours[m];
+                const auto key = topDown ? segmentKey(u, v) : segmentKey(v, u);
+                if (conflicts.find(key) == conflicts.end() &&
+                    (r == npos || r < lpos[u])) {
+                    align[u] = v;
+                    root[v] = root[u];
+                    align[v] = root[v];
+                    r = lpos[u];
+                }
+            }
+        }
+    }
+
+    // Horizontal compaction: place blocks (iterative place_block()), then apply classes shift
+    const auto predecessor = [&](std::size_t w) -> std::size_t {
+        return lpos[w] > 0 ? vertexAt(lg.layers[lg.layer[w]], lpos[w] - 1) : npos;
+    };
+    const auto separation = [&lg, xSpacing](std::size_t a, std::size_t b) {
+        return (lg.width[a] + lg.width[b]) / 2. + xSpacing;
+    };
+    constexpr auto infinity = std::numeric_limits<qreal>::max();
+    std::vector<std::size_t> sink(count);
+    std::iota(sink.begin(), sink.end(), 0);
+    std::vector<qreal> shift(count, infinity);
+    std::vector<qreal> x(count, 0.);
+    enum : unsigned char { Unplaced, Placing, Placed };
+    std::vector<unsigned char> state(count, Unplaced);
+    struct Frame { std::size_t v; std::size_t w; };
+    std::vector<Frame> stack;
+    for (std::size_t i = 0; i < layerCount; ++i) {
+        const auto& layer = layerAt(i);
+        for (std::size_t k = 0; k < layer.size(); ++k) {
+            const auto start = vertexAt(layer, k);
+            if (root[start] != start ||
+                state[start] != Unplaced)
+                continue;
+            state[start] = Placing;
+            stack.push_back(Frame{start, start});
+            while (!stack.empty()) {
+                const auto [v, w] = stack.back();
+                const auto p = predecessor(w);
+                if (p != npos) {
+                    const auto u = root[p];
+                    if (state[u] == Unplaced) {     // Place u block first, then process w again
+                        state[u] = Placing;
+                        stack.push_back(Frame{u, u});
+                        continue;
+                    }
+                    if (sink[v] == v)
+                        sink[v] = sink[u];
+                    if (sink[v] != sink[u])
+                        shift[sink[u]] = std::min(shift[sink[u]], x[v] - x[u] - separation(p, w));
+                    else
+                        x[v] = std::max(x[v], x[u] + separation(p, w));
+                }
+                const auto next = align[w];
+                if (next == v) {
+                    state[v] = Placed;
+                    stack.pop_back();
+                } else
+                    stack.back().w = next;
+            }
+        }
+    }
+    std::vector<qreal> xs(count, 0.);
+    for (std::size_t v = 0; v < count; ++v) {
+        xs[v] = x[root[v]];
+        const auto s = shift[sink[root[v]]];
+        if (s < infinity)
+            xs[v] += s;
+        if (!leftToRight)
+            xs[v] = -xs[v];
+    }
+    return xs;
+}
+
+// Brandes-Köpf: balance four directions alignments, return vertices center x.
+std::vector<qreal>  assignCoordinates(const LayeredGraph& lg, qreal xSpacing)
+{
+    const auto count = lg.size();
+    const auto conflicts = markConflicts(lg);
+    std::array<std::vector<qreal>, 4> alignments{
+        alignAndCompact(lg, conflicts, /*topDown*/true,  /*leftToRight*/true,  xSpacing),
+        alignAndCompact(lg, conflicts, /*topDown*/true,  /*leftToRight*/false, xSpacing),
+        alignAndCompact(lg, conflicts, /*topDown*/false, /*leftToRight*/true,  xSpacing),
+        alignAndCompact(lg, conflicts, /*topDown*/false, /*leftToRight*/false, xSpacing)
+    };
+    const auto isLeftAlignment = [](std::size_t a) { return a % 2 == 0; };
+
+    // Align all alignments to the one with smallest width
+    std::array<qreal, 4> minX, maxX;
+    std::size_t smallest = 0;
+    for (std::size_t a = 0; a < 4; ++a) {
+        minX[a] = std::numeric_limits<qreal>::max();
+        maxX[a] = std::numeric_limits<qreal>::lowest();
+        for (std::size_t v = 0; v < count; ++v) {
+            minX[a] = std::min(minX[a], alignments[a][v] - lg.width[v] / 2.);
+            maxX[a] = std::max(maxX[a], alignments[a][v] + lg.width[v] / 2.);
+        }
+        if (maxX[a] - minX[a] < maxX[smallest] - minX[smallest])
+            smallest = a;
+    }
+    for (std::size_t a = 0; a < 4; ++a) {
+        const auto delta = isLeftAlignment(a) ? minX[smallest] - minX[a] :
+                                                maxX[smallest] - maxX[a];
+        for (auto& x : alignments[a])
+            x += delta;
+    }
+
+    // Average median, then enforce separation in case class shifts left an overlap
+    std::vector<qreal> xs(count, 0.);
+    for (std::size_t v = 0; v < count; ++v) {
+        std::array<qreal, 4> values{alignments[0][v], alignments[1][v], alignments[2][v], alignments[3][v]};
+        std::sort(values.begin(), values.end());
+        xs[v] = (values[1] + values[2]) / 2.;
+    }
+    for (const auto& layer : lg.layers)
+        for (std::size_t k = 1; k < layer.size(); ++k)
+            xs[layer[k]] = std::max(xs[layer[k]],
+                                    xs[layer[k - 1]] + (lg.width[layer[k - 1]] + lg.width[layer[k]]) / 2. + xSpacing);
+    return xs;
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan::
+
+/* SugiyamaLayout Object Management *///---------------------------------------
+SugiyamaLayout::SugiyamaLayout(QObject* parent) noexcept :
+    QObject{parent}
+{
+}
+SugiyamaLayout::~SugiyamaLayout() { }
+
+bool    SugiyamaLayout::setCrossingSweeps(int crossingSweeps) noexcept
+{
+    crossingSweeps = std::max(0, crossingSweeps);
+    if (crossingSweeps != _crossingSweeps) {
+        _crossingSweeps = crossingSweeps;
+        emit crossingSweepsChanged();
+        return true;
+    }
+    return false;
+}
+//-----------------------------------------------------------------------------
+
+/* Layout Management *///------------------------------------------------------
+void    SugiyamaLayout::layout(qan::Graph& graph, qreal xSpacing, qreal ySpacing) noexcept
+{
+    std::vector<qan::Node*> nodes;
+    nodes.reserve(graph.get_nodes().size());
+    for (const auto node : graph.get_nodes())
+        if (node != nullptr &&
+            node->getItem() != nullptr &&
+            node->getGroup() == nullptr)     // Grouped nodes are laid out by their group
+            nodes.push_back(node);
+    layoutNodes(nodes, nullptr, xSpacing, ySpacing);
+}
+
+void    SugiyamaLayout::layoutGraph(qan::Graph* graph, qreal xSpacing, qreal ySpacing) noexcept
+{
+    if (graph != nullptr)
+        layout(*graph, xSpacing, ySpacing);
+}
+
+void    SugiyamaLayout::layout(qan::Node& root, qreal xSpacing, qreal ySpacing) noexcept
+{
+    if (root.getItem() == nullptr)
+        return;
+    // Collect nodes reachable from root in BFS order (keep layout deterministic)
+    std::vector<qan::Node*> nodes{&root};
+    std::unordered_set<const qan::Node*> visited{&root};
+    for (std::size_t n = 0; n < nodes.size(); ++n)
+        for (const auto outNode : nodes[n]->get_out_nodes())
+            if (outNode != nullptr &&
+                outNode->getItem() != nullptr &&
+                visited.insert(outNode).second)
+                nodes.push_back(outNode);
+    layoutNodes(nodes, &root, xSpacing, ySpacing);
+}
+
+void    SugiyamaLayout::layout(qan::Node* root, qreal xSpacing, qreal ySpacing) noexcept
+{
+    if (root != nullptr)
+        layout(*root, xSpacing, ySpacing);
+}
+
+std::vector<QPointF>    SugiyamaLayout::computeLayout(const std::vector<QSizeF>& sizes, const Edges& edges,
+                                                      qreal xSpacing, qreal ySpacing, const Progress& progress)
+{
+    // PRECONDITIONS:
+        // sizes must not be empty
+    _layerCount = 0;
+    _crossingCount = 0;
+    _reversedEdgeCount = 0;
+    _dummyCount = 0;
+    if (sizes.empty())
+        return {};
+
+    // ALGORITHM:
+        // 1. Remove cycles reversing DFS back edges.
+        // 2. Longest path layering, split long edges with dummy vertices.
+        // 3. Minimize crossings with barycenter sweeps.
+        // 4. Brandes-Köpf horizontal coordinates, layers vertical coordinates from max layer height.
+    const auto n = sizes.size();
+    const auto cancelled = [&progress](qreal p) { return progress && !progress(p); };
+    const auto dag = removeCycles(n, edges, _reversedEdgeCount);
+    if (cancelled(0.1))
+        return {};
+    auto lg = buildLayeredGraph(sizes, dag, assignLayers(n, dag));
+    _layerCount = lg.layers.size();
+    _dummyCount = lg.size() - lg.realCount;
+    if (cancelled(0.2))
+        return {};
+    _crossingCount = minimizeCrossings(lg, _crossingSweeps);
+    if (cancelled(0.7))
+        return {};
+    const auto xs = assignCoordinates(lg, xSpacing);
+    if (cancelled(0.9))
+        return {};
+
+    std::vector<qreal> layerY(_layerCount, 0.);
+    std::vector<qreal> layerHeight(_layerCount, 0.);
+    for (std::size_t v = 0; v < n; ++v)
+        layerHeight[lg.layer[v]] = std::max(layerHeight[lg.layer[v]], lg.height[v]);
+    for (std::size_t l = 1; l < _layerCount; ++l)
+        layerY[l] = layerY[l - 1] + layerHeight[l - 1] + ySpacing;
+
+    auto left = std::numeric_limits<qreal>::max();
+    for (std::size_t v = 0; v < n; ++v)
+        left = std::min(left, xs[v] - lg.width[v] / 2.);
+    std::vector<QPointF> positions;
+    positions.reserve(n);
+    for (std::size_t v = 0; v < n; ++v) {
+        const auto l = lg.layer[v];
+        positions.emplace_back(xs[v] - lg.width[v] / 2. - left,
+                               layerY[l] + (layerHeight[l] - lg.height[v]) / 2.);
+    }
+    return positions;
+}
+
+void    SugiyamaLayout::layoutNodes(const std::vector<qan::Node*>& nodes, const qan::Node* anchor,
+                                    qreal xSpacing, qreal ySpacing) noexcept
+{
+    if (nodes.empty())
+        return;
+    std::unordered_map<const qan::Node*, std::size_t> indexes;
+    indexes.reserve(nodes.size());
+    std::vector<QSizeF> sizes;
+    sizes.reserve(nodes.size());
+    QPointF origin{std::numeric_limits<qreal>::max(), std::numeric_limits<qreal>::max()};
+    for (const auto node : nodes) {
+        const auto item = node->getItem();
+        indexes.emplace(node, sizes.size());
+        sizes.emplace_back(item->width(), item->height());
+        origin.setX(std::min(origin.x(), item->x()));
+        origin.setY(std::min(origin.y(), item->y()));
+    }
+    Edges edges;
+    for (std::size_t src = 0; src < nodes.size(); ++src)
+        for (const auto outNode : nodes[src]->get_out_nodes()) {
+            const auto dst = indexes.find(outNode);
+            if (dst != indexes.end())
+                edges.emplace_back(src, dst->second);
+        }
+
+    const auto positions = computeLayout(sizes, edges, xSpacing, ySpacing);
+    if (positions.size() != nodes.size())
+        return;
+    if (anchor != nullptr) {    // Keep anchor at its current position
+        const auto a = indexes.find(anchor);
+        if (a != indexes.end())
+            origin = anchor->getItem()->position() - positions[a->second];
+    }
+    for (std::size_t n = 0; n < nodes.size(); ++n)
+        nodes[n]->getItem()->setPosition(positions[n] + origin);
+}
+//-----------------------------------------------------------------------------
+
+} // ::qan
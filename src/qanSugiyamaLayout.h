@@ -0,0 +1,164 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	qanSugiyamaLayout.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// Qt headers
+#include <QObject>
+#include <QPointF>
+#include <QSizeF>
+#include <QtQml>
+
+// QuickQanava headers
+#include "./qanGraph.h"
+
+namespace qan { // ::qan
+
+/*! \brief Layered (Sugiyama) hierarchical layout for directed graphs, including non tree DAGs and cyclic graphs.
+ *
+ * Layout run in four phases:
+ *   1. Cycle removal: back edges found in a DFS are reversed.
+ *   2. Layering: longest path layering, sources are then pulled down next to their successors;
+ *      edges spanning more than one layer are split with dummy vertices.
+ *   3. Crossing minimisation: layer by layer barycenter sweeps (alternating down and up), best
+ *      ordering is kept using a bilayer accumulator tree crossing count.
+ *   4. Coordinate assignment: Brandes-Köpf four alignments balancing with type 1 conflicts
+ *      resolution (long edges are kept straight), node width from qan::NodeItem.
+ *
+ * Layout is deterministic for a given topology and node insertion order. Layout is top-down,
+ * nodes are vertically centered in their layer.
+ *
+ * \code
+ *   // From QML:
+ *   Qan.SugiyamaLayout { id: sugiyamaLayout }
+ *   sugiyamaLayout.layoutGraph(graph)
+ * \endcode
+ * \nosubgrouping
+ */
+class SugiyamaLayout : public QObject
+{
+    Q_OBJECT
+    QML_ELEMENT
+    /*! \name SugiyamaLayout Object Management *///----------------------------
+    //@{
+public:
+    explicit SugiyamaLayout(QObject* parent = nullptr) noexcept;
+    virtual ~SugiyamaLayout() override;
+    SugiyamaLayout(const SugiyamaLayout&) = delete;
+    SugiyamaLayout& operator=(const SugiyamaLayout&) = delete;
+    SugiyamaLayout(SugiyamaLayout&&) = delete;
+    SugiyamaLayout& operator=(SugiyamaLayout&&) = delete;
+
+public:
+    //! Maximum number of barycenter sweeps used for crossing minimisation (default to 24, 0 to disable).
+    Q_PROPERTY(int crossingSweeps READ getCrossingSweeps WRITE setCrossingSweeps NOTIFY crossingSweepsChanged FINAL)
+    bool            setCrossingSweeps(int crossingSweeps) noexcept;
+    int             getCrossingSweeps() const noexcept { return _crossingSweeps; }
+protected:
+    int             _crossingSweeps = 24;
+signals:
+    void            crossingSweepsChanged();
+    //@}
+    //-------------------------------------------------------------------------
+
+    /*! \name Layout Management *///-------------------------------------------
+    //@{
+public:
+    /*! \brief Apply a layered layout to all \c graph top level nodes and groups.
+     *
+     * Nodes and groups inside groups, or without an item, are ignored. Laid out nodes keep their
+     * bounding rect top left position.
+     */
+    void                layout(qan::Graph& graph, qreal xSpacing = 25., qreal ySpacing = 50.) noexcept;
+
+    //! QML invokable version of layout().
+    Q_INVOKABLE void    layoutGraph(qan::Graph* graph, qreal xSpacing = 25., qreal ySpacing = 50.) noexcept;
+
+    //! Apply a layered layout to \c root and all nodes reachable from \c root (\c root is not moved).
+    void                layout(qan::Node& root, qreal xSpacing = 25., qreal ySpacing = 50.) noexcept;
+
+    //! QML invokable version of layout().
+    Q_INVOKABLE void    layout(qan::Node* root, qreal xSpacing = 25., qreal ySpacing = 50.) noexcept;
+
+public:
+    using Edges = std::vector<std::pair<std::size_t, std::size_t>>;
+
+    //! Progress callback called with a [0, 1] progress, layout is cancelled if it return false.
+    using Progress = std::function<bool(qreal)>;
+
+    /*! \brief Topology only layout: return top left position of vertices of size \c sizes connected with \c edges.
+     *
+     * Vertices are indices in \c sizes, edges referencing an invalid vertex and self loops are ignored.
+     * Returned positions are in a layout CS where the first layer top is 0 and the left most vertex
+     * left is 0.
+     *
+     * \c progress is called after each layout step (from caller thread), an empty result is returned
+     * when cancelled.
+     */
+    std::vector<QPointF>    computeLayout(const std::vector<QSizeF>& sizes, const Edges& edges,
+                                          qreal xSpacing = 25., qreal ySpacing = 50.,
+                                          const Progress& progress = {});
+
+    //! Layer count of the last layout.
+    std::size_t     getLayerCount() const noexcept { return _layerCount; }
+    //! Edge crossing count of the last layout (including crossings between long edges dummy segments).
+    std::size_t     getCrossingCount() const noexcept { return _crossingCount; }
+    //! Count of edges reversed to break cycles in the last layout.
+    std::size_t     getReversedEdgeCount() const noexcept { return _reversedEdgeCount; }
+    //! Count of dummy vertices inserted to split long edges in the last layout.
+    std::size_t     getDummyCount() const noexcept { return _dummyCount; }
+
+protected:
+    //! Layout \c nodes and apply results to their items, keeping \c nodes bounding rect top left (or \c anchor top left).
+    void            layoutNodes(const std::vector<qan::Node*>& nodes, const qan::Node* anchor,
+                                qreal xSpacing, qreal ySpacing) noexcept;
+
+private:
+    std::size_t     _layerCount = 0;
+    std::size_t     _crossingCount = 0;
+    std::size_t     _reversedEdgeCount = 0;
+    std::size_t     _dummyCount = 0;
+    //@}
+    //-------------------------------------------------------------------------
+};
+
+} // ::qan
+
+QML_DECLARE_TYPE(qan::SugiyamaLayout)
@@ -35,6 +35,7 @@
 // QuickQanava headers
 #include "./qanTableCell.h"
 #include "./qanNodeItem.h"
+#include "./qanGraph.h"
 #include "./qanTableGroup.h"
 
 namespace qan { // ::qan
@@ -51,6 +52,11 @@ TableCell::TableCell(QQuickItem* parent):
             this, &qan::TableCell::fitItemToCell);
     connect(this, &QQuickItem::heightChanged,
             this, &qan::TableCell::fitItemToCell);
+    // Cell is moved by table layout: update its item graph spatial index
+    connect(this, &QQuickItem::xChanged,
+            this, &qan::TableCell::updateItemSpatialIndex);
+    connect(this, &QQuickItem::yChanged,
+            this, &qan::TableCell::updateItemSpatialIndex);
 
     setClip(true);  // Clip content
 }
@@ -115,8 +121,20 @@ void    TableCell::fitItemToCell()
         _item->setY(topPadding);
         _item->setWidth(width());
         _item->setHeight(height() - topPadding);
+        updateItemSpatialIndex();   // Item has been reparented or cell has been resized
     }
 }
+
+void    TableCell::updateItemSpatialIndex()
+{
+    const auto nodeItem = qobject_cast<qan::NodeItem*>(_item.data());
+    if (nodeItem == nullptr)
+        return;
+    const auto graph = nodeItem->getGraph();
+    if (graph != nullptr &&
+        graph->getSpatialIndex().contains(nodeItem))    // Do not index items not yet registered by graph
+        graph->updateSpatialIndex(nodeItem);
+}
 //-----------------------------------------------------------------------------
 
 } // ::qan
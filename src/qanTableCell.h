@@ -103,6 +103,12 @@ private:
 protected slots:
     //! Fit actual `_item` to this cell.
     void                    fitItemToCell();
+    /*! \brief Refresh `_item` rect in graph spatial index.
+     *
+     * Cell item geometry is expressed in cell CS: item x/y do not change when the cell is
+     * moved by table layout, while its graph container rect does.
+     */
+    void                    updateItemSpatialIndex();
 
 public:
     //! \copydoc setUserProp()
@@ -33,7 +33,10 @@
 //-----------------------------------------------------------------------------
 
 // Std headers
+#include <algorithm>
+#include <limits>
 #include <queue>
+#include <unordered_map>
 #include <unordered_set>
 
 // Qt headers
@@ -194,6 +197,193 @@ void    RandomLayout::layout(qan::Node* root) noexcept
 //-----------------------------------------------------------------------------
 
 
+namespace { // ::qan::
+
+// Node extent: [depthBegin, depthEnd] along layout depth axis, [siblingBegin, siblingEnd] along sibling axis.
+struct Extent {
+    qreal   depthBegin;
+    qreal   depthEnd;
+    qreal   siblingBegin;
+    qreal   siblingEnd;
+};
+
+// Return the minimal shift of block extents along the sibling axis (in positive direction) so that they are at
+// least spacing after every fixed extent they overlap along the depth axis, 0 if no shift is required.
+qreal   requiredShift(const std::vector<Extent>& fixed, const std::vector<Extent>& block, qreal spacing)
+{
+    // Algorithm: compress depth coordinates, record fixed extents sibling end on the elementary depth
+    // intervals they cover (range max update pushed to leaves), then query max fixed sibling end on
+    // block extents intervals (range max query), O((f + b).log(f + b)) with an iterative segment tree.
+    if (fixed.empty() ||
+        block.empty())
+        return 0.;
+    std::vector<qreal> coords;
+    coords.reserve(2 * (fixed.size() + block.size()));
+    for (const auto extents : {&fixed, &block})
+        for (const auto& e : *extents) {
+            coords.push_back(e.depthBegin);
+            coords.push_back(e.depthEnd);
+        }
+    std::sort(coords.begin(), coords.end());
+    coords.erase(std::unique(coords.begin(), coords.end()), coords.end());
+    const auto index = [&coords](qreal c) -> std::size_t {
+        return std::lower_bound(coords.cbegin(), coords.cend(), c) - coords.cbegin();
+    };
+
+    // Leaf i is elementary interval [coords[i], coords[i + 1]]
+    const auto n = coords.size();
+    constexpr auto lowest = std::numeric_limits<qreal>::lowest();
+    std::vector<qreal> tree(2 * n, lowest);
+    for (const auto& e : fixed)
+        for (auto l = index(e.depthBegin) + n, r = index(e.depthEnd) + n; l < r; l >>= 1, r >>= 1) {
+            if (l & 1) {
+                tree[l] = std::max(tree[l], e.siblingEnd);
+                ++l;
+            }
+            if (r & 1) {
+                --r;
+                tree[r] = std::max(tree[r], e.siblingEnd);
+            }
+        }
+    for (std::size_t i = 1; i < n; ++i) {     // Push updates to leaves
+        tree[2 * i] = std::max(tree[2 * i], tree[i]);
+        tree[2 * i + 1] = std::max(tree[2 * i + 1], tree[i]);
+    }
+    for (std::size_t i = n - 1; i > 0; --i)   // Build range max
+        tree[i] = std::max(tree[2 * i], tree[2 * i + 1]);
+
+    qreal shift = 0.;
+    for (const auto& e : block) {
+        qreal end = lowest;
+        for (auto l = index(e.depthBegin) + n, r = index(e.depthEnd) + n; l < r; l >>= 1, r >>= 1) {
+            if (l & 1)
+                end = std::max(end, tree[l++]);
+            if (r & 1)
+                end = std::max(end, tree[--r]);
+        }
+        if (end != lowest)
+            shift = std::max(shift, end + spacing - e.siblingBegin);
+    }
+    return shift;
+}
+
+// Mirror extents along the sibling axis, used to compute shifts in negative direction with requiredShift().
+std::vector<Extent> mirrored(std::vector<Extent> extents)
+{
+    for (auto& e : extents)
+        e = Extent{e.depthBegin, e.depthEnd, -e.siblingEnd, -e.siblingBegin};
+    return extents;
+}
+
+bool    isTransposed(OrgTreeLayout::LayoutOrientation orientation)
+{
+    return orientation == OrgTreeLayout::LayoutOrientation::Horizontal ||
+           orientation == OrgTreeLayout::LayoutOrientation::IndentedHorizontal;
+}
+
+// Indented layout (OrgTreeLayout before Walker algorithm), with an explicit DFS stack instead of recursion.
+std::vector<QPointF>    indentedLayout(const OrgTreeLayout::Children& children, const std::vector<QSizeF>& sizes,
+                                       OrgTreeLayout::LayoutOrientation orientation, qreal xSpacing, qreal ySpacing,
+                                       const OrgTreeLayout::Progress& progress)
+{
+    // Algorithm:
+        // Traverse tree DFS, a node is laid out after every previously laid out node along the sibling axis
+        // (siblingEnd), children are laid out after their parent and previous siblings along the depth axis
+        // (frame depthEnd). In Mixed orientation, leaf siblings are laid out in a row along the depth axis.
+        // Nodes reachable from multiple parents are laid out once, under their first DFS parent.
+    const auto n = std::min(children.size(), sizes.size());
+    std::vector<QPointF> positions(sizes.size(), QPointF{0., 0.});
+    if (n == 0)
+        return positions;
+    const bool transpose = isTransposed(orientation);
+    const bool mixed = orientation == OrgTreeLayout::LayoutOrientation::IndentedMixed;
+    const qreal siblingSpacing = transpose ? xSpacing : ySpacing;
+    const qreal levelSpacing = transpose ? ySpacing : xSpacing;
+    const auto siblingSize = [&sizes, transpose](std::size_t node) -> qreal {
+        return std::max(0., transpose ? sizes[node].width() : sizes[node].height());
+    };
+    const auto depthSize = [&sizes, transpose](std::size_t node) -> qreal {
+        return std::max(0., transpose ? sizes[node].height() : sizes[node].width());
+    };
+    const auto isLeaf = [&children, n](std::size_t node) {
+        for (const auto child : children[node])
+            if (child < n && child != node)
+                return false;
+        return true;
+    };
+
+    constexpr std::size_t progressStep = 4096;
+    std::vector<bool> visited(n, false);
+    std::size_t placed = 0;
+    qreal siblingEnd = 0.;
+    const auto place = [&](std::size_t node, qreal siblingPos, qreal depthPos) -> bool {
+        visited[node] = true;
+        positions[node] = transpose ? QPointF{siblingPos, depthPos} :
+                                      QPointF{depthPos, siblingPos};
+        siblingEnd = std::max(siblingEnd, siblingPos + siblingSize(node));
+        return !progress ||
+               (++placed % progressStep) != 0 ||
+               progress(static_cast<qreal>(placed) / static_cast<qreal>(n));
+    };
+
+    struct Frame {
+        std::size_t node;
+        std::size_t child;      // Next child index in children[node]
+        qreal       depthPos;   // Children depth axis position
+        qreal       depthEnd;   // Node and laid out children depth axis end
+    };
+    std::vector<Frame> stack;
+    std::vector<std::size_t> fresh;
+    const auto push = [&](std::size_t node, qreal depthEnd) -> bool {
+        fresh.clear();
+        for (const auto child : children[node])
+            if (child < n && !visited[child])
+                fresh.push_back(child);
+        if (mixed &&
+            !fresh.empty() &&
+            std::all_of(fresh.cbegin(), fresh.cend(), isLeaf)) {
+            const auto siblingPos = siblingEnd + siblingSpacing;
+            for (const auto child : fresh) {
+                if (visited[child])     // Note: Duplicated child
+                    continue;
+                if (!place(child, siblingPos, depthEnd + levelSpacing))
+                    return false;
+                depthEnd += levelSpacing + depthSize(child);
+            }
+        } else if (!fresh.empty())
+            stack.push_back(Frame{node, 0, depthEnd + levelSpacing, depthEnd});
+        return true;
+    };
+
+    if (!place(0, 0., 0.) ||
+        !push(0, depthSize(0)))
+        return {};
+    while (!stack.empty()) {
+        auto& frame = stack.back();
+        const auto& nodeChildren = children[frame.node];
+        while (frame.child < nodeChildren.size() &&
+               (nodeChildren[frame.child] >= n || visited[nodeChildren[frame.child]]))
+            ++frame.child;
+        if (frame.child >= nodeChildren.size()) {
+            stack.pop_back();
+            continue;
+        }
+        const auto child = nodeChildren[frame.child++];
+        if (!place(child, siblingEnd + siblingSpacing, frame.depthPos))
+            return {};
+        frame.depthEnd = std::max(frame.depthEnd, frame.depthPos + depthSize(child));
+        const auto depthEnd = frame.depthEnd;   // Note: frame is invalidated by push()
+        if (!push(child, depthEnd))
+            return {};
+    }
+    if (progress &&
+        !progress(1.))
+        return {};
+    return positions;
+}
+
+} // ::qan::
+
 /* OrgTreeLayout Object Management *///----------------------------------------
 OrgTreeLayout::OrgTreeLayout(QObject* parent) noexcept :
     QObject{parent}
@@ -215,86 +405,399 @@ const OrgTreeLayout::LayoutOrientation  OrgTreeLayout::getLayoutOrientation() co
 
 void    OrgTreeLayout::layout(qan::Node& root, qreal xSpacing, qreal ySpacing) noexcept
 {
-    // Note: Recursive variant of Reingold-Tilford algorithm with naive shifting (ie shifting
-    // based on the less space efficient sub tree bounding rect intersection...)
+    layoutSubtree(root, xSpacing, ySpacing);
+}
 
-    // Pre-condition: root must be a tree subgraph, this is not enforced in this algorithm,
-    // any circuit will lead to intinite recursion...
+std::vector<qan::Node*> OrgTreeLayout::layoutSubtree(qan::Node& root, qreal xSpacing, qreal ySpacing) noexcept
+{
+    // Note: Topology and sizes are collected BFS in a flat index based tree, actual layout
+    // is computed in computeLayout(), root position is preserved.
+    if (getLayoutOrientation() == LayoutOrientation::Undefined ||
+        root.getItem() == nullptr)
+        return {};
+
+    std::vector<qan::Node*> nodes;
+    std::unordered_map<const qan::Node*, std::size_t> indexes;
+    nodes.push_back(&root);
+    indexes.insert({&root, 0});
+    for (std::size_t n = 0; n < nodes.size(); ++n) {
+        for (const auto child : nodes[n]->get_out_nodes()) {
+            if (child == nullptr ||
+                child->getItem() == nullptr ||
+                indexes.find(child) != indexes.end())
+                continue;
+            indexes.insert({child, nodes.size()});
+            nodes.push_back(child);
+        }
+    }
 
-    // Algorithm:
-        // Traverse graph DFS aligning child nodes vertically
-        // At a given level: `shift` next node according to previous node sub-tree BR
-    auto layoutVert_rec = [xSpacing, ySpacing](auto&& self, auto& childNodes, QRectF br) -> QRectF {
-        const auto x = br.right() + xSpacing;
-        for (auto child: childNodes) {
-            child->getItem()->setX(x);
-            child->getItem()->setY(br.bottom() + ySpacing);
-            // Take into account this level maximum width
-            br = br.united(child->getItem()->boundingRect().translated(child->getItem()->position()));
-            const auto childBr = self(self, child->get_out_nodes(), br);
-            br.setBottom(childBr.bottom()); // Note: Do not take full child BR into account to avoid x drifting
+    Children children(nodes.size());
+    std::vector<QSizeF> sizes(nodes.size());
+    for (std::size_t n = 0; n < nodes.size(); ++n) {
+        const auto item = nodes[n]->getItem();
+        sizes[n] = QSizeF{item->width(), item->height()};
+        for (const auto child : nodes[n]->get_out_nodes()) {
+            const auto index = indexes.find(child);
+            if (index != indexes.end())
+                children[n].push_back(index->second);
         }
-        return br;
+    }
+
+    const auto positions = computeLayout(children, sizes, xSpacing, ySpacing);
+    const auto origin = root.getItem()->position();
+    for (std::size_t n = 1; n < nodes.size(); ++n)
+        nodes[n]->getItem()->setPosition(origin + positions[n]);
+    return nodes;
+}
+
+void    OrgTreeLayout::layout(qan::Node* root, qreal xSpacing, qreal ySpacing) noexcept
+{
+    if (root != nullptr)
+        layout(*root, xSpacing, ySpacing);
+}
+
+void    OrgTreeLayout::relayoutFrom(qan::Node& node, qreal xSpacing, qreal ySpacing) noexcept
+{
+    // Algorithm:
+        // 1. Layout node subtree (node is not moved), subtree nodes are "moved" nodes.
+        // 2. Collect node ancestors following first in node.
+        // 3. For each ancestor p and its child v on the ancestors path: collect p following (resp.
+        //    preceding) children subtrees, shift them as a block in positive (resp. negative) sibling
+        //    axis direction of the minimal amount that avoid overlapping any moved node. Shifted nodes
+        //    are then moved nodes.
+    if (getLayoutOrientation() == LayoutOrientation::Undefined ||
+        node.getItem() == nullptr)
+        return;
+    const auto moved = layoutSubtree(node, xSpacing, ySpacing);  // 1.
+    std::unordered_set<const qan::Node*> excluded{moved.cbegin(), moved.cend()};
+
+    std::vector<qan::Node*> ancestors;                            // 2.
+    for (auto v = &node; v != nullptr; ) {
+        qan::Node* parent = nullptr;
+        for (const auto inNode : v->get_in_nodes())
+            if (inNode != nullptr &&
+                inNode->getItem() != nullptr) {
+                parent = inNode;
+                break;
+            }
+        if (parent == nullptr ||
+            !excluded.insert(parent).second)    // Circuit
+            break;
+        ancestors.push_back(parent);
+        v = parent;
+    }
+
+    const bool transpose = isTransposed(getLayoutOrientation());
+    const qreal siblingSpacing = transpose ? xSpacing : ySpacing;
+    const auto extentOf = [transpose](const qan::Node* n) -> Extent {
+        const auto item = n->getItem();
+        const QRectF r{item->position(), QSizeF{item->width(), item->height()}};
+        return transpose ? Extent{r.top(), r.bottom(), r.left(), r.right()} :
+                           Extent{r.left(), r.right(), r.top(), r.bottom()};
+    };
+    std::vector<Extent> movedExtents;
+    movedExtents.reserve(moved.size());
+    for (const auto n : moved)
+        movedExtents.push_back(extentOf(n));
+    const auto collect = [&excluded](auto begin, auto end) {    // BFS from [begin, end) siblings
+        std::vector<qan::Node*> nodes;
+        for (auto sibling = begin; sibling != end; ++sibling)
+            if (*sibling != nullptr &&
+                (*sibling)->getItem() != nullptr &&
+                excluded.insert(*sibling).second)
+                nodes.push_back(*sibling);
+        for (std::size_t n = 0; n < nodes.size(); ++n)
+            for (const auto child : nodes[n]->get_out_nodes())
+                if (child != nullptr &&
+                    child->getItem() != nullptr &&
+                    excluded.insert(child).second)
+                    nodes.push_back(child);
+        return nodes;
     };
 
-    auto layoutHoriz_rec = [xSpacing, ySpacing](auto&& self, auto& childNodes, QRectF br) -> QRectF {
-        const auto y = br.bottom() + ySpacing;
-        for (auto child: childNodes) {
-            child->getItem()->setX(br.right() + xSpacing);
-            child->getItem()->setY(y);
-            // Take into account this level maximum width
-            br = br.united(child->getItem()->boundingRect().translated(child->getItem()->position()));
-            const auto childBr = self(self, child->get_out_nodes(), br);
-            br.setRight(childBr.right()); // Note: Do not take full child BR into account to avoid x drifting
+    const qan::Node* v = &node;                                  // 3.
+    for (const auto p : ancestors) {
+        const auto& siblings = p->get_out_nodes();
+        const auto vSibling = std::find(siblings.cbegin(), siblings.cend(), v);
+        if (vSibling == siblings.cend())
+            break;
+        for (const bool following : {true, false}) {
+            const auto block = following ? collect(std::next(vSibling), siblings.cend()) :
+                                           collect(siblings.cbegin(), vSibling);
+            if (block.empty())
+                continue;
+            std::vector<Extent> blockExtents;
+            blockExtents.reserve(block.size());
+            for (const auto n : block)
+                blockExtents.push_back(extentOf(n));
+            const auto shift = following ? requiredShift(movedExtents, blockExtents, siblingSpacing) :
+                                           requiredShift(mirrored(movedExtents), mirrored(blockExtents), siblingSpacing);
+            if (shift <= 0.)
+                continue;
+            const auto delta = transpose ? QPointF{following ? shift : -shift, 0.} :
+                                           QPointF{0., following ? shift : -shift};
+            for (const auto n : block) {
+                n->getItem()->setPosition(n->getItem()->position() + delta);
+                movedExtents.push_back(extentOf(n));
+            }
         }
-        return br;
+        v = p;
+    }
+}
+
+void    OrgTreeLayout::relayoutFrom(qan::Node* node, qreal xSpacing, qreal ySpacing) noexcept
+{
+    if (node != nullptr)
+        relayoutFrom(*node, xSpacing, ySpacing);
+}
+
+std::vector<QPointF>    OrgTreeLayout::computeLayout(const Children& children, const std::vector<QSizeF>& sizes,
+                                                     qreal xSpacing, qreal ySpacing,
+                                                     const Progress& progress) const
+{
+    // Note: Walker algorithm in Buchheim, Jünger and Leipert O(n) variant ("Improving Walker's
+    // Algorithm to Run in Linear Time", 2002), with variable node sizes along the sibling axis and
+    // every recursive traversal replaced by an iterative one.
+
+    // PRECONDITIONS:
+        // children.size() == sizes.size()
+    const auto n = std::min(children.size(), sizes.size());
+    std::vector<QPointF> positions(sizes.size(), QPointF{0., 0.});
+    if (n == 0 ||
+        getLayoutOrientation() == LayoutOrientation::Undefined)
+        return positions;
+    if (getLayoutOrientation() == LayoutOrientation::IndentedVertical ||
+        getLayoutOrientation() == LayoutOrientation::IndentedHorizontal ||
+        getLayoutOrientation() == LayoutOrientation::IndentedMixed)
+        return indentedLayout(children, sizes, getLayoutOrientation(), xSpacing, ySpacing, progress);
+
+    // Vertical and Mixed: siblings are stacked along y and levels grow along x, Horizontal is transposed.
+    const bool transpose = getLayoutOrientation() == LayoutOrientation::Horizontal;
+    const bool mixed = getLayoutOrientation() == LayoutOrientation::Mixed;
+    const qreal siblingSpacing = transpose ? xSpacing : ySpacing;
+    const qreal levelSpacing = transpose ? ySpacing : xSpacing;
+    const auto siblingSize = [&sizes, transpose](std::size_t node) -> qreal {
+        return std::max(0., transpose ? sizes[node].width() : sizes[node].height());
+    };
+    const auto depthSize = [&sizes, transpose](std::size_t node) -> qreal {
+        return std::max(0., transpose ? sizes[node].height() : sizes[node].width());
     };
 
-    auto layoutMixed_rec = [xSpacing, ySpacing, layoutHoriz_rec](auto&& self, auto& childNodes, QRectF br) -> QRectF {
-        auto childsAreLeafs = true;
-        for (const auto child: childNodes)
-            if (child->get_out_nodes().size() != 0) {
-                childsAreLeafs = false;
-                break;
+    // Algorithm:
+        // 1. Build the layout tree BFS: tree children of a vertex have contiguous (and greater) indexes,
+        //    a node reachable from multiple parents is attached to the first one. In Mixed orientation,
+        //    a group of leaf siblings is merged in a single "composite" vertex laid out as a row.
+        // 2. First walk bottom-up (ie reverse vertex order): compute prelim/mod with Walker apportion.
+        // 3. Second walk top-down (ie vertex order): accumulate mods to get sibling axis centers.
+        // 4. Level positions along the depth axis from the maximum node depth size at each level.
+        // Progress is reported every progressStep vertices, each pass accounting for a quarter of the layout.
+
+    constexpr std::size_t progressStep = 4096;
+    const auto report = [&progress](int pass, std::size_t done, std::size_t count) -> bool {
+        if (!progress ||
+            (done % progressStep) != 0)
+            return true;
+        return progress((static_cast<qreal>(pass) +
+                         (static_cast<qreal>(done) / static_cast<qreal>(std::max<std::size_t>(count, 1)))) / 4.);
+    };
+
+    // 1. Layout tree
+    constexpr auto none = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> vParent, vDepth, vNumber, vFirst, vCount, vNode, vMembersBegin, vMembersCount;
+    std::vector<qreal> vSize, vDepthSize;
+    std::vector<std::size_t> members;   // Composite vertices nodes
+    const auto addVertex = [&](std::size_t parent, std::size_t depth, std::size_t number, std::size_t node) {
+        vParent.push_back(parent);  vDepth.push_back(depth);    vNumber.push_back(number);
+        vFirst.push_back(none);     vCount.push_back(0);        vNode.push_back(node);
+        vMembersBegin.push_back(0); vMembersCount.push_back(0);
+        vSize.push_back(node != none ? siblingSize(node) : 0.);
+        vDepthSize.push_back(node != none ? depthSize(node) : 0.);
+    };
+    const auto isLeaf = [&children, n](std::size_t node) {
+        for (const auto child : children[node])
+            if (child < n && child != node)
+                return false;
+        return true;
+    };
+
+    std::vector<bool> visited(n, false);
+    std::vector<std::size_t> fresh;
+    visited[0] = true;
+    addVertex(none, 0, 0, 0);
+    for (std::size_t v = 0; v < vNode.size(); ++v) {
+        if (!report(0, v, n))
+            return {};
+        const auto node = vNode[v];
+        if (node == none)   // Composite vertex
+            continue;
+        fresh.clear();
+        for (const auto child : children[node])
+            if (child < n && !visited[child]) {
+                visited[child] = true;
+                fresh.push_back(child);
+            }
+        if (fresh.empty())
+            continue;
+        vFirst[v] = vNode.size();
+        if (mixed &&
+            std::all_of(fresh.cbegin(), fresh.cend(), isLeaf)) {
+            vCount[v] = 1;
+            addVertex(v, vDepth[v] + 1, 0, none);
+            const auto c = vNode.size() - 1;
+            vMembersBegin[c] = members.size();
+            vMembersCount[c] = fresh.size();
+            for (const auto child : fresh) {
+                members.push_back(child);
+                vSize[c] = std::max(vSize[c], siblingSize(child));
+                vDepthSize[c] += depthSize(child);
             }
-        if (childsAreLeafs)
-            return layoutHoriz_rec(self, childNodes, br);
-        else {
-            const auto x = br.right() + xSpacing;
-            for (auto child: childNodes) {
-                child->getItem()->setX(x);
-                child->getItem()->setY(br.bottom() + ySpacing);
-                // Take into account this level maximum width
-                br = br.united(child->getItem()->boundingRect().translated(child->getItem()->position()));
-                const auto childBr = self(self, child->get_out_nodes(), br);
-                br.setBottom(childBr.bottom()); // Note: Do not take full child BR into account to avoid x drifting
+            vDepthSize[c] += levelSpacing * static_cast<qreal>(fresh.size() - 1);
+        } else {
+            vCount[v] = fresh.size();
+            std::size_t number = 0;
+            for (const auto child : fresh)
+                addVertex(v, vDepth[v] + 1, number++, child);
+        }
+    }
+
+    // 2. First walk
+    const auto vn = vNode.size();
+    std::vector<qreal> prelim(vn, 0.), mod(vn, 0.), shift(vn, 0.), change(vn, 0.), mid(vn, 0.);
+    std::vector<std::size_t> thread(vn, none), ancestor(vn);
+    for (std::size_t v = 0; v < vn; ++v)
+        ancestor[v] = v;
+
+    const auto distance = [&vSize, siblingSpacing](std::size_t a, std::size_t b) -> qreal {
+        return ((vSize[a] + vSize[b]) / 2.) + siblingSpacing;
+    };
+    const auto nextLeft = [&](std::size_t v) {
+        return vCount[v] != 0 ? vFirst[v] : thread[v];
+    };
+    const auto nextRight = [&](std::size_t v) {
+        return vCount[v] != 0 ? vFirst[v] + vCount[v] - 1 : thread[v];
+    };
+    const auto moveSubtree = [&](std::size_t wm, std::size_t wp, qreal s) {
+        const auto subtrees = static_cast<qreal>(vNumber[wp] - vNumber[wm]);
+        change[wp] -= s / subtrees;
+        shift[wp] += s;
+        change[wm] += s / subtrees;
+        prelim[wp] += s;
+        mod[wp] += s;
+    };
+    const auto apportion = [&](std::size_t v, std::size_t& defaultAncestor) {
+        if (vNumber[v] == 0)    // No left sibling
+            return;
+        auto vip = v;
+        auto vop = v;
+        auto vim = v - 1;       // Left sibling
+        auto vom = vFirst[vParent[v]];
+        qreal sip = mod[vip], sop = mod[vop], sim = mod[vim], som = mod[vom];
+        while (nextRight(vim) != none &&
+               nextLeft(vip) != none) {
+            vim = nextRight(vim);
+            vip = nextLeft(vip);
+            vom = nextLeft(vom);
+            vop = nextRight(vop);
+            ancestor[vop] = v;
+            const auto s = (prelim[vim] + sim) - (prelim[vip] + sip) + distance(vim, vip);
+            if (s > 0.) {
+                moveSubtree(vParent[ancestor[vim]] == vParent[v] ? ancestor[vim] : defaultAncestor, v, s);
+                sip += s;
+                sop += s;
             }
+            sim += mod[vim];
+            sip += mod[vip];
+            som += mod[vom];
+            sop += mod[vop];
+        }
+        if (nextRight(vim) != none &&
+            nextRight(vop) == none) {
+            thread[vop] = nextRight(vim);
+            mod[vop] += sim - sop;
+        }
+        if (nextLeft(vip) != none &&
+            nextLeft(vom) == none) {
+            thread[vom] = nextLeft(vip);
+            mod[vom] += sip - som;
+            defaultAncestor = v;
         }
-        return br;
     };
-
-    // Note: QQuickItem boundingRect() is in item local CS, translate to "scene" CS.
-    switch (getLayoutOrientation()) {
-    case LayoutOrientation::Undefined: return;
-    case LayoutOrientation::Vertical:
-        layoutVert_rec(layoutVert_rec, root.get_out_nodes(),
-                       root.getItem()->boundingRect().translated(root.getItem()->position()));
-        break;
-    case LayoutOrientation::Horizontal:
-        layoutHoriz_rec(layoutHoriz_rec, root.get_out_nodes(),
-                        root.getItem()->boundingRect().translated(root.getItem()->position()));
-        break;
-    case LayoutOrientation::Mixed:
-        layoutMixed_rec(layoutMixed_rec, root.get_out_nodes(),
-                        root.getItem()->boundingRect().translated(root.getItem()->position()));
-        break;
+    for (std::size_t v = vn; v-- > 0; ) {
+        if (!report(1, vn - 1 - v, vn))
+            return {};
+        if (vCount[v] == 0)     // Leaf, mid is 0.
+            continue;
+        const auto first = vFirst[v];
+        const auto last = first + vCount[v] - 1;
+        auto defaultAncestor = first;
+        for (auto w = first; w <= last; ++w) {
+            if (w == first)
+                prelim[w] = mid[w];
+            else {
+                prelim[w] = prelim[w - 1] + distance(w - 1, w);
+                if (vCount[w] != 0)
+                    mod[w] = prelim[w] - mid[w];
+            }
+            apportion(w, defaultAncestor);
+        }
+        // Execute shifts
+        qreal s = 0., c = 0.;
+        for (auto w = last + 1; w-- > first; ) {
+            prelim[w] += s;
+            mod[w] += s;
+            c += change[w];
+            s += shift[w] + c;
+        }
+        mid[v] = (prelim[first] + prelim[last]) / 2.;
+    }
+    prelim[0] = mid[0];
+
+    // 3. Second walk: vertices are ordered top-down, accumulate ancestors mod to get sibling axis centers.
+    std::vector<qreal> center(vn, 0.), modSum(vn, 0.);
+    for (std::size_t v = 0; v < vn; ++v) {
+        if (!report(2, v, vn))
+            return {};
+        center[v] = prelim[v] + modSum[v];
+        for (auto w = vFirst[v]; vCount[v] != 0 && w < vFirst[v] + vCount[v]; ++w)
+            modSum[w] = modSum[v] + mod[v];
     }
-}
 
-void    OrgTreeLayout::layout(qan::Node* root, qreal xSpacing, qreal ySpacing) noexcept
-{
-    if (root != nullptr)
-        layout(*root, xSpacing, ySpacing);
+    // 4. Depth axis: level start from previous levels maximum depth size (including composite vertices rows).
+    std::vector<qreal> levelSize;
+    for (std::size_t v = 0; v < vn; ++v) {
+        if (vDepth[v] >= levelSize.size())
+            levelSize.resize(vDepth[v] + 1, 0.);
+        levelSize[vDepth[v]] = std::max(levelSize[vDepth[v]], vDepthSize[v]);
+    }
+    std::vector<qreal> levelStart(levelSize.size(), 0.);
+    for (std::size_t l = 1; l < levelSize.size(); ++l)
+        levelStart[l] = levelStart[l - 1] + levelSize[l - 1] + levelSpacing;
+
+    // Root top left is (0, 0)
+    const auto origin = center[0] - (vSize[0] / 2.);
+    const auto setPosition = [&positions, transpose](std::size_t node, qreal siblingPos, qreal depthPos) {
+        positions[node] = transpose ? QPointF{siblingPos, depthPos} :
+                                      QPointF{depthPos, siblingPos};
+    };
+    for (std::size_t v = 0; v < vn; ++v) {
+        if (!report(3, v, vn))
+            return {};
+        const auto c = center[v] - origin;
+        auto depthPos = levelStart[vDepth[v]];
+        if (vNode[v] != none)
+            setPosition(vNode[v], c - (vSize[v] / 2.), depthPos);
+        else {  // Composite vertex: lay out leaves in a row along the depth axis
+            for (auto m = vMembersBegin[v]; m < vMembersBegin[v] + vMembersCount[v]; ++m) {
+                const auto node = members[m];
+                setPosition(node, c - (siblingSize(node) / 2.), depthPos);
+                depthPos += depthSize(node) + levelSpacing;
+            }
+        }
+    }
+    if (progress &&
+        !progress(1.))
+        return {};
+    return positions;
 }
 //-----------------------------------------------------------------------------
 
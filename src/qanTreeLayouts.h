@@ -34,6 +34,11 @@
 
 #pragma once
 
+// Std headers
+#include <cstddef>
+#include <functional>
+#include <vector>
+
 // Qt headers
 #include <QString>
 #include <QQuickItem>
@@ -119,13 +124,15 @@ public:
 };
 
 
-/*! \brief Org chart naive recursive variant of Reingold-Tilford algorithm with shifting.
+/*! \brief Org chart tidy tree layout (Walker algorithm in Buchheim, Jünger and Leipert linear time variant).
  *
- * This algorithm layout tree in an "Org chart" fashion using no space optimization,
- * respecting node ordering and working for n-ary trees.
+ * This algorithm layout tree in an "Org chart" fashion: subtrees are packed as close as their
+ * contours allow, parents are centered on their children, node ordering is respected and it
+ * works for n-ary trees with variable node sizes. Layout run in O(n) using iterative traversals
+ * (no recursion, very deep trees are supported).
  *
- * \note This layout does not enforces that the input graph is a tree, laying out
- * a non-tree graph might lead to infinite recursion.
+ * \note Layout is applied on the spanning tree of nodes reachable from root: a node reachable from
+ * multiple parents is laid out under the first one, circuits are ignored.
  *
  * \nosubgrouping
  */
@@ -148,12 +155,18 @@ public:
     enum class LayoutOrientation : unsigned int {
         //! Undefined.
         Undefined = 0,
-        //! Vertical tree layout.
+        //! Vertical tree layout (parents are centered on their children).
         Vertical = 2,
-        //! Horizontal tree layout.
+        //! Horizontal tree layout (parents are centered on their children).
         Horizontal = 4,
         //! Mixed t0ree layout (ie vertical, but horizontal for leaf nodes).
-        Mixed = 8
+        Mixed = 8,
+        //! Vertical indented list layout (QuickQanava 2.5.0 and earlier \c Vertical style).
+        IndentedVertical = 16,
+        //! Horizontal indented layout (QuickQanava 2.5.0 and earlier \c Horizontal style).
+        IndentedHorizontal = 32,
+        //! Vertical indented list with leaf siblings in rows (QuickQanava 2.5.0 and earlier \c Mixed style).
+        IndentedMixed = 64
     };
     Q_ENUM(LayoutOrientation)
 
@@ -173,21 +186,54 @@ signals:
     void                    layoutOrientationChanged();
 
 public:
-    /*! \brief Apply a vertical "organisational chart tree layout algorithm" to subgraph \c root.
+    /*! \brief Apply an "organisational chart tree layout algorithm" to subgraph \c root.
      *
-     * OrgChart layout _will preserve_ node orders.
+     * OrgChart layout _will preserve_ node orders, \c root is not moved.
      *
-     * This naive implementation is recursive and not "space optimal" while it run in O(n),
-     * n beeing the number of nodes in root "tree subgraph".
+     * Siblings are stacked vertically with levels growing to the right in \c Vertical orientation,
+     * laid out in rows with levels growing to the bottom in \c Horizontal orientation. \c Mixed
+     * orientation is vertical, but siblings groups containing only leaves are packed in a single row.
      *
-     * \note \c root must be a tree subgraph, this method will not enforce this condition,
-     * running this algorithm on a non tree subgraph might lead to inifinite recursions or
-     * invalid layouts.
+     * \c Indented orientations do not center parents nor compact subtrees: nodes are laid out in depth
+     * first order, each one after all previously laid out nodes, children indented after their parent.
      */
     void                layout(qan::Node& root, qreal xSpacing = 25., qreal ySpacing = 25.) noexcept;
 
     //! QML invokable version of layout().
     Q_INVOKABLE void    layout(qan::Node* root, qreal xSpacing = 25., qreal ySpacing = 25.) noexcept;
+
+    /*! \brief Incremental layout of \c node subtree after a local topology modification (ie a child inserted or removed).
+     *
+     * Only \c node subtree is laid out again (\c node is not moved), then siblings subtrees of \c node and of its
+     * ancestors are shifted along the sibling axis only if, and as much as, required to avoid overlapping the
+     * modified subtree. All other nodes keep their positions.
+     *
+     * \note Ancestors are found following first in node, tree should have been laid out with layout() first.
+     */
+    void                relayoutFrom(qan::Node& node, qreal xSpacing = 25., qreal ySpacing = 25.) noexcept;
+
+    //! QML invokable version of relayoutFrom().
+    Q_INVOKABLE void    relayoutFrom(qan::Node* node, qreal xSpacing = 25., qreal ySpacing = 25.) noexcept;
+
+protected:
+    //! Layout \c root subtree keeping \c root position, return laid out nodes (\c root first).
+    std::vector<qan::Node*> layoutSubtree(qan::Node& root, qreal xSpacing, qreal ySpacing) noexcept;
+
+public:
+    using Children = std::vector<std::vector<std::size_t>>;
+
+    //! Progress callback called with a [0, 1] progress, layout is cancelled if it return false.
+    using Progress = std::function<bool(qreal)>;
+
+    /*! \brief Topology only layout: return top left position of nodes of size \c sizes, \c children is node ordered children.
+     *
+     * Node 0 is root and is laid out at (0, 0), invalid children index are ignored and nodes not reachable
+     * from root are laid out at (0, 0). \c progress is called periodically during each pass (from caller
+     * thread), an empty result is returned when cancelled.
+     */
+    std::vector<QPointF>    computeLayout(const Children& children, const std::vector<QSizeF>& sizes,
+                                          qreal xSpacing = 25., qreal ySpacing = 25.,
+                                          const Progress& progress = {}) const;
     //@}
     //-------------------------------------------------------------------------
 };
@@ -45,6 +45,9 @@
 #include <QQmlComponent>
 #include <QQmlEngine>
 #include <QQuickItem>
+#include <QMetaProperty>
+#include <QColor>
+#include <QDebug>
 
 namespace std
 {
@@ -94,5 +97,49 @@ static inline auto getItemGlobalZ_rec(const QQuickItem* item) -> qreal {
     return impl(item, impl);
 };
 
+/*! \brief Connect all \c source properties notify signals to \c receiver \c slot (for example to monitor any style modification).
+ *
+ * \arg slot normalized slot signature, for example "requestUpdate()".
+ */
+static inline void connectNotifySignals(QObject* source, QObject* receiver, const char* slot) {
+    if (source == nullptr ||
+        receiver == nullptr)
+        return;
+    const auto receiverMetaObject = receiver->metaObject();
+    const auto receiverSlot = receiverMetaObject->method(receiverMetaObject->indexOfSlot(slot));
+    if (!receiverSlot.isValid())
+        return;
+    const auto sourceMetaObject = source->metaObject();
+    for (int p = QObject::staticMetaObject.propertyCount(); p < sourceMetaObject->propertyCount(); p++) {
+        const auto property = sourceMetaObject->property(p);
+        if (property.hasNotifySignal())
+            QObject::connect(source, property.notifySignal(), receiver, receiverSlot);
+    }
+}
+
+/*! \brief Create a resize preview outline item for \c resizer (an unfilled \c color border rectangle), return nullptr on error.
+ *
+ * Outline is owned by \c resizer and has CppOwnership, it is initially hidden.
+ */
+static inline QQuickItem* createResizePreview(QQuickItem* resizer, const QColor& color) {
+    QQmlEngine* engine = resizer != nullptr ? qmlEngine(resizer) : nullptr;
+    if (engine == nullptr)
+        return nullptr;
+    QQmlComponent previewComponent{engine};
+    const QString previewQml{ QStringLiteral("import QtQuick 2.7\n  Rectangle {") +
+                              QStringLiteral("color:\"transparent\";border.width:1;") +
+                              QStringLiteral("border.color:\"") + color.name() + QStringLiteral("\"; }") };
+    previewComponent.setData(previewQml.toUtf8(), QUrl{});
+    auto preview = previewComponent.isReady() ? qobject_cast<QQuickItem*>(previewComponent.create()) :
+                                                nullptr;
+    if (preview == nullptr) {
+        qWarning() << "qan::createResizePreview(): Error: Can't create resize preview QML component.";
+        return nullptr;
+    }
+    engine->setObjectOwnership(preview, QQmlEngine::CppOwnership);
+    preview->setParent(resizer);
+    preview->setVisible(false);
+    return preview;
+}
 
 } // ::qan
@@ -388,6 +388,39 @@ public:
             _container.clear();
     }
 
+public:
+    /*! \brief Replace container content with \c items, model is notified with a single reset (null items are ignored).
+     *
+     * Usefull for bulk modifications, where calling append() or removeAll() for every item would
+     * generate one model notification per item.
+     */
+    template <class Items_t>
+    void    assign(const Items_t& items) {
+        if (_model && _modelImpl) {
+            fwdBeginResetModel();
+            _modelImpl->_qObjectItemMap.clear();
+            _container.clear();
+            assignImpl(items);
+            fwdEndResetModel();
+            fwdEmitLengthChanged();
+        } else {
+            _container.clear();
+            assignImpl(items);
+        }
+    }
+
+private:
+    template <class Items_t>
+    inline auto assignImpl(const Items_t& items) -> void {
+        for (const auto& i : items) {
+            const T item{i};
+            if (isNullPtr(item, typename ItemDispatcher<T>::type{}))
+                continue;
+            qcm::adapter<C, T>::append(_container, item);
+            appendImpl(item, typename ItemDispatcher<T>::type{});
+        }
+    }
+
 public:
     /*! \brief Clear the container and optionally call delete on contained objects.
      *
@@ -0,0 +1,264 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	benchmarks.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Qt headers
+#include <QLineF>
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./tests.h"
+#include "./generators.h"
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// QuickQanava benchmarks
+//-----------------------------------------------------------------------------
+// Note: Built in quickqanava_benchmarks, not registered in ctest. Timings are reported
+// as test properties, run with --gtest_output=xml:benchmarks.xml to collect them.
+
+namespace { // ::
+
+using Clock = std::chrono::steady_clock;
+
+double  elapsedMs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Record a benchmark timing in test properties, key is suffixed with the benchmark size.
+void    recordMs(const std::string& key, std::size_t size, double ms)
+{
+    ::testing::Test::RecordProperty(key + "_" + std::to_string(size), std::to_string(ms));
+}
+
+// Drag selection primary node, return average drag move duration in ms
+double  dragSelection(qan::NodeItem& primaryItem, const QPointF& delta, int moveCount)
+{
+    auto& ctrl = primaryItem.draggableCtrl();
+    const QPointF origin{10., 10.};
+    ctrl.beginDragMove(origin, /*dragSelection*/true, /*notify*/false);
+    const auto start = Clock::now();
+    for (int m = 1; m <= moveCount; ++m)
+        ctrl.dragMove(origin + delta * (static_cast<qreal>(m) / moveCount), /*dragSelection*/true);
+    const auto ms = elapsedMs(start);
+    ctrl.endDragMove(/*dragSelection*/true, /*notify*/false);
+    return ms / moveCount;
+}
+
+// Mimic pre batch selection drag: every selected item is dragged with its own controller
+double  dragItems(const std::vector<qan::Node*>& nodes, const QPointF& delta, int moveCount)
+{
+    const QPointF origin{10., 10.};
+    for (const auto node : nodes)
+        node->getItem()->draggableCtrl().beginDragMove(origin, false, false);
+    const auto start = Clock::now();
+    for (int m = 1; m <= moveCount; ++m)
+        for (const auto node : nodes)
+            node->getItem()->draggableCtrl().dragMove(origin + delta * (static_cast<qreal>(m) / moveCount), false);
+    const auto ms = elapsedMs(start);
+    for (const auto node : nodes)
+        node->getItem()->draggableCtrl().endDragMove(false, false);
+    return ms / moveCount;
+}
+
+// Legacy recursive OrgTreeLayout vertical layout (before Walker), used as a benchmark reference.
+QRectF  legacyLayoutVert_rec(const qan::OrgTreeLayout::Children& children, const std::vector<QSizeF>& sizes,
+                             std::vector<QPointF>& positions, std::size_t node, QRectF br)
+{
+    const auto x = br.right() + 25.;
+    for (const auto child : children[node]) {
+        positions[child] = QPointF{x, br.bottom() + 25.};
+        br = br.united(QRectF{positions[child], sizes[child]});
+        const auto childBr = legacyLayoutVert_rec(children, sizes, positions, child, br);
+        br.setBottom(childBr.bottom());
+    }
+    return br;
+}
+
+} // ::
+
+TEST(qan_EdgeGeometryStore, update)
+{
+    // Compare qan::EdgeItem::updateItem() per edge pipeline with batch store update (qan::Graph::flushEdgeUpdates()
+    // algorithm) on the same concrete edge items.
+    static constexpr std::size_t nodeCount = 20000;
+    static constexpr std::size_t edgeCount = 100000;
+    qan::test::Graph graph;
+    const auto endpoints = qan::test::randomEdgeEndpoints(nodeCount);
+    std::vector<qan::Node*> nodes;
+    nodes.reserve(nodeCount);
+    for (const auto& endpoint : endpoints) {
+        auto node = graph.insertNode();
+        ASSERT_TRUE(node != nullptr && node->getItem() != nullptr);
+        node->getItem()->setPosition(endpoint.first.topLeft());
+        node->getItem()->setSize(endpoint.first.size());
+        nodes.push_back(node);
+    }
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<std::size_t> index{0, nodeCount - 1};
+    std::vector<qan::EdgeItem*> edgeItems;
+    edgeItems.reserve(edgeCount);
+    while (edgeItems.size() < edgeCount) {
+        const auto src = index(generator);
+        const auto dst = index(generator);
+        if (src == dst)
+            continue;
+        auto edge = graph.insertEdge(nodes[src], nodes[dst]);
+        ASSERT_TRUE(edge != nullptr && edge->getItem() != nullptr);
+        edgeItems.push_back(edge->getItem());
+    }
+
+    auto start = Clock::now();
+    for (auto edgeItem : edgeItems)
+        edgeItem->updateItem();
+    recordMs("updateItemMs", edgeCount, elapsedMs(start));
+    std::vector<QLineF> lines;
+    lines.reserve(edgeCount);
+    for (const auto edgeItem : edgeItems)
+        lines.push_back(QLineF{edgeItem->mapToItem(graph.getContainerItem(), edgeItem->getP1()),
+                               edgeItem->mapToItem(graph.getContainerItem(), edgeItem->getP2())});
+
+    qan::EdgeGeometryStore store;
+    store.reserve(edgeCount);
+    std::vector<qan::EdgeGeometryStore::index_t> storeIndexes(edgeCount, 0);
+    std::vector<bool> stored(edgeCount, false);
+    start = Clock::now();
+    for (std::size_t e = 0; e < edgeCount; e++)
+        stored[e] = edgeItems[e]->storeGeometry(store, storeIndexes[e]);
+    const auto packMs = elapsedMs(start);
+    const auto kernelStart = Clock::now();
+    store.update();
+    const auto kernelsMs = elapsedMs(kernelStart);
+    const auto applyStart = Clock::now();
+    for (std::size_t e = 0; e < edgeCount; e++)
+        if (stored[e])
+            edgeItems[e]->applyStoredGeometry(store, storeIndexes[e]);
+    const auto applyMs = elapsedMs(applyStart);
+    recordMs("storeMs", edgeCount, elapsedMs(start));
+    recordMs("storePackMs", edgeCount, packMs);         // Pack and unpack cost versus kernels cost
+    recordMs("storeKernelsMs", edgeCount, kernelsMs);
+    recordMs("storeApplyMs", edgeCount, applyMs);
+    EXPECT_EQ(store.size(), edgeCount);     // Default node delegates bounding shapes are supported by store
+    for (std::size_t e = 0; e < edgeCount; e++) {
+        const auto edgeItem = edgeItems[e];
+        if (edgeItem->getHidden())
+            continue;
+        const auto p1 = edgeItem->mapToItem(graph.getContainerItem(), edgeItem->getP1());
+        const auto p2 = edgeItem->mapToItem(graph.getContainerItem(), edgeItem->getP2());
+        EXPECT_NEAR(p1.x(), lines[e].p1().x(), 0.01);
+        EXPECT_NEAR(p1.y(), lines[e].p1().y(), 0.01);
+        EXPECT_NEAR(p2.x(), lines[e].p2().x(), 0.01);
+        EXPECT_NEAR(p2.y(), lines[e].p2().y(), 0.01);
+    }
+}
+
+TEST(qan_DraggableCtrl, dragSelection)
+{
+    static constexpr int moveCount = 20;
+    for (const std::size_t nodeCount : {std::size_t{1000}, std::size_t{10000}}) {
+        qan::Graph graph;
+        QQuickItem container;
+        graph.setContainerItem(&container);
+        const auto nodes = qan::test::insertSelectedNodes(graph, container, nodeCount);
+        ASSERT_EQ(nodes.size(), nodeCount);
+
+        recordMs("perItemMsPerMove", nodeCount, dragItems(nodes, QPointF{100., 50.}, moveCount));
+        const auto initialPosition = nodes.back()->getItem()->position();
+        recordMs("batchMsPerMove", nodeCount, dragSelection(*nodes.front()->getItem(), QPointF{100., 50.}, moveCount));
+        EXPECT_EQ(nodes.back()->getItem()->position(), initialPosition + QPointF(100., 50.));
+    }
+}
+
+TEST(qan_SugiyamaLayout, computeLayout)
+{
+    for (const std::size_t nodeCount : {std::size_t{5000}, std::size_t{20000}}) {
+        std::vector<QSizeF> sizes;
+        qan::SugiyamaLayout::Edges edges;
+        qan::test::randomDag(nodeCount, sizes, edges);
+        qan::SugiyamaLayout layout;
+        const auto start = Clock::now();
+        const auto positions = layout.computeLayout(sizes, edges);
+        recordMs("computeLayoutMs", nodeCount, elapsedMs(start));
+        ASSERT_EQ(positions.size(), nodeCount);
+        RecordProperty("crossings_" + std::to_string(nodeCount), static_cast<int>(layout.getCrossingCount()));
+        RecordProperty("dummies_" + std::to_string(nodeCount), static_cast<int>(layout.getDummyCount()));
+    }
+}
+
+TEST(qan_ForceDirectedLayout, computeLayout)
+{
+    // Note: Timings depend on available cores, with 8 threads on fewer cores workers are time sliced.
+    RecordProperty("cores", static_cast<int>(std::thread::hardware_concurrency()));
+    for (const std::size_t nodeCount : {std::size_t{1000}, std::size_t{10000}, std::size_t{100000}}) {
+        const auto input = qan::test::randomForceDirectedTree(nodeCount);
+        for (const int threadCount : {1, 8}) {
+            qan::ForceDirectedLayout layout;
+            layout.setThreadCount(threadCount);
+            const auto start = Clock::now();
+            const auto positions = layout.computeLayout(input);
+            recordMs("computeLayoutMs_" + std::to_string(threadCount) + "threads", nodeCount, elapsedMs(start));
+            ASSERT_EQ(positions.size(), nodeCount);
+        }
+    }
+}
+
+TEST(qan_OrgTreeLayout, computeLayout)
+{
+    for (const std::size_t nodeCount : {std::size_t{10000}, std::size_t{100000}}) {
+        std::vector<QSizeF> sizes;
+        qan::OrgTreeLayout::Children children;
+        qan::test::randomOrgTree(nodeCount, nodeCount, sizes, children);   // Random recursive tree, depth is O(log(n))
+
+        auto start = Clock::now();
+        std::vector<QPointF> legacyPositions(nodeCount);
+        legacyLayoutVert_rec(children, sizes, legacyPositions, 0, QRectF{QPointF{0., 0.}, sizes[0]});
+        recordMs("legacyMs", nodeCount, elapsedMs(start));
+
+        qan::OrgTreeLayout layout;
+        start = Clock::now();
+        const auto positions = layout.computeLayout(children, sizes);
+        recordMs("walkerMs", nodeCount, elapsedMs(start));
+        ASSERT_EQ(positions.size(), nodeCount);
+    }
+}
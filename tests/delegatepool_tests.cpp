@@ -0,0 +1,323 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	delegatepool_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <vector>
+
+// Qt headers
+#include <QQmlEngine>
+#include <QQmlComponent>
+#include <QQuickWindow>
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./tests.h"
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// qan::DelegatePool tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_DelegatePool, acquireRelease)
+{
+    QQmlEngine engine;
+    QQmlComponent component{&engine};
+    qan::NodeStyle style, otherStyle;
+    qan::DelegatePool pool;
+    EXPECT_EQ(pool.acquire(&component, &style), nullptr);   // Empty pool: miss
+    EXPECT_EQ(pool.getMisses(), 1u);
+
+    auto item = new QQuickItem{};
+    EXPECT_FALSE(pool.release(nullptr, &style, item));
+    EXPECT_TRUE(pool.release(&component, &style, item));
+    EXPECT_EQ(pool.size(), 1u);
+    EXPECT_EQ(pool.acquire(&component, &otherStyle), nullptr);  // Different style: miss
+    EXPECT_EQ(pool.acquire(&component, &style), item);
+    EXPECT_EQ(pool.getHits(), 1u);
+    EXPECT_EQ(pool.getMisses(), 2u);
+    EXPECT_EQ(pool.size(), 0u);
+    delete item;
+}
+
+TEST(qan_DelegatePool, capacity)
+{
+    QQmlEngine engine;
+    QQmlComponent component{&engine};
+    qan::NodeStyle style;
+    qan::DelegatePool pool;
+    pool.setCapacity(2);
+    EXPECT_TRUE(pool.release(&component, &style, new QQuickItem{}));
+    EXPECT_TRUE(pool.release(&component, &style, new QQuickItem{}));
+    auto item = new QQuickItem{};
+    EXPECT_FALSE(pool.canRelease(&component, &style));
+    EXPECT_FALSE(pool.release(&component, &style, item));    // Full, item is not owned by pool
+    EXPECT_EQ(pool.size(), 2u);
+    pool.setCapacity(1);
+    EXPECT_EQ(pool.size(), 1u);
+    pool.clear();
+    EXPECT_EQ(pool.size(), 0u);
+    delete item;
+}
+
+TEST(qan_DelegatePool, destroyedItem)
+{
+    QQmlEngine engine;
+    QQmlComponent component{&engine};
+    qan::NodeStyle style;
+    qan::DelegatePool pool;
+    auto item = new QQuickItem{};
+    pool.release(&component, &style, item);
+    delete item;                                            // Pooled item destroyed externally
+    EXPECT_EQ(pool.acquire(&component, &style), nullptr);
+}
+
+TEST(qan_DelegatePool, purge)
+{
+    QQmlEngine engine;
+    QQmlComponent component{&engine};
+    qan::NodeStyle style;
+    auto destroyedStyle = new qan::NodeStyle{};
+    qan::DelegatePool pool;
+    const QPointer<QQuickItem> item = new QQuickItem{};
+    pool.release(&component, &style, item);
+    pool.release(&component, destroyedStyle, new QQuickItem{});
+    EXPECT_EQ(pool.size(), 2u);
+    delete destroyedStyle;
+    pool.purge();                                           // Only destroyed style bucket is dropped
+    EXPECT_EQ(pool.size(), 1u);
+    EXPECT_EQ(pool.acquire(&component, &style), item.data());
+    delete item;
+}
+
+TEST(qan_Graph, delegatePooling)
+{
+    qan::test::Graph graph;
+    graph.setDelegatePooling(true);
+    auto n1 = graph.insertNode();
+    ASSERT_TRUE(n1 != nullptr && n1->getItem() != nullptr);
+    const QPointer<qan::NodeItem> n1Item = n1->getItem();
+    graph.removeNode(n1);
+    EXPECT_EQ(graph.getDelegatePoolSize(), 1);
+    EXPECT_FALSE(n1Item->isVisible());
+    EXPECT_EQ(n1Item->getNode(), nullptr);
+
+    auto n2 = graph.insertNode();                           // Same component and style: item is reused
+    ASSERT_TRUE(n2 != nullptr);
+    EXPECT_EQ(n2->getItem(), n1Item.data());
+    EXPECT_EQ(n1Item->getNode(), n2);
+    EXPECT_TRUE(n1Item->isVisible());
+    EXPECT_EQ(graph.getDelegatePoolHits(), 1);
+    EXPECT_EQ(graph.getDelegatePoolSize(), 0);
+}
+
+TEST(qan_Graph, delegatePoolingReset)
+{
+    qan::test::Graph graph;
+    graph.setDelegatePooling(true);
+    auto n1 = graph.insertNode();
+    ASSERT_TRUE(n1 != nullptr && n1->getItem() != nullptr);
+    const QPointer<qan::NodeItem> item = n1->getItem();
+    const auto size = item->size();
+    const auto minimumSize = item->getMinimumSize();
+    item->setPosition(QPointF{500., 500.});
+    item->setSize(size * 3.);
+    item->setMinimumSize(QSizeF{10., 10.});
+    item->setResizable(false);
+    item->setCollapsed(true);
+    item->setDragged(true);
+    item->setLod(qan::NodeItem::Lod::Minimal);
+    graph.removeNode(n1);
+
+    auto n2 = graph.insertNode();                           // Reused item has delegate defaults
+    ASSERT_TRUE(n2 != nullptr);
+    ASSERT_EQ(n2->getItem(), item.data());
+    EXPECT_EQ(item->position(), (QPointF{0., 0.}));
+    EXPECT_EQ(item->size(), size);
+    EXPECT_EQ(item->getMinimumSize(), minimumSize);
+    EXPECT_TRUE(item->getResizable());
+    EXPECT_FALSE(item->getCollapsed());
+    EXPECT_FALSE(item->getDragged());
+    EXPECT_EQ(item->getLod(), qan::NodeItem::Lod::Full);
+}
+
+TEST(qan_Graph, delegatePoolingAdjacentEdges)
+{
+    qan::test::Graph graph;
+    graph.setDelegatePooling(true);
+    auto n1 = graph.insertNode();
+    auto n2 = graph.insertNode();
+    auto n3 = graph.insertNode();
+    ASSERT_TRUE(n1 != nullptr && n2 != nullptr && n3 != nullptr);
+    auto e1 = graph.insertEdge(n1, n2);
+    auto e2 = graph.insertEdge(n3, n1);
+    ASSERT_TRUE(e1 != nullptr && e1->getItem() != nullptr &&
+                e2 != nullptr && e2->getItem() != nullptr);
+    const QPointer<qan::EdgeItem> e1Item = e1->getItem();
+    graph.removeNode(n1);                                   // n1 item and its in/out edges items are pooled
+    EXPECT_EQ(graph.getDelegatePoolSize(), 3);
+    ASSERT_FALSE(e1Item.isNull());
+    EXPECT_EQ(e1Item->getEdge(), nullptr);
+    EXPECT_EQ(e1Item->getSourceItem(), nullptr);
+    auto e3 = graph.insertEdge(n2, n3);
+    ASSERT_TRUE(e3 != nullptr && e3->getItem() != nullptr);
+    EXPECT_EQ(graph.getDelegatePoolSize(), 2);
+    EXPECT_EQ(e3->getItem()->getSourceItem(), n2->getItem());
+}
+
+TEST(qan_Graph, delegatePoolingGroupsAndPorts)
+{
+    qan::test::Graph graph;
+    graph.setDelegatePooling(true);
+    auto g1 = graph.insertGroup();
+    ASSERT_TRUE(g1 != nullptr && g1->getItem() != nullptr);
+    const QPointer<qan::GroupItem> g1Item = g1->getGroupItem();
+    graph.removeGroup(g1);
+    EXPECT_EQ(graph.getDelegatePoolSize(), 1);
+    EXPECT_EQ(g1Item->getGroup(), nullptr);
+    auto g2 = graph.insertGroup();                          // Group item is reused
+    ASSERT_TRUE(g2 != nullptr);
+    EXPECT_EQ(g2->getItem(), g1Item.data());
+    EXPECT_EQ(g1Item->getGroup(), g2);
+
+    auto n1 = graph.insertNode();                           // Node with ports: ports are destroyed, node item is pooled
+    ASSERT_TRUE(n1 != nullptr && n1->getItem() != nullptr);
+    const QPointer<qan::PortItem> port = graph.insertPort(n1, qan::NodeItem::Dock::Left);
+    ASSERT_FALSE(port.isNull());
+    const QPointer<qan::NodeItem> n1Item = n1->getItem();
+    graph.removeNode(n1);
+    EXPECT_EQ(graph.getDelegatePoolSize(), 1);
+    EXPECT_TRUE(n1Item->getPorts().isEmpty());
+    EXPECT_TRUE(qan::test::waitFor([&port]() { return port.isNull(); }));
+}
+
+TEST(qan_Graph, delegatePoolingClear)
+{
+    qan::test::Graph graph;
+    graph.setDelegatePooling(true);
+    auto g = graph.insertGroup();
+    auto n1 = graph.insertNode();
+    auto n2 = graph.insertNode();
+    ASSERT_TRUE(g != nullptr && n1 != nullptr && n2 != nullptr);
+    graph.groupNode(g, n1);
+    graph.insertEdge(n1, n2);
+    graph.clear();                                          // Group, nodes and edge items are pooled
+    EXPECT_EQ(graph.getDelegatePoolSize(), 4);
+    graph.insertNode();
+    EXPECT_EQ(graph.getDelegatePoolHits(), 1);
+    EXPECT_EQ(graph.getDelegatePoolSize(), 3);
+}
+
+TEST(qan_Graph, asynchronousInsertionWithoutWindow)
+{
+    qan::test::Graph graph;
+    graph.setAsynchronousInsertion(true);
+    EXPECT_TRUE(graph.getAsynchronousInsertion());
+    graph.setIncubationBudget(0);                           // Budget is at least 1ms
+    EXPECT_EQ(graph.getIncubationBudget(), 1);
+    auto n1 = graph.insertNode();                           // No window: creation falls back to synchronous
+    auto n2 = graph.insertNode();
+    ASSERT_TRUE(n1 != nullptr && n2 != nullptr);
+    EXPECT_EQ(graph.getPendingItems(), 0);
+    ASSERT_TRUE(n1->getItem() != nullptr);
+    auto e = graph.insertEdge(n1, n2);
+    ASSERT_TRUE(e != nullptr && e->getItem() != nullptr);
+    EXPECT_EQ(e->getItem()->getSourceItem(), n1->getItem());
+    EXPECT_EQ(e->getItem()->getDestinationItem(), n2->getItem());
+}
+
+TEST(qan_Graph, asynchronousInsertion)
+{
+    QQuickWindow window;
+    window.resize(400, 300);
+    qan::test::Graph graph{window.contentItem()};
+    graph.setAsynchronousInsertion(true);
+    graph.setIncubationBudget(1);
+    window.show();
+    ASSERT_TRUE(qan::test::waitFor([&window]() { return window.isExposed(); }));
+
+    int itemsReady = 0;
+    QObject::connect(&graph, &qan::Graph::itemsReady, [&itemsReady]() { itemsReady++; });
+
+    // Topology is inserted immediately, items are incubated with QQmlIncubator
+    static constexpr int nodeCount = 500;
+    std::vector<qan::Node*> nodes;
+    for (int n = 0; n < nodeCount; n++)
+        nodes.push_back(graph.insertNode());
+    ASSERT_TRUE(std::all_of(nodes.cbegin(), nodes.cend(), [](auto node) { return node != nullptr; }));
+    EXPECT_EQ(graph.getNodeCount(), nodeCount);
+    EXPECT_EQ(nodes.front()->getItem(), nullptr);
+    auto e = graph.insertEdge(nodes[0], nodes[1]);          // Edge between incubated nodes
+    ASSERT_TRUE(e != nullptr);
+    EXPECT_EQ(e->getItem(), nullptr);
+    auto removed = graph.insertNode();                      // Node removed while it's item is incubated
+    auto removedEdge = graph.insertEdge(nodes[0], removed);
+    ASSERT_TRUE(removed != nullptr && removedEdge != nullptr);
+    EXPECT_EQ(graph.getPendingItems(), nodeCount + 3);
+    graph.removeNode(removed);
+    std::vector<int> framePendingItems;     // Pending items sampled after every frame
+    QObject::connect(&window, &QQuickWindow::frameSwapped, &graph, [&framePendingItems, &graph]() {
+        framePendingItems.push_back(graph.getPendingItems());
+    });
+
+    ASSERT_TRUE(qan::test::waitFor([&graph]() { return graph.getPendingItems() == 0; }, 30000));
+    EXPECT_EQ(itemsReady, 1);
+
+    // Incubation is spread over multiple frames within per frame budget
+    const auto partialFrames = std::count_if(framePendingItems.cbegin(), framePendingItems.cend(),
+                                             [](int pending) { return pending > 0 && pending < nodeCount + 3; });
+    EXPECT_GT(partialFrames, 1);
+    EXPECT_TRUE(std::is_sorted(framePendingItems.crbegin(), framePendingItems.crend()));
+
+    // All items are attached, edge is bound once it's source and destination items are ready
+    for (const auto node : nodes)
+        EXPECT_TRUE(node->getItem() != nullptr && node->getItem()->isVisible());
+    ASSERT_TRUE(e->getItem() != nullptr);
+    EXPECT_EQ(e->getItem()->getSourceItem(), nodes[0]->getItem());
+    EXPECT_EQ(e->getItem()->getDestinationItem(), nodes[1]->getItem());
+
+    // Removed node item has been destroyed once incubated
+    EXPECT_TRUE(qan::test::waitFor([&graph]() {
+        const auto children = graph.getContainerItem()->childItems();
+        return std::count_if(children.cbegin(), children.cend(), [](auto item) {
+            return qobject_cast<qan::NodeItem*>(item) != nullptr;
+        }) == graph.getNodeCount();
+    }));
+    EXPECT_EQ(graph.getNodeCount(), nodeCount);
+    EXPECT_EQ(graph.get_edges().size(), 1u);
+}
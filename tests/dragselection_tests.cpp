@@ -0,0 +1,96 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	dragselection_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <vector>
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./generators.h"
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// qan::DraggableCtrl multiple selection drag tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_DraggableCtrl, dragSelection)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    graph.setContainerItem(&container);
+    const auto nodes = qan::test::insertSelectedNodes(graph, container, 10);
+    ASSERT_EQ(nodes.size(), 10u);
+    ASSERT_TRUE(graph.hasMultipleSelection());
+
+    std::vector<QPointF> initialPositions;
+    for (const auto node : nodes)
+        initialPositions.push_back(node->getItem()->position());
+    const auto primaryItem = nodes.front()->getItem();
+    const auto primaryZ = primaryItem->z();
+
+    auto& ctrl = primaryItem->draggableCtrl();
+    ctrl.beginDragMove(QPointF{0., 0.}, true, false);
+    for (const auto node : nodes)
+        EXPECT_TRUE(node->getItem()->getDragged());
+    ctrl.dragMove(QPointF{15., 5.}, true);
+    ctrl.dragMove(QPointF{30., 10.}, true);
+    ctrl.endDragMove(true, false);
+
+    for (std::size_t n = 0; n < nodes.size(); ++n) {    // Whole selection is moved by the same delta
+        EXPECT_EQ(nodes[n]->getItem()->position(), initialPositions[n] + QPointF(30., 10.));
+        EXPECT_FALSE(nodes[n]->getItem()->getDragged());
+    }
+    EXPECT_EQ(primaryItem->z(), primaryZ);              // Drag z is restored
+}
+
+TEST(qan_DraggableCtrl, dragSelectionOrientation)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    graph.setContainerItem(&container);
+    const auto nodes = qan::test::insertSelectedNodes(graph, container, 2);
+    ASSERT_EQ(nodes.size(), 2u);
+    const auto item = nodes.back()->getItem();
+    item->setDragOrientation(qan::NodeItem::DragOrientation::DragVertical);
+    const auto initialPosition = item->position();
+
+    auto& ctrl = nodes.front()->getItem()->draggableCtrl();
+    ctrl.beginDragMove(QPointF{0., 0.}, true, false);
+    ctrl.dragMove(QPointF{20., 20.}, true);
+    ctrl.endDragMove(true, false);
+    EXPECT_EQ(item->position(), initialPosition + QPointF(0., 20.));    // Horizontal move is ignored
+}
@@ -0,0 +1,161 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	edgebatchrenderer_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <vector>
+
+// Qt headers
+#include <QQuickWindow>
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./tests.h"
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// qan::EdgeBatchRenderer tests
+//-----------------------------------------------------------------------------
+
+namespace { // ::
+
+using qan::test::waitFor;
+
+// Return batch renderers in graph container (ie base renderer and its layers).
+std::vector<qan::EdgeBatchRenderer*>    batchRenderers(qan::Graph& graph)
+{
+    const auto renderers = graph.getContainerItem()->findChildren<qan::EdgeBatchRenderer*>(Qt::FindDirectChildrenOnly);
+    return std::vector<qan::EdgeBatchRenderer*>{renderers.cbegin(), renderers.cend()};
+}
+
+} // ::
+
+TEST(qan_EdgeBatchRenderer, groupLayers)
+{
+    QQuickWindow window;
+    window.resize(400, 400);
+    qan::test::Graph graph{window.contentItem()};
+    graph.setSize(QSizeF{400., 400.});
+    graph.setEdgeBatchRendering(true);
+    auto n1 = graph.insertNode();                           // z=1
+    auto n2 = graph.insertNode();                           // z=2
+    auto group = graph.insertGroup();                       // z=3
+    auto n3 = graph.insertNode();
+    auto n4 = graph.insertNode();
+    ASSERT_TRUE(n1 != nullptr && n2 != nullptr && n3 != nullptr && n4 != nullptr);
+    ASSERT_TRUE(group != nullptr && group->getGroupItem() != nullptr);
+    ASSERT_TRUE(graph.groupNode(group, n3));
+    ASSERT_TRUE(graph.groupNode(group, n4));
+    auto under = graph.insertEdge(n1, n2);                  // Edge z is less than group z: base renderer
+    auto over = graph.insertEdge(n3, n4);                   // Edge between grouped nodes: on top of group
+    ASSERT_TRUE(under != nullptr && over != nullptr);
+    window.show();
+
+    ASSERT_TRUE(waitFor([&]() { return batchRenderers(graph).size() == 2; }));
+    const auto groupZ = group->getGroupItem()->z();
+    for (const auto renderer : batchRenderers(graph)) {
+        if (renderer == graph.getEdgeBatchRenderer())
+            EXPECT_LT(renderer->z(), groupZ);
+        else
+            EXPECT_GT(renderer->z(), groupZ);               // Upper layer is just above group
+        EXPECT_GT(renderer->getVertexCount(), 0u);
+    }
+
+    graph.sendToFront(group->getGroupItem());               // Layers follow group z
+    ASSERT_TRUE(waitFor([&]() {
+        const auto renderers = batchRenderers(graph);
+        return std::all_of(renderers.cbegin(), renderers.cend(), [&](auto renderer) {
+            return renderer == graph.getEdgeBatchRenderer() ||
+                   renderer->z() > group->getGroupItem()->z();
+        });
+    }));
+}
+
+TEST(qan_EdgeBatchRenderer, incrementalUpdate)
+{
+    QQuickWindow window;
+    window.resize(400, 400);
+    qan::test::Graph graph{window.contentItem()};
+    graph.setSize(QSizeF{400., 400.});
+    graph.setEdgeBatchRendering(true);
+    std::vector<qan::Node*> nodes;
+    for (int n = 0; n < 1000; n++) {
+        nodes.push_back(graph.insertNode());
+        ASSERT_TRUE(nodes.back() != nullptr && nodes.back()->getItem() != nullptr);
+        nodes.back()->getItem()->setPosition(QPointF{n * 10., (n % 2) * 50.});
+        if (n > 0)
+            ASSERT_TRUE(graph.insertEdge(nodes[n - 1], nodes[n]) != nullptr);
+    }
+    window.show();
+    const auto renderer = graph.getEdgeBatchRenderer();
+    ASSERT_TRUE(renderer != nullptr);
+    ASSERT_TRUE(waitFor([&]() { return renderer->getUploadedVertexCount() >= renderer->getVertexCount() &&
+                                       renderer->getVertexCount() > 0; }));
+    const auto vertexCount = renderer->getVertexCount();
+    const auto uploaded = renderer->getUploadedVertexCount();
+
+    nodes[500]->getItem()->setPosition(QPointF{5000., 200.});  // Only moved node edges chunks are uploaded
+    ASSERT_TRUE(waitFor([&]() { return renderer->getUploadedVertexCount() > uploaded; }));
+    EXPECT_LT((renderer->getUploadedVertexCount() - uploaded) * 3, vertexCount);
+}
+
+TEST(qan_EdgeBatchRenderer, incrementalMinimalUpdate)
+{
+    QQuickWindow window;
+    window.resize(400, 400);
+    qan::test::Graph graph{window.contentItem()};
+    graph.setSize(QSizeF{400., 400.});
+    graph.setLevelOfDetail(true);
+    graph.setLodZoom(0.1);                                  // Minimal lod: nodes rects are batch rendered
+    std::vector<qan::Node*> nodes;
+    for (int n = 0; n < 1000; n++) {
+        nodes.push_back(graph.insertNode());
+        ASSERT_TRUE(nodes.back() != nullptr && nodes.back()->getItem() != nullptr);
+        nodes.back()->getItem()->setPosition(QPointF{n * 10., 0.});
+    }
+    window.show();
+    const auto renderer = graph.getEdgeBatchRenderer();
+    ASSERT_TRUE(renderer != nullptr && renderer->getMinimal());
+    ASSERT_TRUE(waitFor([&]() { return renderer->getUploadedVertexCount() >= renderer->getVertexCount() &&
+                                       renderer->getVertexCount() > 0; }));
+    const auto vertexCount = renderer->getVertexCount();
+    const auto uploaded = renderer->getUploadedVertexCount();
+
+    nodes[10]->getItem()->setPosition(QPointF{0., 100.});
+    ASSERT_TRUE(waitFor([&]() { return renderer->getUploadedVertexCount() > uploaded; }));
+    EXPECT_LT((renderer->getUploadedVertexCount() - uploaded) * 3, vertexCount);
+}
@@ -0,0 +1,364 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	edgegeometry_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// STD headers
+#include <vector>
+#include <cmath>
+
+// Qt headers
+#include <QLineF>
+#include <QPolygonF>
+#include <QPainterPath>
+#include <QtMath>
+#include <QQuickWindow>
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./tests.h"
+#include "./generators.h"
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+namespace { // ::
+
+//! Default node bounding shape (see qan::NodeItem::generateDefaultBoundingShape()) translated to \c br.
+QPolygonF   boundingShape(const QRectF& br, qreal radius)
+{
+    if (radius <= 0.)
+        return QPolygonF{br};
+    QPainterPath path;
+    path.addRoundedRect(br, radius, radius);
+    return path.toFillPolygon(QTransform{});
+}
+
+//! Polygon based reference, same algorithm than qan::EdgeItem::getLineIntersection().
+QPointF     lineIntersection(const QPointF& p1, const QPointF& p2, const QPolygonF& polygon)
+{
+    const QLineF line{p1, p2};
+    QPointF source{p1};
+    QPointF intersection;
+    for (auto p = 0; p < polygon.length() - 1; ++p) {
+        const QLineF polyLine(polygon[p], polygon[p + 1]);
+        if (line.intersects(polyLine, &intersection) == QLineF::BoundedIntersection) {
+            source = intersection;
+            break;
+        }
+    }
+    return source;
+}
+
+} // ::
+
+//-----------------------------------------------------------------------------
+// qan::EdgeGeometryStore tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_EdgeGeometryStore, empty)
+{
+    qan::EdgeGeometryStore store;
+    EXPECT_EQ(store.size(), 0);
+    store.update();     // Should not crash
+    EXPECT_EQ(store.add(), 0u);
+    EXPECT_EQ(store.add(), 1u);
+    store.clear();
+    EXPECT_EQ(store.size(), 0);
+}
+
+TEST(qan_EdgeGeometryStore, straight)
+{
+    // Rectangular and rounded shapes straight ends should match polygon reference
+    for (const qreal radius : {0., qan::NodeItem::defaultBoundingShapeRadius}) {
+        const auto endpoints = qan::test::randomEdgeEndpoints(1000);
+        qan::EdgeGeometryStore store;
+        for (const auto& [srcBr, dstBr] : endpoints) {
+            const auto e = store.add();
+            store.setEndpoints(e, srcBr, radius, dstBr, radius);
+            store.setStyle(e, qan::EdgeGeometryStore::LineType::Straight, 0., false, false);
+        }
+        store.update();
+        const qreal tolerance = radius > 0. ? 0.05 : 0.0001;
+        for (qan::EdgeGeometryStore::index_t e = 0; e < store.size(); e++) {
+            const auto& [srcBr, dstBr] = endpoints[e];
+            if (store.getHidden(e))
+                continue;
+            const auto p1 = lineIntersection(srcBr.center(), dstBr.center(), boundingShape(srcBr, radius));
+            const auto p2 = lineIntersection(srcBr.center(), dstBr.center(), boundingShape(dstBr, radius));
+            EXPECT_NEAR(store.getP1(e).x(), p1.x(), tolerance);
+            EXPECT_NEAR(store.getP1(e).y(), p1.y(), tolerance);
+            EXPECT_NEAR(store.getP2(e).x(), p2.x(), tolerance);
+            EXPECT_NEAR(store.getP2(e).y(), p2.y(), tolerance);
+        }
+    }
+}
+
+TEST(qan_EdgeGeometryStore, straightHidden)
+{
+    // Edge between overlapping nodes or inside a node must be hidden
+    qan::EdgeGeometryStore store;
+    const auto e = store.add();
+    store.setEndpoints(e, QRectF{0., 0., 100., 100.}, 0., QRectF{10., 10., 20., 20.}, 0.);
+    store.setStyle(e, qan::EdgeGeometryStore::LineType::Straight, 12., true, true);
+    const auto f = store.add();
+    store.setEndpoints(f, QRectF{0., 0., 100., 100.}, 0., QRectF{300., 0., 100., 100.}, 0.);
+    store.setStyle(f, qan::EdgeGeometryStore::LineType::Straight, 12., false, false);
+    store.update();
+    EXPECT_TRUE(store.getHidden(e));
+    EXPECT_FALSE(store.getHidden(f));
+    EXPECT_NEAR(store.getP1(f).x(), 100., 0.0001);
+    EXPECT_NEAR(store.getP2(f).x(), 300., 0.0001);
+    EXPECT_NEAR(store.getDstAngle(f), 0., 0.0001);
+}
+
+TEST(qan_EdgeGeometryStore, straightArrow)
+{
+    // Ends are moved back by arrow length when edge has end shapes
+    qan::EdgeGeometryStore store;
+    const auto e = store.add();
+    store.setEndpoints(e, QRectF{0., 0., 100., 100.}, 0., QRectF{300., 0., 100., 100.}, 0.);
+    store.setStyle(e, qan::EdgeGeometryStore::LineType::Straight, 12., true, true);
+    store.update();
+    EXPECT_NEAR(store.getP1(e).x(), 112., 0.0001);
+    EXPECT_NEAR(store.getP2(e).x(), 288., 0.0001);
+    EXPECT_NEAR(store.getSrcAngle(e), 180., 0.0001);
+}
+
+TEST(qan_EdgeGeometryStore, ortho)
+{
+    qan::EdgeGeometryStore store;
+    const auto h = store.add();     // Horizontal: src center y is in dst y range
+    store.setEndpoints(h, QRectF{0., 0., 100., 100.}, 0., QRectF{300., 20., 100., 100.}, 0.);
+    store.setStyle(h, qan::EdgeGeometryStore::LineType::Ortho, 0., false, false);
+    const auto v = store.add();     // Vertical: src center x is in dst x range
+    store.setEndpoints(v, QRectF{0., 0., 100., 100.}, 0., QRectF{20., 300., 100., 100.}, 0.);
+    store.setStyle(v, qan::EdgeGeometryStore::LineType::Ortho, 0., false, false);
+    const auto c = store.add();     // Corner
+    store.setEndpoints(c, QRectF{0., 0., 100., 100.}, 0., QRectF{300., 300., 100., 100.}, 0.);
+    store.setStyle(c, qan::EdgeGeometryStore::LineType::Ortho, 0., false, false);
+    store.update();
+
+    EXPECT_EQ(store.getP1(h), (QPointF{100., 50.}));
+    EXPECT_EQ(store.getP2(h), (QPointF{300., 50.}));
+    EXPECT_EQ(store.getC1(h), (QPointF{200., 50.}));
+
+    EXPECT_EQ(store.getP1(v), (QPointF{50., 100.}));
+    EXPECT_EQ(store.getP2(v), (QPointF{50., 300.}));
+
+    EXPECT_FALSE(store.getHidden(c));   // Corner edge: ends are on two orthogonal sides
+    const auto p1 = store.getP1(c);
+    const auto p2 = store.getP2(c);
+    const auto c1 = store.getC1(c);
+    EXPECT_TRUE(qFuzzyCompare(p1.x(), c1.x()) || qFuzzyCompare(p1.y(), c1.y()));
+    EXPECT_TRUE(qFuzzyCompare(p2.x(), c1.x()) || qFuzzyCompare(p2.y(), c1.y()));
+}
+
+TEST(qan_EdgeGeometryStore, curved)
+{
+    // Curved edges ends lay on their node bounding rect, control points are symmetric around line center
+    const auto endpoints = qan::test::randomEdgeEndpoints(1000);
+    qan::EdgeGeometryStore store;
+    for (const auto& [srcBr, dstBr] : endpoints) {
+        const auto e = store.add();
+        store.setEndpoints(e, srcBr, 0., dstBr, 0.);
+        store.setStyle(e, qan::EdgeGeometryStore::LineType::Curved, 0., false, false);
+    }
+    store.update();
+    const auto onBorder = [](const QRectF& r, const QPointF& p) -> bool {
+        static constexpr qreal tolerance = 0.0001;
+        const bool inside = p.x() >= r.left() - tolerance && p.x() <= r.right() + tolerance &&
+                            p.y() >= r.top() - tolerance && p.y() <= r.bottom() + tolerance;
+        return inside && (std::abs(p.x() - r.left()) < tolerance || std::abs(p.x() - r.right()) < tolerance ||
+                          std::abs(p.y() - r.top()) < tolerance || std::abs(p.y() - r.bottom()) < tolerance);
+    };
+    for (qan::EdgeGeometryStore::index_t e = 0; e < store.size(); e++) {
+        const auto& [srcBr, dstBr] = endpoints[e];
+        if (store.getHidden(e) ||   // Control points might be inside src or dst for close nodes
+            srcBr.adjusted(-100., -100., 100., 100.).intersects(dstBr))
+            continue;
+        EXPECT_TRUE(onBorder(srcBr, store.getP1(e)));
+        EXPECT_TRUE(onBorder(dstBr, store.getP2(e)));
+        EXPECT_GE(store.getSrcAngle(e), 0.);
+        EXPECT_LT(store.getSrcAngle(e), 360.);
+        EXPECT_GE(store.getDstAngle(e), 0.);
+        EXPECT_LT(store.getDstAngle(e), 360.);
+    }
+}
+
+TEST(qan_NodeItem, analyticBoundingShape)
+{
+    // Analytic intersection should match flattened polygon intersection for all shape types
+    using Type = qan::NodeItem::BoundingShapeType;
+    const QRectF br{100., 200., 120., 60.};
+    const auto shape = [&br](Type type) -> QPolygonF {
+        QPainterPath path;
+        switch (type) {
+        case Type::Rect:        return QPolygonF{br};
+        case Type::RoundedRect: path.addRoundedRect(br, 5., 5.); break;
+        case Type::Ellipse:     path.addEllipse(br); break;
+        case Type::Polygon:     break;
+        }
+        return path.toFillPolygon(QTransform{});
+    };
+    for (const auto type : {Type::Rect, Type::RoundedRect, Type::Ellipse}) {
+        const auto polygon = shape(type);
+        for (int a = 0; a < 360; a += 7) {
+            const qreal angle = qDegreesToRadians(static_cast<qreal>(a));
+            const QPointF p = br.center() + QPointF{std::cos(angle) * 500., std::sin(angle) * 500.};
+            QPointF intersection;
+            EXPECT_TRUE(qan::NodeItem::intersectBoundingShape(type, 5., br, p, intersection));
+            const auto reference = lineIntersection(p, br.center(), polygon);
+            EXPECT_NEAR(intersection.x(), reference.x(), 0.5);
+            EXPECT_NEAR(intersection.y(), reference.y(), 0.5);
+        }
+        // No intersection when point is inside shape, or for polygon shapes
+        QPointF intersection{-1., -1.};
+        EXPECT_FALSE(qan::NodeItem::intersectBoundingShape(type, 5., br, br.center() + QPointF{10., 10.}, intersection));
+        EXPECT_FALSE(qan::NodeItem::intersectBoundingShape(Type::Polygon, 5., br, QPointF{0., 0.}, intersection));
+        EXPECT_EQ(intersection, (QPointF{-1., -1.}));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// qan::EdgeItem hit testing tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_EdgeItem, hitStraight)
+{
+    const QPointF p1{0., 0.}, p2{100., 100.};
+    const auto polyline = qan::EdgeItem::flattenLine(qan::EdgeStyle::LineType::Straight, p1, p2, QPointF{}, QPointF{});
+    ASSERT_EQ(polyline.size(), 2);
+    const auto br = polyline.boundingRect();
+    EXPECT_TRUE(qan::EdgeItem::polylineContains(polyline, br, QPointF{50., 50.}, 6.));
+    EXPECT_TRUE(qan::EdgeItem::polylineContains(polyline, br, QPointF{50., 54.}, 6.));    // ~2.8 from line
+    EXPECT_FALSE(qan::EdgeItem::polylineContains(polyline, br, QPointF{50., 60.}, 6.));   // ~7.1 from line
+    EXPECT_FALSE(qan::EdgeItem::polylineContains(polyline, br, QPointF{200., 200.}, 6.)); // Out of bounding rect
+    EXPECT_TRUE(qan::EdgeItem::polylineContains(polyline, br, QPointF{50., 60.}, 8.));    // Larger tolerance (zoomed out)
+}
+
+TEST(qan_EdgeItem, hitOrtho)
+{
+    const QPointF p1{0., 0.}, c1{100., 0.}, p2{100., 100.};
+    const auto polyline = qan::EdgeItem::flattenLine(qan::EdgeStyle::LineType::Ortho, p1, p2, c1, QPointF{});
+    ASSERT_EQ(polyline.size(), 3);
+    const auto br = polyline.boundingRect();
+    EXPECT_TRUE(qan::EdgeItem::polylineContains(polyline, br, QPointF{50., 3.}, 6.));     // First segment
+    EXPECT_TRUE(qan::EdgeItem::polylineContains(polyline, br, QPointF{97., 50.}, 6.));    // Second segment
+    EXPECT_FALSE(qan::EdgeItem::polylineContains(polyline, br, QPointF{50., 50.}, 6.));   // Inside corner, far from both segments
+}
+
+TEST(qan_EdgeItem, hitCurved)
+{
+    const QPointF p1{0., 0.}, c1{200., -150.}, c2{-100., 250.}, p2{300., 100.};
+    static constexpr qreal flatness = 0.5;
+    const auto polyline = qan::EdgeItem::flattenLine(qan::EdgeStyle::LineType::Curved, p1, p2, c1, c2, flatness);
+    ASSERT_GT(polyline.size(), 2);
+    const auto br = polyline.boundingRect();
+    const auto cubic = [&](qreal t) -> QPointF {
+        const qreal u = 1. - t;
+        return (u * u * u * p1) + (3. * u * u * t * c1) + (3. * u * t * t * c2) + (t * t * t * p2);
+    };
+    // Every point on the exact curve is hit, even with a tolerance smaller than sampling step
+    for (int s = 0; s <= 1000; s++)
+        EXPECT_TRUE(qan::EdgeItem::polylineContains(polyline, br, cubic(s / 1000.), 1.)) << "t=" << s / 1000.;
+    // Points offset along curve normal by more than tolerance + flatness are rejected
+    for (int s = 1; s < 100; s++) {
+        const qreal t = s / 100.;
+        const QPointF tangent = cubic(t + 0.0001) - cubic(t - 0.0001);
+        QPointF normal{-tangent.y(), tangent.x()};
+        normal /= std::sqrt(QPointF::dotProduct(normal, normal));
+        const QPointF q = cubic(t) + (normal * (6. + flatness + 0.5));
+        // Note: q might be close to another part of the curve, check against dense exact sampling first
+        bool closeToCurve = false;
+        for (int k = 0; k <= 2000 && !closeToCurve; k++) {
+            const QPointF d = q - cubic(k / 2000.);
+            closeToCurve = QPointF::dotProduct(d, d) < (6. + flatness) * (6. + flatness);
+        }
+        if (!closeToCurve)
+            EXPECT_FALSE(qan::EdgeItem::polylineContains(polyline, br, q, 6.)) << "t=" << t;
+    }
+}
+
+namespace { // ::
+
+// Count updateItem() calls (custom edge items are not packed in graph geometry store and are always updated with updateItem())
+class CountingEdgeItem : public qan::EdgeItem
+{
+public:
+    explicit CountingEdgeItem(QQuickItem* parent = nullptr) : qan::EdgeItem{parent} { }
+    virtual void    updateItem() noexcept override { ++updateCount; qan::EdgeItem::updateItem(); }
+    int             updateCount = 0;
+};
+
+} // ::
+
+TEST(qan_Graph, edgeUpdateOncePerFrame)
+{
+    QQuickWindow window;
+    window.resize(400, 400);
+    qan::test::Graph graph{window.contentItem()};
+    graph.setSize(QSizeF{400., 400.});
+    auto n1 = graph.insertNode();
+    auto n2 = graph.insertNode();
+    ASSERT_TRUE(n1 != nullptr && n1->getItem() != nullptr &&
+                n2 != nullptr && n2->getItem() != nullptr);
+    n1->getItem()->setPosition(QPointF{10., 10.});
+    n2->getItem()->setPosition(QPointF{200., 200.});
+    CountingEdgeItem edgeItem{graph.getContainerItem()};
+    edgeItem.setGraph(&graph);
+    edgeItem.setSourceItem(n1->getItem());
+    edgeItem.setDestinationItem(n2->getItem());
+    window.show();
+    ASSERT_TRUE(qan::test::waitFor([&]() { return !edgeItem.isUpdateScheduled(); }));
+
+    for (int frame = 0; frame < 3; frame++) {
+        edgeItem.updateCount = 0;
+        const qreal d = (frame + 1) * 10.;
+        n1->getItem()->setX(10. + d);                       // Modify every monitored endpoints properties in one frame
+        n1->getItem()->setY(10. + d);
+        n1->getItem()->setWidth(100. + d);
+        n1->getItem()->setHeight(50. + d);
+        n2->getItem()->setX(200. + d);
+        n2->getItem()->setY(200. + d);
+        n2->getItem()->setWidth(100. + d);
+        n2->getItem()->setHeight(50. + d);
+        n2->getItem()->setZ(n2->getItem()->z() + 1.);
+        EXPECT_EQ(edgeItem.updateCount, 0);                 // Nothing is updated before next frame
+        EXPECT_TRUE(edgeItem.isUpdateScheduled());
+        ASSERT_TRUE(qan::test::waitFor([&]() { return edgeItem.updateCount > 0; }));
+        qan::test::waitFor([]() { return false; }, 100);    // Let following frames run
+        EXPECT_EQ(edgeItem.updateCount, 1) << "frame=" << frame;
+        EXPECT_FALSE(edgeItem.isUpdateScheduled());
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	effectatlas_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// QuickQanava headers
+#include <QuickQanava>
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// qan::EffectAtlas tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_EffectAtlas, makeKey)
+{
+    const auto key = qan::EffectAtlas::makeKey(4.4, -2., 3.6, QColor{0, 0, 0, 127});
+    EXPECT_EQ(key.radius, 4);
+    EXPECT_EQ(key.blur, 0);                                 // Negative blur is clamped
+    EXPECT_EQ(key.offset, 4);
+    EXPECT_TRUE(key == qan::EffectAtlas::makeKey(4., 0., 4., QColor{0, 0, 0, 127}));
+    EXPECT_FALSE(key == qan::EffectAtlas::makeKey(4., 0., 4., QColor{0, 0, 0, 128}));
+}
+
+TEST(qan_EffectAtlas, generateShadowNinePatch)
+{
+    const auto key = qan::EffectAtlas::makeKey(4., 3., 3., QColor{0, 0, 0, 255});
+    const auto corner = qan::EffectAtlas::cornerSize(key);
+    const auto image = qan::EffectAtlas::generateNinePatch(key);
+    ASSERT_EQ(image.width(), (2 * corner) + 1);
+    ASSERT_EQ(image.height(), (2 * corner) + 1);
+    EXPECT_EQ(qAlpha(image.pixel(0, 0)), 0);                // Outside blur extent
+    EXPECT_EQ(qAlpha(image.pixel(corner, corner)), 0);      // Node shape is knocked out
+    const auto last = image.width() - 1;
+    EXPECT_GT(qAlpha(image.pixel(corner, last - 4)), 128);  // Shadow is offset to bottom right
+    EXPECT_GT(qAlpha(image.pixel(last - 4, corner)), 128);
+    EXPECT_EQ(qAlpha(image.pixel(corner, 2)), 0);
+    for (int x = corner - 3; x <= corner + 3; x++)          // Stretched border is uniform
+        EXPECT_NEAR(qAlpha(image.pixel(x, last - 4)), qAlpha(image.pixel(corner, last - 4)), 1);
+}
+
+TEST(qan_EffectAtlas, generateGlowNinePatch)
+{
+    const auto key = qan::EffectAtlas::makeKey(4., 6., 0., QColor{255, 0, 0, 255});
+    const auto image = qan::EffectAtlas::generateNinePatch(key);
+    const auto corner = qan::EffectAtlas::cornerSize(key);
+    const auto last = image.width() - 1;
+    EXPECT_EQ(qAlpha(image.pixel(corner, corner)), 0);      // Node shape is knocked out
+    // Glow is symmetric
+    EXPECT_NEAR(qAlpha(image.pixel(corner, 5)), qAlpha(image.pixel(corner, last - 5)), 1);
+    EXPECT_NEAR(qAlpha(image.pixel(5, corner)), qAlpha(image.pixel(last - 5, corner)), 1);
+    EXPECT_GT(qAlpha(image.pixel(corner, 5)), 0);
+    EXPECT_EQ(qRed(image.pixel(corner, 5)), qAlpha(image.pixel(corner, 5)));   // Premultiplied red
+}
@@ -0,0 +1,163 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	forcedirected_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <cmath>
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./generators.h"
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// qan::ForceDirectedLayout tests
+//-----------------------------------------------------------------------------
+
+namespace { // ::
+
+qreal   centerDistance(const std::vector<QPointF>& positions, const qan::ForceDirectedLayout::Input& input,
+                       std::size_t a, std::size_t b)
+{
+    const auto ca = QRectF{positions[a], input.sizes[a]}.center();
+    const auto cb = QRectF{positions[b], input.sizes[b]}.center();
+    return std::hypot(ca.x() - cb.x(), ca.y() - cb.y());
+}
+
+} // ::
+
+TEST(qan_ForceDirectedLayout, empty)
+{
+    qan::ForceDirectedLayout layout;
+    EXPECT_TRUE(layout.computeLayout(qan::ForceDirectedLayout::Input{}).empty());
+    EXPECT_EQ(layout.getIterationCount(), 0);
+}
+
+TEST(qan_ForceDirectedLayout, ring)
+{
+    qan::ForceDirectedLayout::Input input;
+    for (std::size_t n = 0; n < 20; ++n) {
+        input.positions.emplace_back((n * 37) % 200, (n * 53) % 200);
+        input.sizes.emplace_back(50., 30.);
+        input.edges.emplace_back(n, (n + 1) % 20);
+    }
+    qan::ForceDirectedLayout layout;
+    const auto positions = layout.computeLayout(input);
+    ASSERT_EQ(positions.size(), input.positions.size());
+    qreal minLength = std::numeric_limits<qreal>::max();
+    qreal maxLength = 0.;
+    for (const auto& [src, dst] : input.edges) {
+        const auto length = centerDistance(positions, input, src, dst);
+        minLength = std::min(minLength, length);
+        maxLength = std::max(maxLength, length);
+    }
+    EXPECT_GT(minLength, layout.getSpringLength() / 2.);
+    EXPECT_LT(maxLength, minLength * 1.5);      // Ring is laid out as a regular polygon
+}
+
+TEST(qan_ForceDirectedLayout, constraints)
+{
+    auto input = qan::test::randomForceDirectedTree(200);
+    input.pinned.assign(input.positions.size(), false);
+    input.pinned[0] = true;
+    input.containers.push_back(QRectF{0., 0., 200., 200.});
+    input.containerIndexes.assign(input.positions.size(), qan::ForceDirectedLayout::noContainer);
+    input.containerIndexes[1] = 0;
+    input.containerIndexes[2] = 0;
+
+    qan::ForceDirectedLayout layout;
+    const auto positions = layout.computeLayout(input);
+    ASSERT_EQ(positions.size(), input.positions.size());
+    EXPECT_EQ(positions[0], input.positions[0]);
+    for (const std::size_t n : {1, 2})
+        EXPECT_TRUE(input.containers[0].contains(QRectF{positions[n], input.sizes[n]}));
+}
+
+TEST(qan_ForceDirectedLayout, convergence)
+{
+    auto input = qan::test::randomForceDirectedTree(100);
+    qan::ForceDirectedLayout layout;
+    layout.setIterations(50);
+    layout.computeLayout(input);
+    EXPECT_EQ(layout.getIterationCount(), 50);
+
+    layout.setConvergenceThreshold(1000.);   // Any iteration is below threshold
+    layout.computeLayout(input);
+    EXPECT_TRUE(layout.getConverged());
+    EXPECT_EQ(layout.getIterationCount(), 1);
+}
+
+TEST(qan_ForceDirectedLayout, threadCountIndependent)
+{
+    const auto input = qan::test::randomForceDirectedTree(3000);
+    qan::ForceDirectedLayout layout;
+    layout.setIterations(20);
+    layout.setThreadCount(1);
+    const auto positions = layout.computeLayout(input);
+    layout.setThreadCount(4);
+    EXPECT_EQ(layout.computeLayout(input), positions);
+}
+
+TEST(qan_ForceDirectedLayout, layoutGraph)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    graph.setContainerItem(&container);
+    std::vector<qan::Node*> nodes;
+    for (int n = 0; n < 10; ++n) {
+        auto node = graph.insertNode();
+        ASSERT_TRUE(node != nullptr);
+        auto item = node->getItem();
+        if (item == nullptr) {
+            item = new qan::NodeItem(&container);
+            item->setGraph(&graph);
+            node->setItem(item);
+        }
+        item->setSize(QSizeF{50., 30.});
+        item->setPosition(QPointF{n * 5., n * 3.});
+        if (n > 0)
+            graph.insertEdge(nodes.back(), node);
+        nodes.push_back(node);
+    }
+    nodes[0]->setLocked(true);
+
+    qan::ForceDirectedLayout layout;
+    layout.layout(graph);
+    EXPECT_EQ(nodes[0]->getItem()->position(), QPointF(0., 0.));    // Locked nodes are pinned
+    const auto c1 = nodes[1]->getItem()->position();
+    const auto c2 = nodes[2]->getItem()->position();
+    EXPECT_GT(std::hypot(c1.x() - c2.x(), c1.y() - c2.y()), 50.);
+}
@@ -0,0 +1,135 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	generators.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Std headers
+#include <algorithm>
+#include <vector>
+#include <random>
+#include <utility>
+
+// Qt headers
+#include <QRectF>
+
+// QuickQanava headers
+#include <QuickQanava>
+
+namespace qan { // ::qan
+namespace test { // ::qan::test
+
+//! Generate \c count random edge source and destination node rects in a 10000x10000 rect, shared by unit tests and benchmarks.
+inline std::vector<std::pair<QRectF, QRectF>>   randomEdgeEndpoints(std::size_t count)
+{
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<qreal> position{-5000., 5000.};
+    std::uniform_real_distribution<qreal> size{20., 200.};
+    std::vector<std::pair<QRectF, QRectF>> endpoints;
+    endpoints.reserve(count);
+    for (std::size_t e = 0; e < count; e++)
+        endpoints.push_back({QRectF{position(generator), position(generator), size(generator), size(generator)},
+                             QRectF{position(generator), position(generator), size(generator), size(generator)}});
+    return endpoints;
+}
+
+//! Insert \c nodeCount selected nodes on a grid, node items are created manually in \c container when no QML engine is available.
+inline std::vector<qan::Node*>  insertSelectedNodes(qan::Graph& graph, QQuickItem& container, std::size_t nodeCount)
+{
+    std::vector<qan::Node*> nodes;
+    nodes.reserve(nodeCount);
+    for (std::size_t n = 0; n < nodeCount; ++n) {
+        auto node = graph.insertNode();
+        if (node == nullptr)
+            continue;
+        auto item = node->getItem();
+        if (item == nullptr) {
+            item = new qan::NodeItem(&container);
+            item->setGraph(&graph);
+            node->setItem(item);
+        }
+        item->setSize(QSizeF{50., 30.});
+        item->setPosition(QPointF{static_cast<qreal>(n % 100) * 60., static_cast<qreal>(n / 100) * 40.});
+        graph.setNodeSelected(*node, true);
+        nodes.push_back(node);
+    }
+    return nodes;
+}
+
+//! Generate a layered pipeline like DAG with \c nodeCount nodes, 50 nodes per rank and edges spanning 1 to 3 ranks.
+inline void     randomDag(std::size_t nodeCount, std::vector<QSizeF>& sizes, qan::SugiyamaLayout::Edges& edges)
+{
+    std::mt19937 generator{42};
+    sizes.clear();
+    edges.clear();
+    for (std::size_t n = 0; n < nodeCount; ++n)
+        sizes.emplace_back(40. + generator() % 40, 20. + generator() % 20);
+    for (std::size_t n = 50; n < nodeCount; ++n) {
+        const auto rank = n / 50;
+        for (int e = 0; e < 2; ++e) {
+            const auto srcRank = rank - 1 - std::min<std::size_t>(rank - 1, generator() % 3);
+            edges.emplace_back(srcRank * 50 + generator() % 50, n);
+        }
+    }
+}
+
+//! Generate a random tree with \c nodeCount nodes randomly positioned in a 1000x1000 rect.
+inline qan::ForceDirectedLayout::Input  randomForceDirectedTree(std::size_t nodeCount)
+{
+    qan::ForceDirectedLayout::Input input;
+    std::mt19937 generator{42};
+    for (std::size_t n = 0; n < nodeCount; ++n) {
+        input.positions.emplace_back(generator() % 1000, generator() % 1000);
+        input.sizes.emplace_back(50., 30.);
+        if (n > 0)
+            input.edges.emplace_back(generator() % n, n);
+    }
+    return input;
+}
+
+//! Generate a random tree with \c nodeCount nodes, node n parent is taken in [n - window, n - 1].
+inline void     randomOrgTree(std::size_t nodeCount, std::size_t window,
+                              std::vector<QSizeF>& sizes, qan::OrgTreeLayout::Children& children)
+{
+    std::mt19937 generator{42};
+    sizes.clear();
+    children.assign(nodeCount, {});
+    for (std::size_t n = 0; n < nodeCount; ++n) {
+        sizes.emplace_back(20. + generator() % 80, 10. + generator() % 50);
+        if (n > 0)
+            children[n - 1 - (generator() % std::min(n, window))].push_back(n);
+    }
+}
+
+} // ::qan::test
+} // ::qan
@@ -0,0 +1,258 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	layoutrunner_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./tests.h"
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// qan::LayoutRunner tests
+//-----------------------------------------------------------------------------
+
+namespace { // ::
+
+using qan::test::waitFor;
+
+// Insert a root with children child nodes of size 50x20 at (100, 200).
+std::vector<qan::Node*> makeStar(qan::Graph& graph, QQuickItem& container, int children)
+{
+    graph.setContainerItem(&container);
+    std::vector<qan::Node*> nodes;
+    for (int n = 0; n <= children; ++n) {
+        auto node = graph.insertNode();
+        auto item = node->getItem();
+        if (item == nullptr) {
+            item = new qan::NodeItem(&container);
+            item->setGraph(&graph);
+            node->setItem(item);
+        }
+        item->setSize(QSizeF{50., 20.});
+        item->setPosition(QPointF{100., 200.});
+        nodes.push_back(node);
+        if (n > 0)
+            graph.insertEdge(nodes[0], node);
+    }
+    return nodes;
+}
+
+} // ::
+
+TEST(qan_LayoutRunner, runOrgTree)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    const auto nodes = makeStar(graph, container, 3);
+    qan::LayoutRunner runner;
+    runner.setGraph(&graph);
+    int finished = 0;
+    QObject::connect(&runner, &qan::LayoutRunner::finished, [&finished]() { ++finished; });
+
+    qan::OrgTreeLayout layout;
+    ASSERT_TRUE(runner.runOrgTree(&layout, nodes[0]));
+    EXPECT_TRUE(runner.getRunning());
+    ASSERT_TRUE(waitFor([&]() { return finished == 1; }));
+    EXPECT_FALSE(runner.getRunning());
+    EXPECT_DOUBLE_EQ(runner.getProgress(), 1.);
+    // Same result than synchronous layout
+    EXPECT_EQ(nodes[0]->getItem()->position(), QPointF(100., 200.));
+    EXPECT_EQ(nodes[1]->getItem()->position(), QPointF(175., 155.));
+    EXPECT_EQ(nodes[2]->getItem()->position(), QPointF(175., 200.));
+    EXPECT_EQ(nodes[3]->getItem()->position(), QPointF(175., 245.));
+}
+
+TEST(qan_LayoutRunner, runSugiyama)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    const auto nodes = makeStar(graph, container, 2);
+    qan::LayoutRunner runner;
+    runner.setGraph(&graph);
+    int finished = 0;
+    QObject::connect(&runner, &qan::LayoutRunner::finished, [&finished]() { ++finished; });
+
+    qan::SugiyamaLayout layout;
+    ASSERT_TRUE(runner.runSugiyama(&layout));
+    ASSERT_TRUE(waitFor([&]() { return finished == 1; }));
+    EXPECT_DOUBLE_EQ(nodes[0]->getItem()->y(), 200.);
+    EXPECT_DOUBLE_EQ(nodes[1]->getItem()->y(), 270.);
+    EXPECT_DOUBLE_EQ(nodes[2]->getItem()->y(), 270.);
+    EXPECT_NE(nodes[1]->getItem()->x(), nodes[2]->getItem()->x());
+}
+
+TEST(qan_LayoutRunner, progressAndCancel)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    const auto nodes = makeStar(graph, container, 2);
+    qan::LayoutRunner runner;
+    runner.setGraph(&graph);
+    int cancelled = 0;
+    int finished = 0;
+    QObject::connect(&runner, &qan::LayoutRunner::cancelled, [&cancelled]() { ++cancelled; });
+    QObject::connect(&runner, &qan::LayoutRunner::finished, [&finished]() { ++finished; });
+
+    // Algorithm never finish until cancelled
+    const auto algorithm = [](const qan::LayoutRunner::Snapshot& snapshot, const qan::LayoutRunner::Progress& progress) {
+        while (progress(0.5))
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        return std::vector<QPointF>(snapshot.positions.size(), QPointF{0., 0.});
+    };
+    ASSERT_TRUE(runner.run(algorithm));
+    ASSERT_TRUE(waitFor([&]() { return runner.getProgress() == 0.5; }));
+    runner.cancel();
+    EXPECT_FALSE(runner.getRunning());
+    EXPECT_EQ(cancelled, 1);
+    QCoreApplication::processEvents();      // Late result must be ignored
+    EXPECT_EQ(finished, 0);
+    for (const auto node : nodes)
+        EXPECT_EQ(node->getItem()->position(), QPointF(100., 200.));
+
+    // Starting a new run cancel the current one
+    ASSERT_TRUE(runner.run(algorithm));
+    ASSERT_TRUE(runner.run(algorithm));
+    EXPECT_EQ(cancelled, 2);
+    runner.cancel();
+}
+
+TEST(qan_LayoutRunner, cancelDoNotWaitWorker)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    const auto nodes = makeStar(graph, container, 2);
+    auto release = std::make_shared<std::atomic<bool>>(false);
+    auto done = std::make_shared<std::atomic<bool>>(false);
+    {
+        qan::LayoutRunner runner;
+        runner.setGraph(&graph);
+        int finished = 0;
+        QObject::connect(&runner, &qan::LayoutRunner::finished, [&finished]() { ++finished; });
+
+        // Algorithm never check progress, cancel() must release its worker without waiting it
+        const auto algorithm = [release, done](const qan::LayoutRunner::Snapshot& snapshot, const qan::LayoutRunner::Progress&) {
+            while (!*release)
+                std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            std::this_thread::sleep_for(std::chrono::milliseconds{50});
+            *done = true;
+            return std::vector<QPointF>(snapshot.positions.size(), QPointF{0., 0.});
+        };
+        ASSERT_TRUE(runner.run(algorithm));
+        const auto start = std::chrono::steady_clock::now();
+        runner.cancel();
+        EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds{500});
+        EXPECT_FALSE(runner.getRunning());
+
+        *release = true;
+        QCoreApplication::processEvents();
+        EXPECT_EQ(finished, 0);
+    }   // Runner destruction wait for its cancelled worker
+    EXPECT_TRUE(done->load());
+    for (const auto node : nodes)   // Released worker result is never applied
+        EXPECT_EQ(node->getItem()->position(), QPointF(100., 200.));
+}
+
+TEST(qan_LayoutRunner, cancelledWorkersJoined)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    makeStar(graph, container, 2);
+
+    // Cooperative algorithm stop on cancel, worker thread own a copy of algorithm (and its token) until it is joined
+    auto token = std::make_shared<int>(0);
+    const auto algorithm = [token](const qan::LayoutRunner::Snapshot& snapshot, const qan::LayoutRunner::Progress& progress) {
+        while (progress(0.5))
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        return std::vector<QPointF>(snapshot.positions.size(), QPointF{0., 0.});
+    };
+    {
+        qan::LayoutRunner runner;
+        runner.setGraph(&graph);
+        for (int r = 0; r < 10; ++r)        // Each run cancel the previous one
+            ASSERT_TRUE(runner.run(algorithm));
+        runner.cancel();
+        EXPECT_FALSE(runner.getRunning());
+    }
+    EXPECT_EQ(token.use_count(), 2);    // Note: Only local token and algorithm copies remain, no worker outlive runner
+}
+
+TEST(qan_LayoutRunner, staleResultDiscarded)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    const auto nodes = makeStar(graph, container, 2);
+    qan::LayoutRunner runner;
+    runner.setGraph(&graph);
+    int discarded = 0;
+    int finished = 0;
+    QObject::connect(&runner, &qan::LayoutRunner::discarded, [&discarded]() { ++discarded; });
+    QObject::connect(&runner, &qan::LayoutRunner::finished, [&finished]() { ++finished; });
+
+    std::atomic<bool> release{false};
+    const auto algorithm = [&release](const qan::LayoutRunner::Snapshot& snapshot, const qan::LayoutRunner::Progress&) {
+        while (!release)
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        return std::vector<QPointF>(snapshot.positions.size(), QPointF{0., 0.});
+    };
+
+    // Topology modified during run
+    ASSERT_TRUE(runner.run(algorithm));
+    graph.insertEdge(nodes[1], nodes[2]);
+    release = true;
+    ASSERT_TRUE(waitFor([&]() { return discarded == 1; }));
+    EXPECT_EQ(finished, 0);
+    EXPECT_EQ(nodes[1]->getItem()->position(), QPointF(100., 200.));
+
+    // Node resized during run
+    release = false;
+    ASSERT_TRUE(runner.run(algorithm));
+    nodes[2]->getItem()->setSize(QSizeF{60., 20.});
+    release = true;
+    ASSERT_TRUE(waitFor([&]() { return discarded == 2; }));
+    EXPECT_EQ(nodes[2]->getItem()->position(), QPointF(100., 200.));
+
+    // Unmodified graph
+    release = true;
+    ASSERT_TRUE(runner.run(algorithm));
+    ASSERT_TRUE(waitFor([&]() { return finished == 1; }));
+    EXPECT_EQ(nodes[2]->getItem()->position(), QPointF(0., 0.));
+}
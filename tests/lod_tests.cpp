@@ -0,0 +1,94 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	lod_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./tests.h"
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+using Lod = qan::NodeItem::Lod;
+
+//-----------------------------------------------------------------------------
+// qan::Graph level of detail tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_Graph, lodForZoomThresholds)
+{
+    // Simplified under 0.5, minimal under 0.2, no hysteresis
+    EXPECT_EQ(qan::Graph::lodForZoom(Lod::Full, 1.0, 0.5, 0.2, 0.), Lod::Full);
+    EXPECT_EQ(qan::Graph::lodForZoom(Lod::Full, 0.5, 0.5, 0.2, 0.), Lod::Full);
+    EXPECT_EQ(qan::Graph::lodForZoom(Lod::Full, 0.49, 0.5, 0.2, 0.), Lod::Simplified);
+    EXPECT_EQ(qan::Graph::lodForZoom(Lod::Full, 0.19, 0.5, 0.2, 0.), Lod::Minimal);
+    EXPECT_EQ(qan::Graph::lodForZoom(Lod::Minimal, 0.6, 0.5, 0.2, 0.), Lod::Full);
+}
+
+TEST(qan_Graph, lodForZoomHysteresis)
+{
+    // Coarser level is entered at threshold, finer level restored at threshold * 1.2
+    EXPECT_EQ(qan::Graph::lodForZoom(Lod::Full, 0.49, 0.5, 0.2, 0.2), Lod::Simplified);
+    EXPECT_EQ(qan::Graph::lodForZoom(Lod::Simplified, 0.55, 0.5, 0.2, 0.2), Lod::Simplified);
+    EXPECT_EQ(qan::Graph::lodForZoom(Lod::Simplified, 0.61, 0.5, 0.2, 0.2), Lod::Full);
+    EXPECT_EQ(qan::Graph::lodForZoom(Lod::Simplified, 0.19, 0.5, 0.2, 0.2), Lod::Minimal);
+    EXPECT_EQ(qan::Graph::lodForZoom(Lod::Minimal, 0.22, 0.5, 0.2, 0.2), Lod::Minimal);
+    EXPECT_EQ(qan::Graph::lodForZoom(Lod::Minimal, 0.25, 0.5, 0.2, 0.2), Lod::Simplified);
+    EXPECT_EQ(qan::Graph::lodForZoom(Lod::Minimal, 0.55, 0.5, 0.2, 0.2), Lod::Simplified);
+}
+
+TEST(qan_Graph, lodPropagation)
+{
+    qan::test::Graph graph;
+    graph.setLodZoom(0.1);
+    EXPECT_EQ(graph.getLod(), Lod::Full);                   // Level of detail disabled
+    graph.setLevelOfDetail(true);
+    EXPECT_EQ(graph.getLod(), Lod::Minimal);
+    ASSERT_TRUE(graph.getEdgeBatchRenderer() != nullptr);   // Minimal lod is batch rendered
+    EXPECT_TRUE(graph.getEdgeBatchRenderer()->getMinimal());
+    graph.setLodZoom(1.);
+    EXPECT_EQ(graph.getLod(), Lod::Full);
+    EXPECT_FALSE(graph.getEdgeBatchRenderer()->getMinimal());
+    EXPECT_FALSE(graph.getEdgeBatchRenderer()->isVisible());
+
+    auto n1 = graph.insertNode();
+    ASSERT_TRUE(n1 != nullptr);
+    ASSERT_TRUE(n1->getItem() != nullptr);
+    graph.setLodZoom(0.3);
+    EXPECT_EQ(n1->getItem()->getLod(), Lod::Simplified);
+    auto n2 = graph.insertNode();                           // Inserted items get current lod
+    ASSERT_TRUE(n2 != nullptr && n2->getItem() != nullptr);
+    EXPECT_EQ(n2->getItem()->getLod(), Lod::Simplified);
+}
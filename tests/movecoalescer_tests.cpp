@@ -0,0 +1,169 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	movecoalescer_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <vector>
+
+// Qt headers
+#include <QQuickWindow>
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./tests.h"
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// qan::MoveCoalescer tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_MoveCoalescer, immediateWithoutWindow)
+{
+    std::vector<QPointF> applied;
+    qan::MoveCoalescer coalescer{[&applied](const QPointF& p) { applied.push_back(p); }};
+    coalescer.move(QPointF{1., 1.}, nullptr);
+    coalescer.move(QPointF{2., 2.}, nullptr);
+    EXPECT_FALSE(coalescer.isPending());
+    ASSERT_EQ(applied.size(), 2u);
+    EXPECT_EQ(applied.back(), QPointF(2., 2.));
+    EXPECT_FALSE(coalescer.flush());                        // Nothing pending
+}
+
+TEST(qan_MoveCoalescer, coalesce1000Hz)
+{
+    // Simulate a 1000Hz pointer device during one second with a 60Hz frame rate
+    QQuickWindow window;
+    std::vector<QPointF> applied;
+    qan::MoveCoalescer coalescer{[&applied](const QPointF& p) { applied.push_back(p); }};
+    static constexpr int eventCount = 1000;
+    static constexpr double frameInterval = 1000. / 60.;
+    double nextFrame = frameInterval;
+    const auto eventPos = [](int ms) { return QPointF{ms * 0.5, ms * 0.25}; };
+    for (int ms = 0; ms < eventCount; ++ms) {
+        coalescer.move(eventPos(ms), &window);
+        if (ms >= nextFrame) {                              // Simulate QQuickWindow::afterAnimating()
+            coalescer.frame();
+            nextFrame += frameInterval;
+        }
+    }
+    coalescer.flush();                                      // Release apply last pending move
+    EXPECT_EQ(coalescer.getMoves(), static_cast<std::size_t>(eventCount));
+    EXPECT_EQ(coalescer.getApplied(), applied.size());
+    EXPECT_LE(applied.size(), 61u);                         // At most one move per frame, plus release
+    EXPECT_GE(applied.size(), 59u);
+    ASSERT_FALSE(applied.empty());
+    EXPECT_EQ(applied.back(), eventPos(eventCount - 1));    // Final position is exact
+    EXPECT_FALSE(coalescer.isPending());
+}
+
+TEST(qan_MoveCoalescer, cancel)
+{
+    QQuickWindow window;
+    int applied = 0;
+    qan::MoveCoalescer coalescer{[&applied](const QPointF&) { ++applied; }};
+    coalescer.move(QPointF{1., 1.}, &window);
+    EXPECT_TRUE(coalescer.isPending());
+    coalescer.cancel();
+    coalescer.frame();
+    EXPECT_EQ(applied, 0);
+}
+
+TEST(qan_MoveCoalescer, edgeUpdatedInSameFrame)
+{
+    // Coalesced moves are applied in window polish pass: edges connected to a moved node must
+    // be updated in the same frame, not one frame later
+    QQuickWindow window;
+    window.resize(400, 400);
+    qan::test::Graph graph{window.contentItem()};
+    graph.setSize(QSizeF{400., 400.});
+    auto n1 = graph.insertNode();
+    auto n2 = graph.insertNode();
+    ASSERT_TRUE(n1 != nullptr && n1->getItem() != nullptr &&
+                n2 != nullptr && n2->getItem() != nullptr);
+    n1->getItem()->setPosition(QPointF{10., 10.});
+    n2->getItem()->setPosition(QPointF{200., 200.});
+    auto edge = graph.insertEdge(n1, n2);
+    ASSERT_TRUE(edge != nullptr && edge->getItem() != nullptr);
+    const auto edgeItem = edge->getItem();
+    window.show();
+    ASSERT_TRUE(qan::test::waitFor([&]() { return !edgeItem->isUpdateScheduled(); }));
+
+    qan::MoveCoalescer coalescer{[&n1](const QPointF& p) { n1->getItem()->setPosition(p); }};
+    struct Frame {
+        QPointF nodePos;
+        QPointF edgePos;
+        QPointF p1;
+        QPointF p2;
+        bool    edgeUpdateScheduled = false;
+    };
+    std::vector<Frame> frames;      // State when frame is synchronized with render thread
+    QObject::connect(&window, &QQuickWindow::beforeSynchronizing, &graph, [&]() {
+        frames.push_back(Frame{n1->getItem()->position(), edgeItem->position(),
+                               edgeItem->getP1(), edgeItem->getP2(), edgeItem->isUpdateScheduled()});
+    }, Qt::DirectConnection);
+
+    for (int move = 1; move <= 5; ++move) {
+        const QPointF target{10. + move * 20., 10. + move * 5.};
+        frames.clear();
+        coalescer.move(target + QPointF{-1., -1.}, &window);
+        coalescer.move(target, &window);
+        ASSERT_TRUE(qan::test::waitFor([&]() { return !frames.empty() && frames.back().nodePos == target; }))
+                << "move=" << move;
+        const auto frame = std::find_if(frames.cbegin(), frames.cend(),
+                                        [&target](const auto& f) { return f.nodePos == target; });
+        EXPECT_FALSE(frame->edgeUpdateScheduled) << "move=" << move;
+        edgeItem->updateItem();     // Reference geometry for actual node positions
+        EXPECT_EQ(frame->edgePos, edgeItem->position()) << "move=" << move;
+        EXPECT_EQ(frame->p1, edgeItem->getP1()) << "move=" << move;
+        EXPECT_EQ(frame->p2, edgeItem->getP2()) << "move=" << move;
+    }
+    EXPECT_EQ(coalescer.getApplied(), 5u);
+}
+
+TEST(qan_MoveCoalescer, configuration)
+{
+    qan::Graph graph;
+    EXPECT_TRUE(graph.getCoalesceMoves());
+    EXPECT_TRUE(graph.setCoalesceMoves(false));
+    EXPECT_FALSE(graph.setCoalesceMoves(false));
+    EXPECT_FALSE(graph.getCoalesceMoves());
+
+    qan::BottomRightResizer resizer;
+    EXPECT_TRUE(resizer.getCoalesceMoves());
+    resizer.setCoalesceMoves(false);
+    EXPECT_FALSE(resizer.getCoalesceMoves());
+}
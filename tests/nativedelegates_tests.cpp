@@ -0,0 +1,96 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	nativedelegates_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./tests.h"
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// qan::NativeNodeItem tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_NativeNodeItem, appendBackground)
+{
+    std::vector<QSGGeometry::ColoredPoint2D> vertices;
+    const QRectF rect{0., 0., 100., 50.};
+    // 10px radius: 5 segments per corner, 24 points outline
+    qan::NativeNodeItem::appendBackground(vertices, rect, 10., 0., Qt::white, Qt::white, Qt::black);
+    EXPECT_EQ(vertices.size(), 24u * 3);                    // Fill triangle fan only
+    vertices.clear();
+    qan::NativeNodeItem::appendBackground(vertices, rect, 10., 2., Qt::white, Qt::white, Qt::black);
+    EXPECT_EQ(vertices.size(), 24u * 3 + 24u * 6);          // Fill and border quads
+    for (const auto& v : vertices) {                        // Geometry stay inside rect
+        EXPECT_GE(v.x, 0.f);    EXPECT_LE(v.x, 100.f);
+        EXPECT_GE(v.y, 0.f);    EXPECT_LE(v.y, 50.f);
+    }
+    vertices.clear();
+    qan::NativeNodeItem::appendBackground(vertices, QRectF{}, 10., 2., Qt::white, Qt::white, Qt::black);
+    EXPECT_TRUE(vertices.empty());                          // Invalid rect
+}
+
+TEST(qan_NativeNodeItem, appendBackgroundGradient)
+{
+    std::vector<QSGGeometry::ColoredPoint2D> vertices;
+    qan::NativeNodeItem::appendBackground(vertices, QRectF{0., 0., 100., 50.}, 0., 0.,
+                                          QColor{255, 0, 0}, QColor{0, 0, 255}, Qt::black);
+    ASSERT_FALSE(vertices.empty());
+    for (const auto& v : vertices) {                        // Vertical gradient from red to blue
+        if (qFuzzyIsNull(v.y)) {
+            EXPECT_EQ(v.r, 255);    EXPECT_EQ(v.b, 0);
+        } else if (qFuzzyCompare(v.y, 50.f)) {
+            EXPECT_EQ(v.r, 0);      EXPECT_EQ(v.b, 255);
+        }
+    }
+}
+
+TEST(qan_Graph, nativeDelegates)
+{
+    qan::test::Graph graph;
+    EXPECT_FALSE(graph.getNativeDelegates());
+    graph.setNativeDelegates(true);
+    auto n1 = graph.insertNode();
+    auto n2 = graph.insertNode();
+    ASSERT_TRUE(n1 != nullptr && n2 != nullptr);
+    ASSERT_TRUE(n1->getItem() != nullptr);
+    EXPECT_TRUE(qobject_cast<qan::NativeNodeItem*>(n1->getItem()) != nullptr);
+    auto e = graph.insertEdge(n1, n2);
+    ASSERT_TRUE(e != nullptr);
+    EXPECT_TRUE(qobject_cast<qan::NativeEdgeItem*>(e->getItem()) != nullptr);
+    EXPECT_EQ(e->getItem()->getSourceItem(), n1->getItem());
+}
@@ -0,0 +1,420 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	orgtreelayout_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <random>
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./generators.h"
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// qan::OrgTreeLayout tests
+//-----------------------------------------------------------------------------
+
+namespace { // ::
+
+// Return true if any two node rects intersect.
+bool    hasOverlap(const std::vector<QPointF>& positions, const std::vector<QSizeF>& sizes)
+{
+    std::vector<QRectF> rects;
+    for (std::size_t n = 0; n < positions.size(); ++n)
+        rects.emplace_back(positions[n], sizes[n]);
+    std::sort(rects.begin(), rects.end(), [](const auto& a, const auto& b) { return a.left() < b.left(); });
+    for (std::size_t r = 0; r < rects.size(); ++r)
+        for (std::size_t s = r + 1; s < rects.size() && rects[s].left() < rects[r].right(); ++s)
+            if (rects[r].intersects(rects[s]))
+                return true;
+    return false;
+}
+
+// Insert a node with an item of size 50x20.
+qan::Node*  insertNode(qan::Graph& graph, QQuickItem& container, QSizeF size = QSizeF{50., 20.})
+{
+    auto node = graph.insertNode();
+    auto item = node->getItem();
+    if (item == nullptr) {
+        item = new qan::NodeItem(&container);
+        item->setGraph(&graph);
+        node->setItem(item);
+    }
+    item->setSize(size);
+    return node;
+}
+
+// Return nodes items positions.
+std::vector<QPointF>    positionsOf(const std::vector<qan::Node*>& nodes)
+{
+    std::vector<QPointF> positions;
+    for (const auto node : nodes)
+        positions.push_back(node->getItem()->position());
+    return positions;
+}
+
+// Build r -> {a, b, c}, a -> a1, c -> c1 laid out with root at (0, 0).
+std::vector<qan::Node*> makeTree(qan::Graph& graph, QQuickItem& container, qan::OrgTreeLayout& layout)
+{
+    graph.setContainerItem(&container);
+    std::vector<qan::Node*> nodes;
+    for (int n = 0; n < 6; ++n)
+        nodes.push_back(insertNode(graph, container));
+    graph.insertEdge(nodes[0], nodes[1]);
+    graph.insertEdge(nodes[0], nodes[2]);
+    graph.insertEdge(nodes[0], nodes[3]);
+    graph.insertEdge(nodes[1], nodes[4]);
+    graph.insertEdge(nodes[3], nodes[5]);
+    nodes[0]->getItem()->setPosition(QPointF{0., 0.});
+    layout.layout(nodes[0], 25., 25.);
+    return nodes;
+}
+
+} // ::
+
+TEST(qan_OrgTreeLayout, empty)
+{
+    qan::OrgTreeLayout layout;
+    EXPECT_TRUE(layout.computeLayout({}, {}).empty());
+    layout.setLayoutOrientation(qan::OrgTreeLayout::LayoutOrientation::Undefined);
+    const auto positions = layout.computeLayout({{1}, {}}, {QSizeF{10., 10.}, QSizeF{10., 10.}});
+    ASSERT_EQ(positions.size(), 2);
+    EXPECT_EQ(positions[1], QPointF(0., 0.));
+}
+
+TEST(qan_OrgTreeLayout, orientations)
+{
+    // Root with 3 leaf children
+    const qan::OrgTreeLayout::Children children{{1, 2, 3}, {}, {}, {}};
+    const std::vector<QSizeF> sizes(4, QSizeF{50., 20.});
+    qan::OrgTreeLayout layout;
+
+    layout.setLayoutOrientation(qan::OrgTreeLayout::LayoutOrientation::Vertical);
+    auto positions = layout.computeLayout(children, sizes, 25., 25.);
+    EXPECT_EQ(positions[0], QPointF(0., 0.));
+    EXPECT_EQ(positions[1], QPointF(75., -45.));    // Parent is centered on its children
+    EXPECT_EQ(positions[2], QPointF(75., 0.));
+    EXPECT_EQ(positions[3], QPointF(75., 45.));
+
+    layout.setLayoutOrientation(qan::OrgTreeLayout::LayoutOrientation::Horizontal);
+    positions = layout.computeLayout(children, sizes, 25., 25.);
+    EXPECT_EQ(positions[1], QPointF(-75., 45.));
+    EXPECT_EQ(positions[2], QPointF(0., 45.));
+    EXPECT_EQ(positions[3], QPointF(75., 45.));
+
+    // Mixed: leaf siblings are laid out in a row
+    layout.setLayoutOrientation(qan::OrgTreeLayout::LayoutOrientation::Mixed);
+    positions = layout.computeLayout(children, sizes, 25., 25.);
+    EXPECT_EQ(positions[1], QPointF(75., 0.));
+    EXPECT_EQ(positions[2], QPointF(150., 0.));
+    EXPECT_EQ(positions[3], QPointF(225., 0.));
+}
+
+TEST(qan_OrgTreeLayout, indentedOrientations)
+{
+    // r -> {a, b, c}, a -> a1, c -> c1: indented orientations match QuickQanava 2.5.0 Vertical, Horizontal and Mixed layouts
+    const qan::OrgTreeLayout::Children children{{1, 2, 3}, {4}, {}, {5}, {}, {}};
+    const std::vector<QSizeF> sizes(6, QSizeF{50., 20.});
+    qan::OrgTreeLayout layout;
+
+    layout.setLayoutOrientation(qan::OrgTreeLayout::LayoutOrientation::IndentedVertical);
+    auto positions = layout.computeLayout(children, sizes, 25., 25.);
+    ASSERT_EQ(positions.size(), sizes.size());
+    EXPECT_EQ(positions[0], QPointF(0., 0.));
+    EXPECT_EQ(positions[1], QPointF(75., 45.));     // Nodes are laid out in depth first order, indented after their parent
+    EXPECT_EQ(positions[4], QPointF(150., 90.));
+    EXPECT_EQ(positions[2], QPointF(75., 135.));
+    EXPECT_EQ(positions[3], QPointF(75., 180.));
+    EXPECT_EQ(positions[5], QPointF(150., 225.));
+
+    layout.setLayoutOrientation(qan::OrgTreeLayout::LayoutOrientation::IndentedHorizontal);
+    positions = layout.computeLayout(children, sizes, 25., 25.);
+    EXPECT_EQ(positions[1], QPointF(75., 45.));
+    EXPECT_EQ(positions[4], QPointF(150., 90.));
+    EXPECT_EQ(positions[2], QPointF(225., 45.));
+    EXPECT_EQ(positions[3], QPointF(300., 45.));
+    EXPECT_EQ(positions[5], QPointF(375., 90.));
+
+    // Mixed: leaf siblings are laid out in a row after their parent
+    layout.setLayoutOrientation(qan::OrgTreeLayout::LayoutOrientation::IndentedMixed);
+    positions = layout.computeLayout({{1, 2, 3}, {}, {}, {}}, std::vector<QSizeF>(4, QSizeF{50., 20.}), 25., 25.);
+    ASSERT_EQ(positions.size(), 4);
+    EXPECT_EQ(positions[1], QPointF(75., 45.));
+    EXPECT_EQ(positions[2], QPointF(150., 45.));
+    EXPECT_EQ(positions[3], QPointF(225., 45.));
+}
+
+TEST(qan_OrgTreeLayout, noOverlapAndOrder)
+{
+    std::vector<QSizeF> sizes;
+    qan::OrgTreeLayout::Children children;
+    qan::test::randomOrgTree(2000, 5, sizes, children);
+    for (const auto orientation : {qan::OrgTreeLayout::LayoutOrientation::Vertical,
+                                   qan::OrgTreeLayout::LayoutOrientation::Horizontal,
+                                   qan::OrgTreeLayout::LayoutOrientation::Mixed,
+                                   qan::OrgTreeLayout::LayoutOrientation::IndentedVertical,
+                                   qan::OrgTreeLayout::LayoutOrientation::IndentedHorizontal,
+                                   qan::OrgTreeLayout::LayoutOrientation::IndentedMixed}) {
+        qan::OrgTreeLayout layout;
+        layout.setLayoutOrientation(orientation);
+        const auto positions = layout.computeLayout(children, sizes, 25., 15.);
+        ASSERT_EQ(positions.size(), sizes.size());
+        EXPECT_EQ(positions[0], QPointF(0., 0.));
+        EXPECT_FALSE(hasOverlap(positions, sizes));
+        if (orientation == qan::OrgTreeLayout::LayoutOrientation::Mixed ||
+            orientation == qan::OrgTreeLayout::LayoutOrientation::IndentedMixed)
+            continue;
+        const auto horizontal = orientation == qan::OrgTreeLayout::LayoutOrientation::Horizontal ||
+                                orientation == qan::OrgTreeLayout::LayoutOrientation::IndentedHorizontal;
+        for (const auto& siblings : children)
+            for (std::size_t s = 1; s < siblings.size(); ++s)
+                EXPECT_LT(horizontal ? positions[siblings[s - 1]].x() : positions[siblings[s - 1]].y(),
+                          horizontal ? positions[siblings[s]].x() : positions[siblings[s]].y());
+    }
+}
+
+TEST(qan_OrgTreeLayout, nonTree)
+{
+    // 0->1->2->0 circuit, 0->2 and 1->1: each node is laid out once under its first BFS parent
+    qan::OrgTreeLayout layout;
+    const std::vector<QSizeF> sizes(3, QSizeF{50., 20.});
+    const auto positions = layout.computeLayout({{1, 2}, {2, 1}, {0}}, sizes, 25., 25.);
+    ASSERT_EQ(positions.size(), 3);
+    EXPECT_DOUBLE_EQ(positions[1].x(), 75.);
+    EXPECT_DOUBLE_EQ(positions[2].x(), 75.);
+    EXPECT_FALSE(hasOverlap(positions, sizes));
+}
+
+TEST(qan_OrgTreeLayout, deepChain)
+{
+    // Legacy recursive implementation overflow the stack on such chains
+    const std::size_t nodeCount = 50000;
+    qan::OrgTreeLayout::Children children(nodeCount);
+    for (std::size_t n = 0; n + 1 < nodeCount; ++n)
+        children[n].push_back(n + 1);
+    const std::vector<QSizeF> sizes(nodeCount, QSizeF{50., 30.});
+    qan::OrgTreeLayout layout;
+    const auto positions = layout.computeLayout(children, sizes, 25., 25.);
+    ASSERT_EQ(positions.size(), nodeCount);
+    EXPECT_DOUBLE_EQ(positions.back().x(), 75. * (nodeCount - 1));
+    EXPECT_DOUBLE_EQ(positions.back().y(), 0.);
+
+    layout.setLayoutOrientation(qan::OrgTreeLayout::LayoutOrientation::IndentedVertical);
+    const auto indentedPositions = layout.computeLayout(children, sizes, 25., 25.);
+    ASSERT_EQ(indentedPositions.size(), nodeCount);
+    EXPECT_DOUBLE_EQ(indentedPositions.back().x(), 75. * (nodeCount - 1));
+    EXPECT_DOUBLE_EQ(indentedPositions.back().y(), 55. * (nodeCount - 1));
+}
+
+TEST(qan_OrgTreeLayout, wideFanout)
+{
+    const std::size_t nodeCount = 100001;
+    qan::OrgTreeLayout::Children children(1);
+    for (std::size_t n = 1; n < nodeCount; ++n)
+        children[0].push_back(n);
+    children.resize(nodeCount);
+    const std::vector<QSizeF> sizes(nodeCount, QSizeF{50., 30.});
+    qan::OrgTreeLayout layout;
+    layout.setLayoutOrientation(qan::OrgTreeLayout::LayoutOrientation::Horizontal);
+    const auto positions = layout.computeLayout(children, sizes, 25., 25.);
+    ASSERT_EQ(positions.size(), nodeCount);
+    const auto span = 75. * (nodeCount - 2);
+    EXPECT_DOUBLE_EQ(positions[1].x(), -span / 2.);
+    EXPECT_DOUBLE_EQ(positions.back().x(), span / 2.);
+    EXPECT_DOUBLE_EQ(positions.back().y(), 55.);
+}
+
+TEST(qan_OrgTreeLayout, progressAndCancel)
+{
+    const std::size_t nodeCount = 20000;
+    qan::OrgTreeLayout::Children children(nodeCount);
+    for (std::size_t n = 1; n < nodeCount; ++n)
+        children[(n - 1) / 4].push_back(n);
+    const std::vector<QSizeF> sizes(nodeCount, QSizeF{50., 30.});
+    qan::OrgTreeLayout layout;
+
+    // Progress is reported during every pass, monotonically up to 1.
+    std::vector<qreal> reported;
+    const auto positions = layout.computeLayout(children, sizes, 25., 25., [&reported](qreal p) {
+        reported.push_back(p);
+        return true;
+    });
+    EXPECT_EQ(positions, layout.computeLayout(children, sizes, 25., 25.));
+    ASSERT_GT(reported.size(), 8);
+    EXPECT_TRUE(std::is_sorted(reported.cbegin(), reported.cend()));
+    EXPECT_DOUBLE_EQ(reported.front(), 0.);
+    EXPECT_DOUBLE_EQ(reported.back(), 1.);
+
+    // Layout is cancelled as soon as progress return false.
+    int calls = 0;
+    const auto cancelled = layout.computeLayout(children, sizes, 25., 25., [&calls](qreal p) {
+        ++calls;
+        return p < 0.5;
+    });
+    EXPECT_TRUE(cancelled.empty());
+    EXPECT_LT(calls, static_cast<int>(reported.size()));
+}
+
+TEST(qan_OrgTreeLayout, layoutNode)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    graph.setContainerItem(&container);
+    std::vector<qan::Node*> nodes;
+    for (int n = 0; n < 4; ++n) {
+        auto node = graph.insertNode();
+        ASSERT_TRUE(node != nullptr);
+        auto item = node->getItem();
+        if (item == nullptr) {
+            item = new qan::NodeItem(&container);
+            item->setGraph(&graph);
+            node->setItem(item);
+        }
+        item->setSize(QSizeF{50., 20.});
+        item->setPosition(QPointF{n * 10., n * 10.});
+        nodes.push_back(node);
+    }
+    nodes[0]->getItem()->setPosition(QPointF{100., 200.});
+    graph.insertEdge(nodes[0], nodes[1]);
+    graph.insertEdge(nodes[0], nodes[2]);
+    graph.insertEdge(nodes[2], nodes[3]);
+
+    qan::OrgTreeLayout layout;
+    layout.layout(nodes[0], 25., 25.);
+    EXPECT_EQ(nodes[0]->getItem()->position(), QPointF(100., 200.));
+    EXPECT_EQ(nodes[1]->getItem()->position(), QPointF(175., 177.5));
+    EXPECT_EQ(nodes[2]->getItem()->position(), QPointF(175., 222.5));
+    EXPECT_EQ(nodes[3]->getItem()->position(), QPointF(250., 222.5));
+}
+
+TEST(qan_OrgTreeLayout, relayoutFromWithoutOverlap)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    qan::OrgTreeLayout layout;
+    auto nodes = makeTree(graph, container, layout);
+    const auto positions = positionsOf(nodes);
+    EXPECT_EQ(positions[1], QPointF(75., -45.));
+    EXPECT_EQ(positions[4], QPointF(150., -45.));
+    EXPECT_EQ(positions[5], QPointF(150., 45.));
+
+    // Add a2 under a: only a subtree is laid out again, nothing else move
+    const auto a2 = insertNode(graph, container);
+    graph.insertEdge(nodes[1], a2);
+    layout.relayoutFrom(nodes[1], 25., 25.);
+    EXPECT_EQ(nodes[4]->getItem()->position(), QPointF(150., -67.5));
+    EXPECT_EQ(a2->getItem()->position(), QPointF(150., -22.5));
+    for (const auto n : {0, 1, 2, 3, 5})
+        EXPECT_EQ(nodes[n]->getItem()->position(), positions[n]);
+}
+
+TEST(qan_OrgTreeLayout, relayoutFromShiftSiblings)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    qan::OrgTreeLayout layout;
+    auto nodes = makeTree(graph, container, layout);
+    const auto positions = positionsOf(nodes);
+
+    // Add b1, b2, b3 under b: b1 overlap a1 and b3 overlap c1, a and c subtrees are shifted just enough
+    std::vector<qan::Node*> bChildren;
+    for (int n = 0; n < 3; ++n) {
+        bChildren.push_back(insertNode(graph, container));
+        graph.insertEdge(nodes[2], bChildren.back());
+    }
+    layout.relayoutFrom(nodes[2], 25., 25.);
+    EXPECT_EQ(bChildren[0]->getItem()->position(), QPointF(150., -45.));
+    EXPECT_EQ(bChildren[1]->getItem()->position(), QPointF(150., 0.));
+    EXPECT_EQ(bChildren[2]->getItem()->position(), QPointF(150., 45.));
+    EXPECT_EQ(nodes[1]->getItem()->position(), QPointF(75., -90.));
+    EXPECT_EQ(nodes[4]->getItem()->position(), QPointF(150., -90.));
+    EXPECT_EQ(nodes[3]->getItem()->position(), QPointF(75., 90.));
+    EXPECT_EQ(nodes[5]->getItem()->position(), QPointF(150., 90.));
+    EXPECT_EQ(nodes[0]->getItem()->position(), positions[0]);
+    EXPECT_EQ(nodes[2]->getItem()->position(), positions[2]);
+}
+
+TEST(qan_OrgTreeLayout, relayoutFromRandomTrees)
+{
+    // Nodes outside modified subtree keep their positions or move along sibling axis only, without overlap
+    std::mt19937 generator{42};
+    for (const auto orientation : {qan::OrgTreeLayout::LayoutOrientation::Vertical,
+                                   qan::OrgTreeLayout::LayoutOrientation::Horizontal,
+                                   qan::OrgTreeLayout::LayoutOrientation::Mixed}) {
+        for (int t = 0; t < 10; ++t) {
+            qan::Graph graph;
+            QQuickItem container;
+            graph.setContainerItem(&container);
+            std::vector<qan::Node*> nodes;
+            for (int n = 0; n < 100; ++n) {
+                nodes.push_back(insertNode(graph, container, QSizeF(10. + generator() % 60, 10. + generator() % 40)));
+                if (n > 0)
+                    graph.insertEdge(nodes[n - 1 - (generator() % std::min(n, 4))], nodes.back());
+            }
+            qan::OrgTreeLayout layout;
+            layout.setLayoutOrientation(orientation);
+            layout.layout(nodes[0], 25., 15.);
+            const auto positions = positionsOf(nodes);
+
+            const auto target = nodes[generator() % nodes.size()];
+            std::vector<qan::Node*> subtree{target};
+            for (int c = 0; c < 3; ++c) {
+                nodes.push_back(insertNode(graph, container));
+                graph.insertEdge(target, nodes.back());
+            }
+            for (std::size_t n = 0; n < subtree.size(); ++n)
+                for (const auto child : subtree[n]->get_out_nodes())
+                    if (std::find(subtree.cbegin(), subtree.cend(), child) == subtree.cend())
+                        subtree.push_back(child);
+            layout.relayoutFrom(target, 25., 15.);
+
+            std::vector<QSizeF> sizes;
+            for (const auto node : nodes)
+                sizes.emplace_back(node->getItem()->width(), node->getItem()->height());
+            EXPECT_FALSE(hasOverlap(positionsOf(nodes), sizes));
+            EXPECT_EQ(nodes[0]->getItem()->position(), positions[0]);
+            EXPECT_EQ(target->getItem()->position(), positions[std::find(nodes.cbegin(), nodes.cend(), target) - nodes.cbegin()]);
+            const auto horizontal = orientation == qan::OrgTreeLayout::LayoutOrientation::Horizontal;
+            for (std::size_t n = 0; n < positions.size(); ++n) {
+                if (std::find(subtree.cbegin(), subtree.cend(), nodes[n]) != subtree.cend())
+                    continue;
+                const auto delta = nodes[n]->getItem()->position() - positions[n];
+                EXPECT_DOUBLE_EQ(horizontal ? delta.y() : delta.x(), 0.);
+            }
+        }
+    }
+}
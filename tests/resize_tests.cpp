@@ -0,0 +1,137 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	resize_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// QuickQanava headers
+#include <QuickQanava>
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// Resizer preview and qan::Graph selection resize tests
+//-----------------------------------------------------------------------------
+
+namespace { // ::
+
+qan::Node*  insertSelectedNode(qan::Graph& graph, QQuickItem& container, QSizeF size)
+{
+    auto node = graph.insertNode();
+    if (node == nullptr)
+        return nullptr;
+    auto item = node->getItem();
+    if (item == nullptr) {
+        item = new qan::NodeItem(&container);
+        item->setGraph(&graph);
+        node->setItem(item);
+    }
+    item->setSize(size);
+    graph.setNodeSelected(*node, true);
+    return node;
+}
+
+class TestRightResizer : public qan::RightResizer
+{
+public:
+    using qan::RightResizer::RightResizer;
+    using qan::RightResizer::mousePressEvent;
+    using qan::RightResizer::mouseReleaseEvent;
+    using qan::RightResizer::resizeTo;
+};
+
+} // ::
+
+TEST(qan_Resizer, previewDefault)
+{
+    qan::RightResizer rightResizer;
+    EXPECT_FALSE(rightResizer.getPreview());
+    qan::BottomResizer bottomResizer;
+    EXPECT_FALSE(bottomResizer.getPreview());
+    qan::BottomRightResizer bottomRightResizer;
+    EXPECT_FALSE(bottomRightResizer.getPreview());
+}
+
+TEST(qan_Resizer, previewCommitOnRelease)
+{
+    QQuickItem container;
+    QQuickItem target{&container};
+    target.setSize(QSizeF{100., 50.});
+    TestRightResizer resizer{&container};
+    resizer.setPreview(true);
+    resizer.setTarget(&target);
+
+    QMouseEvent press{QEvent::MouseButtonPress, QPointF{100., 10.}, QPointF{100., 10.},
+                      Qt::LeftButton, Qt::LeftButton, Qt::NoModifier};
+    resizer.mousePressEvent(&press);
+    resizer.resizeTo(QPointF{120., 10.});
+    resizer.resizeTo(QPointF{140., 10.});
+    EXPECT_DOUBLE_EQ(target.width(), 100.);     // Target is not resized during preview
+    EXPECT_DOUBLE_EQ(resizer.getPreviewSize().width(), 140.);
+
+    QMouseEvent release{QEvent::MouseButtonRelease, QPointF{140., 10.}, QPointF{140., 10.},
+                        Qt::LeftButton, Qt::NoButton, Qt::NoModifier};
+    resizer.mouseReleaseEvent(&release);
+    EXPECT_DOUBLE_EQ(target.width(), 140.);
+    EXPECT_DOUBLE_EQ(target.height(), 50.);
+    EXPECT_FALSE(resizer.getPreviewSize().isValid());
+}
+
+TEST(qan_Graph, resizeSelection)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    auto primary = insertSelectedNode(graph, container, QSizeF{100., 50.});
+    auto node = insertSelectedNode(graph, container, QSizeF{40., 20.});
+    auto locked = insertSelectedNode(graph, container, QSizeF{40., 20.});
+    ASSERT_TRUE(primary != nullptr && node != nullptr && locked != nullptr);
+    locked->setLocked(true);
+    node->getItem()->setMinimumSize(QSizeF{10., 15.});
+
+    int resized = 0;
+    QObject::connect(&graph, &qan::Graph::nodeResized, [&resized](qan::Node*) { ++resized; });
+
+    graph.beginResizeSelection(primary->getItem());
+    primary->getItem()->setSize(QSizeF{200., 25.});     // Scale x2 horizontally, /2 vertically
+    graph.endResizeSelection(primary->getItem());
+
+    EXPECT_DOUBLE_EQ(node->getItem()->width(), 80.);
+    EXPECT_DOUBLE_EQ(node->getItem()->height(), 15.);   // Clamped to minimum size
+    EXPECT_DOUBLE_EQ(locked->getItem()->width(), 40.);  // Locked nodes are not resized
+    EXPECT_DOUBLE_EQ(locked->getItem()->height(), 20.);
+    EXPECT_EQ(resized, 1);
+
+    // Without a begin, end has no effect
+    graph.endResizeSelection(primary->getItem());
+    EXPECT_DOUBLE_EQ(node->getItem()->width(), 80.);
+}
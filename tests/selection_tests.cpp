@@ -0,0 +1,407 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	selection_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <random>
+#include <set>
+
+// Qt headers
+#include <QQuickWindow>
+#include <QQmlComponent>
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./tests.h"
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// qan::Graph and qan::GraphView selection tests
+//-----------------------------------------------------------------------------
+
+namespace { // ::
+
+// Expose qan::Navigable selection rect interface
+class RubberBandView : public qan::GraphView
+{
+public:
+    explicit RubberBandView(QQuickItem* parent = nullptr) : qan::GraphView{parent} { }
+    using qan::GraphView::selectionRectActivated;
+    using qan::GraphView::selectionRectEnd;
+};
+
+// Return currently selected nodes and edges items
+std::set<QQuickItem*>   selectedItems(const qan::Graph& graph)
+{
+    std::set<QQuickItem*> items;
+    for (const auto& node : graph.getSelectedNodes())
+        if (node && node->getItem() != nullptr)
+            items.insert(node->getItem());
+    for (const auto& edge : graph.getSelectedEdges())
+        if (edge && edge->getItem() != nullptr)
+            items.insert(edge->getItem());
+    return items;
+}
+
+// Return graph container direct child nodes and edges items fully contained in rect (ie a full, non incremental, rubber band query)
+std::set<QQuickItem*>   itemsInside(const qan::Graph& graph, const QRectF& rect)
+{
+    std::set<QQuickItem*> items;
+    const auto& spatialIndex = graph.getSpatialIndex();
+    const auto isInside = [&](QQuickItem* item) -> bool {
+        if (item == nullptr ||
+            item->parentItem() != graph.getContainerItem() ||
+            !spatialIndex.contains(item))
+            return false;
+        const auto r = spatialIndex.getRect(item);
+        return rect.left() <= r.left() && r.right() <= rect.right() &&
+               rect.top() <= r.top() && r.bottom() <= rect.bottom();
+    };
+    for (const auto node : graph.get_nodes())
+        if (node != nullptr && isInside(node->getItem()))
+            items.insert(node->getItem());
+    for (const auto edge : graph.get_edges())
+        if (edge != nullptr && isInside(edge->getItem()))
+            items.insert(edge->getItem());
+    return items;
+}
+
+} // ::
+
+TEST(qan_GraphView, incrementalRubberBand)
+{
+    RubberBandView view;
+    QQmlEngine::setContextForObject(&view, qan::test::engine()->rootContext());
+    qan::test::Graph graph;
+    view.setGraph(&graph);
+    std::vector<qan::Node*> nodes;
+    for (int n = 0; n < 400; ++n) {                         // 20x20 nodes grid
+        auto node = graph.insertNode();
+        ASSERT_TRUE(node != nullptr && node->getItem() != nullptr);
+        node->getItem()->setSize(QSizeF{50., 30.});
+        node->getItem()->setPosition(QPointF{(n % 20) * 60., (n / 20) * 40.});
+        nodes.push_back(node);
+    }
+    for (int n = 0; n + 1 < 400; n += 7)
+        graph.insertEdge(nodes[n], nodes[n + 1]);
+
+    int selectionChangedCount = 0;
+    QObject::connect(&graph, &qan::Graph::selectionChanged,
+                     [&selectionChangedCount]() { ++selectionChangedCount; });
+
+    // Grow, shrink, then move the band, finally random bands from a fixed origin
+    std::vector<QRectF> rects;
+    for (int s = 1; s <= 10; ++s)
+        rects.push_back(QRectF{-5., -5., s * 100., s * 70.});
+    for (int s = 10; s >= 1; --s)
+        rects.push_back(QRectF{-5., -5., s * 100. - 30., s * 70. - 20.});
+    for (int m = 0; m < 10; ++m)
+        rects.push_back(QRectF{m * 45. - 5., m * 33. - 5., 400., 300.});
+    std::mt19937 generator{42};
+    std::uniform_real_distribution<qreal> extent{1., 1300.};
+    for (int r = 0; r < 30; ++r)
+        rects.push_back(QRectF{295., 195., extent(generator), extent(generator)});
+
+    auto previousSelection = selectedItems(graph);
+    for (const auto& rect : rects) {
+        selectionChangedCount = 0;
+        view.selectionRectActivated(rect);
+        const auto selection = selectedItems(graph);
+        EXPECT_EQ(selection, itemsInside(graph, rect)) << "rect=" << rect.x() << "," << rect.y() << " "
+                                                       << rect.width() << "x" << rect.height();
+        EXPECT_EQ(selectionChangedCount, selection != previousSelection ? 1 : 0);   // One selection batch per update
+        previousSelection = selection;
+    }
+    view.selectionRectEnd();
+    EXPECT_FALSE(previousSelection.empty());
+}
+
+TEST(qan_Graph, bulkSelection)
+{
+    qan::test::Graph graph;
+    auto n1 = graph.insertNode();
+    auto n2 = graph.insertNode();
+    auto n3 = graph.insertNode();
+    auto g1 = graph.insertGroup();
+    ASSERT_TRUE(n1 != nullptr && n2 != nullptr && n3 != nullptr && g1 != nullptr);
+    auto e1 = graph.insertEdge(n1, n2);
+    auto e2 = graph.insertEdge(n2, n3);
+    ASSERT_TRUE(e1 != nullptr && e2 != nullptr);
+    int selectionChangedCount = 0;
+    QObject::connect(&graph, &qan::Graph::selectionChanged,
+                     [&selectionChangedCount]() { ++selectionChangedCount; });
+
+    graph.selectNodes(std::vector<qan::Node*>{n1, n2, g1});    // Groups are dispatched in selected groups
+    EXPECT_EQ(selectionChangedCount, 1);
+    EXPECT_EQ(graph.getSelectedNodes().size(), 2);
+    EXPECT_TRUE(graph.getSelectedNodes().contains(n1));
+    EXPECT_TRUE(graph.getSelectedNodes().contains(n2));
+    EXPECT_EQ(graph.getSelectedGroups().size(), 1);
+    EXPECT_TRUE(graph.getSelectedGroups().contains(g1));
+    EXPECT_TRUE(n1->getItem()->getSelected());
+    EXPECT_TRUE(g1->getItem()->getSelected());
+
+    selectionChangedCount = 0;
+    graph.selectNodes(std::vector<qan::Node*>{n1, n2});        // Already selected: no notification
+    EXPECT_EQ(selectionChangedCount, 0);
+
+    graph.selectEdges(std::vector<qan::Edge*>{e1, e2});
+    EXPECT_EQ(selectionChangedCount, 1);
+    EXPECT_EQ(graph.getSelectedEdges().size(), 2);
+
+    selectionChangedCount = 0;
+    graph.deselect(std::vector<qan::Node*>{n1, g1});
+    EXPECT_EQ(selectionChangedCount, 1);
+    EXPECT_EQ(graph.getSelectedNodes().size(), 1);
+    EXPECT_TRUE(graph.getSelectedNodes().contains(n2));
+    EXPECT_EQ(graph.getSelectedGroups().size(), 0);
+    EXPECT_FALSE(n1->getItem()->getSelected());
+    EXPECT_FALSE(g1->getItem()->getSelected());
+
+    selectionChangedCount = 0;
+    graph.deselect(std::vector<qan::Edge*>{e1});
+    EXPECT_EQ(selectionChangedCount, 1);
+    EXPECT_EQ(graph.getSelectedEdges().size(), 1);
+    EXPECT_TRUE(graph.getSelectedEdges().contains(e2));
+
+    selectionChangedCount = 0;
+    graph.setSelection({n1, n3}, {g1}, {e1});                   // Replace nodes, groups and edges at once
+    EXPECT_EQ(selectionChangedCount, 1);
+    EXPECT_EQ(graph.getSelectedNodes().size(), 2);
+    EXPECT_TRUE(graph.getSelectedNodes().contains(n1));
+    EXPECT_TRUE(graph.getSelectedNodes().contains(n3));
+    EXPECT_FALSE(n2->getItem()->getSelected());
+    EXPECT_EQ(graph.getSelectedGroups().size(), 1);
+    EXPECT_EQ(graph.getSelectedEdges().size(), 1);
+    EXPECT_TRUE(graph.getSelectedEdges().contains(e1));
+    EXPECT_FALSE(e2->getItem()->getSelected());
+
+    selectionChangedCount = 0;
+    graph.setSelection({n1, n3}, {g1}, {e1});                   // Unchanged selection
+    EXPECT_EQ(selectionChangedCount, 0);
+
+    n2->setLocked(true);                                        // Locked nodes are not selected
+    graph.setSelection({n2}, {}, {});
+    EXPECT_EQ(selectionChangedCount, 1);
+    EXPECT_FALSE(graph.hasSelection());
+    n2->setLocked(false);
+}
+
+TEST(qan_Graph, bulkSelectionQml)
+{
+    qan::test::Graph graph;
+    auto n1 = graph.insertNode();
+    auto n2 = graph.insertNode();
+    auto g1 = graph.insertGroup();
+    ASSERT_TRUE(n1 != nullptr && n2 != nullptr && g1 != nullptr);
+    auto e1 = graph.insertEdge(n1, n2);
+    ASSERT_TRUE(e1 != nullptr);
+    int selectionChangedCount = 0;
+    QObject::connect(&graph, &qan::Graph::selectionChanged,
+                     [&selectionChangedCount]() { ++selectionChangedCount; });
+    const auto variant = [](QObject* o) { return QVariant::fromValue(o); };
+
+    graph.selectNodes(QVariantList{variant(n1), variant(g1), variant(e1)});    // Edge is ignored
+    EXPECT_EQ(selectionChangedCount, 1);
+    EXPECT_EQ(graph.getSelectedNodes().size(), 1);
+    EXPECT_EQ(graph.getSelectedGroups().size(), 1);
+    EXPECT_EQ(graph.getSelectedEdges().size(), 0);
+
+    graph.selectEdges(QVariantList{variant(e1)});
+    EXPECT_EQ(selectionChangedCount, 2);
+    EXPECT_EQ(graph.getSelectedEdges().size(), 1);
+
+    selectionChangedCount = 0;
+    graph.deselect(QVariantList{variant(n1), variant(g1), variant(e1)});       // Mixed list: one notification
+    EXPECT_EQ(selectionChangedCount, 1);
+    EXPECT_FALSE(graph.hasSelection());
+
+    selectionChangedCount = 0;
+    graph.setSelection(QVariantList{variant(n2), variant(g1), variant(e1)});
+    EXPECT_EQ(selectionChangedCount, 1);
+    EXPECT_TRUE(graph.getSelectedNodes().contains(n2));
+    EXPECT_TRUE(graph.getSelectedGroups().contains(g1));
+    EXPECT_TRUE(graph.getSelectedEdges().contains(e1));
+}
+
+TEST(qan_Graph, selectAllClearRemoveSelection)
+{
+    qan::test::Graph graph;
+    std::vector<qan::Node*> nodes;
+    for (int n = 0; n < 10; ++n)
+        nodes.push_back(graph.insertNode());
+    auto g1 = graph.insertGroup();
+    ASSERT_TRUE(g1 != nullptr);
+    ASSERT_TRUE(std::all_of(nodes.cbegin(), nodes.cend(), [](auto n) { return n != nullptr; }));
+    auto e1 = graph.insertEdge(nodes[0], nodes[1]);
+    ASSERT_TRUE(e1 != nullptr);
+    nodes[9]->setLocked(true);
+    int selectionChangedCount = 0;
+    QObject::connect(&graph, &qan::Graph::selectionChanged,
+                     [&selectionChangedCount]() { ++selectionChangedCount; });
+
+    graph.selectAll();                                          // All nodes and groups, except locked ones
+    EXPECT_EQ(selectionChangedCount, 1);
+    EXPECT_EQ(graph.getSelectedNodes().size(), 9);
+    EXPECT_FALSE(graph.getSelectedNodes().contains(nodes[9]));
+    EXPECT_EQ(graph.getSelectedGroups().size(), 1);
+
+    selectionChangedCount = 0;
+    graph.clearSelection();
+    EXPECT_EQ(selectionChangedCount, 1);
+    EXPECT_FALSE(graph.hasSelection());
+    EXPECT_TRUE(std::none_of(nodes.cbegin(), nodes.cend(), [](auto n) { return n->getItem()->getSelected(); }));
+    EXPECT_FALSE(g1->getItem()->getSelected());
+
+    graph.setSelection({nodes[0], nodes[1], nodes[2]}, {g1}, {e1});
+    const QPointer<qan::Edge> edge{e1};
+    selectionChangedCount = 0;
+    graph.removeSelection();
+    EXPECT_EQ(selectionChangedCount, 1);
+    EXPECT_FALSE(graph.hasSelection());
+    EXPECT_EQ(graph.get_node_count(), 7);                       // 3 nodes and 1 group removed
+    EXPECT_FALSE(graph.hasGroup(g1));
+    EXPECT_TRUE(edge.isNull() || !graph.get_edges().contains(edge.data()));
+}
+
+namespace { // ::
+
+// Return selection overlay outlines in graph container CS, sorted by position
+std::vector<QRectF> overlayOutlines(const qan::SelectionOverlay& overlay)
+{
+    std::vector<QRectF> outlines;
+    for (const auto& outline : overlay.getOutlines())
+        outlines.push_back(outline.translated(overlay.position()));
+    std::sort(outlines.begin(), outlines.end(), [](const auto& a, const auto& b) {
+        return a.x() < b.x() || (a.x() == b.x() && a.y() < b.y());
+    });
+    return outlines;
+}
+
+// Return expected outlines for items (in graph container CS), sorted by position
+std::vector<QRectF> expectedOutlines(const qan::Graph& graph, const std::vector<QQuickItem*>& items)
+{
+    const auto offset = (graph.getSelectionWeight() / 2.) + graph.getSelectionMargin();
+    std::vector<QRectF> outlines;
+    for (const auto item : items)
+        outlines.push_back(item->mapRectToItem(graph.getContainerItem(),
+                                               QRectF{0., 0., item->width(), item->height()}).adjusted(-offset, -offset, offset, offset));
+    std::sort(outlines.begin(), outlines.end(), [](const auto& a, const auto& b) {
+        return a.x() < b.x() || (a.x() == b.x() && a.y() < b.y());
+    });
+    return outlines;
+}
+
+} // ::
+
+TEST(qan_SelectionOverlay, followSelectedItems)
+{
+    QQuickWindow window;
+    window.resize(600, 600);
+    qan::test::Graph graph{window.contentItem()};
+    graph.setSize(QSizeF{600., 600.});
+    auto n1 = graph.insertNode();
+    auto n2 = graph.insertNode();
+    auto n3 = graph.insertNode();
+    ASSERT_TRUE(n1 != nullptr && n2 != nullptr && n3 != nullptr);
+    n1->getItem()->setPosition(QPointF{10., 10.});
+    n2->getItem()->setPosition(QPointF{200., 100.});
+    n3->getItem()->setPosition(QPointF{400., 300.});
+    graph.setSelection({n1, n2}, {}, {});
+    const auto overlay = graph.getSelectionOverlay();
+    ASSERT_TRUE(overlay != nullptr);
+    ASSERT_TRUE(graph.isSelectionOverlayActive());
+    window.show();
+
+    const auto outlinesMatch = [&]() {
+        return overlayOutlines(*overlay) == expectedOutlines(graph, {n1->getItem(), n2->getItem()});
+    };
+    EXPECT_TRUE(qan::test::waitFor(outlinesMatch));
+
+    n1->getItem()->setPosition(QPointF{50., 250.});         // Outline follow selected item moves
+    EXPECT_TRUE(qan::test::waitFor(outlinesMatch));
+    n2->getItem()->setSize(QSizeF{180., 90.});              // ...and resizes
+    EXPECT_TRUE(qan::test::waitFor(outlinesMatch));
+
+    graph.setNodeSelected(n3, true);                        // Outlines follow selection changes
+    EXPECT_TRUE(qan::test::waitFor([&]() {
+        return overlayOutlines(*overlay) == expectedOutlines(graph, {n1->getItem(), n2->getItem(), n3->getItem()});
+    }));
+    graph.clearSelection();
+    EXPECT_TRUE(qan::test::waitFor([&]() { return overlay->getOutlines().empty(); }));
+}
+
+TEST(qan_SelectionOverlay, selectionItems)
+{
+    qan::test::Graph graph;
+    auto n1 = graph.insertNode();
+    auto n2 = graph.insertNode();
+    auto g1 = graph.insertGroup();
+    ASSERT_TRUE(n1 != nullptr && n2 != nullptr && g1 != nullptr);
+    graph.setSelection({n1}, {g1}, {});
+    EXPECT_EQ(n1->getItem()->getSelectionItem(), nullptr);  // Default: drawn in overlay, no per item selection item
+    EXPECT_EQ(g1->getItem()->getSelectionItem(), nullptr);
+
+    graph.setSelectionOverlayEnabled(false);                // Overlay disabled: selected items get a selection item
+    EXPECT_FALSE(graph.isSelectionOverlayActive());
+    EXPECT_FALSE(graph.getSelectionOverlay()->isVisible());
+    EXPECT_NE(n1->getItem()->getSelectionItem(), nullptr);
+    EXPECT_NE(g1->getItem()->getSelectionItem(), nullptr);
+    EXPECT_EQ(n2->getItem()->getSelectionItem(), nullptr);  // ...only selected ones
+    graph.setNodeSelected(n2, true);
+    EXPECT_NE(n2->getItem()->getSelectionItem(), nullptr);
+
+    graph.setSelectionOverlayEnabled(true);                 // Overlay enabled: selection items are released
+    EXPECT_TRUE(graph.getSelectionOverlay()->isVisible());
+    EXPECT_EQ(n1->getItem()->getSelectionItem(), nullptr);
+    EXPECT_EQ(n2->getItem()->getSelectionItem(), nullptr);
+    EXPECT_EQ(g1->getItem()->getSelectionItem(), nullptr);
+
+    auto delegate = new QQmlComponent{qan::test::engine()};
+    delegate->setData("import QtQuick\nItem { }", QUrl{});
+    ASSERT_TRUE(delegate->isReady());
+    graph.setSelectionDelegate(delegate);                   // Custom delegate: per item selection items
+    EXPECT_FALSE(graph.isSelectionOverlayActive());
+    EXPECT_FALSE(graph.getSelectionOverlay()->isVisible());
+    EXPECT_NE(n1->getItem()->getSelectionItem(), nullptr);
+    EXPECT_NE(g1->getItem()->getSelectionItem(), nullptr);
+
+    graph.setSelectionDelegate(static_cast<QQmlComponent*>(nullptr));   // Default delegate: back to overlay
+    EXPECT_TRUE(graph.isSelectionOverlayActive());
+    EXPECT_EQ(n1->getItem()->getSelectionItem(), nullptr);
+    EXPECT_EQ(g1->getItem()->getSelectionItem(), nullptr);
+}
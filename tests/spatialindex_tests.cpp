@@ -0,0 +1,306 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	spatialindex_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// STD headers
+#include <vector>
+#include <algorithm>
+
+// Qt headers
+#if defined(QUICKQANAVA_SCENEGRAPH_CULLING)
+#include <QtQuick/private/qquickitem_p.h>
+#endif
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./tests.h"
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// qan::SpatialIndex tests
+//-----------------------------------------------------------------------------
+
+TEST(qan_SpatialIndex, empty)
+{
+    qan::SpatialIndex index;
+    EXPECT_EQ(index.size(), 0);
+    EXPECT_TRUE(index.itemsAt(QPointF{0., 0.}).empty());
+    EXPECT_TRUE(index.itemsIntersecting(QRectF{-100., -100., 200., 200.}).empty());
+}
+
+TEST(qan_SpatialIndex, insertRemove)
+{
+    qan::SpatialIndex index{100.};
+    QQuickItem a, b;
+    index.insert(&a, QRectF{10., 10., 50., 50.});
+    index.insert(&b, QRectF{500., 500., 50., 50.});
+    EXPECT_EQ(index.size(), 2);
+    EXPECT_TRUE(index.contains(&a));
+    EXPECT_EQ(index.getRect(&a), (QRectF{10., 10., 50., 50.}));
+
+    EXPECT_TRUE(index.remove(&a));
+    EXPECT_FALSE(index.remove(&a));
+    EXPECT_FALSE(index.contains(&a));
+    EXPECT_EQ(index.size(), 1);
+    EXPECT_TRUE(index.itemsAt(QPointF{20., 20.}).empty());
+}
+
+TEST(qan_SpatialIndex, update)
+{
+    qan::SpatialIndex index{100.};
+    QQuickItem a;
+    index.insert(&a, QRectF{10., 10., 50., 50.});
+    index.insert(&a, QRectF{1010., 1010., 50., 50.});   // Move item in another cell
+    EXPECT_EQ(index.size(), 1);
+    EXPECT_TRUE(index.itemsAt(QPointF{20., 20.}).empty());
+    const auto items = index.itemsAt(QPointF{1020., 1020.});
+    ASSERT_EQ(items.size(), 1);
+    EXPECT_EQ(items[0], &a);
+}
+
+TEST(qan_SpatialIndex, queries)
+{
+    qan::SpatialIndex index{100.};
+    QQuickItem a, b, c, big;
+    index.insert(&a, QRectF{0., 0., 250., 250.});       // Span multiple cells
+    index.insert(&b, QRectF{300., 0., 0., 200.});       // Vertical (null width) edge rect
+    index.insert(&c, QRectF{-500., -500., 10., 10.});
+    index.insert(&big, QRectF{-10000., -10000., 20000., 20000.});   // Registered in a coarse level
+
+    auto at = index.itemsAt(QPointF{150., 150.});
+    std::sort(at.begin(), at.end());
+    auto expected = std::vector<QQuickItem*>{&a, &big};
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(at, expected);     // Items spanning multiple cells are reported once
+
+    const auto intersecting = index.itemsIntersecting(QRectF{290., 50., 20., 20.});
+    EXPECT_EQ(intersecting.size(), 2);  // b and big
+
+    const auto contained = index.itemsContained(QRectF{-600., -600., 1000., 1000.});
+    EXPECT_EQ(contained.size(), 3);     // a, b and c
+    EXPECT_TRUE(std::find(contained.begin(), contained.end(), &big) == contained.end());
+}
+
+TEST(qan_SpatialIndex, levels)
+{
+    qan::SpatialIndex index{100.};
+    QQuickItem small, edge;
+    index.insert(&small, QRectF{10., 10., 20., 20.});
+    index.insert(&edge, QRectF{0., 50., 100000., 0.});    // Long horizontal edge
+    auto at = index.itemsAt(QPointF{75000., 50.});
+    ASSERT_EQ(at.size(), 1);
+    EXPECT_EQ(at[0], &edge);
+    EXPECT_TRUE(index.itemsAt(QPointF{75000., 500.}).empty());
+
+    index.insert(&edge, QRectF{0., 50., 50., 0.});        // Shrink edge back to a fine level
+    EXPECT_TRUE(index.itemsAt(QPointF{75000., 50.}).empty());
+    at = index.itemsIntersecting(QRectF{0., 0., 100., 100.});
+    EXPECT_EQ(at.size(), 2);
+
+    index.insert(&small, QRectF{-50000., -50000., 100000., 100000.});  // Grow small to a coarse level
+    at = index.itemsContained(QRectF{-60000., -60000., 120000., 120000.});
+    EXPECT_EQ(at.size(), 2);
+    EXPECT_TRUE(index.remove(&small));
+    EXPECT_TRUE(index.itemsAt(QPointF{40000., 40000.}).empty());
+}
+
+TEST(qan_Graph, itemsInRect)
+{
+    qan::test::Graph graph;
+    auto n1 = graph.insertNode();
+    auto n2 = graph.insertNode();
+    ASSERT_TRUE(n1 != nullptr && n1->getItem() != nullptr &&
+                n2 != nullptr && n2->getItem() != nullptr);
+    n1->getItem()->setPosition(QPointF{0., 0.});
+    n1->getItem()->setSize(QSizeF{50., 50.});
+    n2->getItem()->setPosition(QPointF{1000., 1000.});
+    n2->getItem()->setSize(QSizeF{50., 50.});
+
+    const auto items = graph.itemsInRect(QRectF{-10., -10., 100., 100.});
+    ASSERT_EQ(items.size(), 1);
+    EXPECT_EQ(items.at(0), n1->getItem());
+    EXPECT_EQ(graph.graphChildAt(1020., 1020.), n2->getItem());
+
+    n2->getItem()->setPosition(QPointF{10., 10.});       // Index is updated on item move
+    EXPECT_EQ(graph.itemsInRect(QRectF{-10., -10., 100., 100.}).size(), 2);
+}
+
+namespace { // ::
+
+#if defined(QUICKQANAVA_SCENEGRAPH_CULLING)
+constexpr bool  sceneGraphCulling = true;
+#else
+constexpr bool  sceneGraphCulling = false;     // Culled items are hidden
+#endif
+
+// Return true if item is excluded from rendering by culling (QQuickItemPrivate culling when available).
+bool    sceneGraphCulled(QQuickItem* item)
+{
+#if defined(QUICKQANAVA_SCENEGRAPH_CULLING)
+    return QQuickItemPrivate::get(item)->culled;
+#else
+    return !item->isVisible();
+#endif
+}
+
+} // ::
+
+TEST(qan_Graph, viewportCulling)
+{
+    qan::test::Graph graph;
+    auto n1 = graph.insertNode();
+    auto n2 = graph.insertNode();
+    ASSERT_TRUE(n1 != nullptr && n1->getItem() != nullptr &&
+                n2 != nullptr && n2->getItem() != nullptr);
+    n1->getItem()->setPosition(QPointF{0., 0.});
+    n1->getItem()->setSize(QSizeF{50., 50.});
+    n2->getItem()->setPosition(QPointF{1000., 1000.});
+    n2->getItem()->setSize(QSizeF{50., 50.});
+
+    graph.setViewportCulling(true);
+    graph.setCullingRect(QRectF{-10., -10., 100., 100.});   // Note: No window, culling is updated immediately
+    EXPECT_FALSE(graph.isCulled(n1->getItem()));
+    EXPECT_FALSE(sceneGraphCulled(n1->getItem()));
+    EXPECT_TRUE(graph.isCulled(n2->getItem()));
+    EXPECT_TRUE(sceneGraphCulled(n2->getItem()));
+    if (sceneGraphCulling)
+        EXPECT_TRUE(n2->getItem()->isVisible());            // Culling never modify visible property
+
+    graph.setCullingRect(QRectF{900., 900., 200., 200.});   // Pan: n1 is culled, n2 is rendered again
+    EXPECT_TRUE(graph.isCulled(n1->getItem()));
+    EXPECT_TRUE(sceneGraphCulled(n1->getItem()));
+    EXPECT_FALSE(graph.isCulled(n2->getItem()));
+    EXPECT_FALSE(sceneGraphCulled(n2->getItem()));
+    if (sceneGraphCulling)
+        EXPECT_TRUE(n1->getItem()->isVisible());
+
+    n1->getItem()->setPosition(QPointF{950., 950.});        // Moving an item in culling rect uncull it
+    EXPECT_FALSE(graph.isCulled(n1->getItem()));
+    EXPECT_FALSE(sceneGraphCulled(n1->getItem()));
+
+    graph.setCullingRect(QRectF{-10., -10., 100., 100.});
+    graph.setViewportCulling(false);                        // Disabling culling uncull all items
+    EXPECT_FALSE(graph.isCulled(n1->getItem()));
+    EXPECT_FALSE(sceneGraphCulled(n1->getItem()));
+    EXPECT_FALSE(graph.isCulled(n2->getItem()));
+    EXPECT_FALSE(sceneGraphCulled(n2->getItem()));
+}
+
+TEST(qan_Graph, viewportCullingHiddenItems)
+{
+    // User visibility and culling are independent: hiding or showing a culled item is never overriden by culling
+    if (!sceneGraphCulling)
+        GTEST_SKIP() << "Qt Quick private module unavailable, culled items are hidden";
+    qan::test::Graph graph;
+    auto n1 = graph.insertNode();
+    auto n2 = graph.insertNode();
+    auto n3 = graph.insertNode();
+    ASSERT_TRUE(n1 != nullptr && n1->getItem() != nullptr &&
+                n2 != nullptr && n2->getItem() != nullptr &&
+                n3 != nullptr && n3->getItem() != nullptr);
+    n1->getItem()->setPosition(QPointF{0., 0.});
+    n1->getItem()->setSize(QSizeF{50., 50.});
+    n2->getItem()->setPosition(QPointF{1000., 1000.});
+    n2->getItem()->setSize(QSizeF{50., 50.});
+    n3->getItem()->setPosition(QPointF{1100., 1000.});
+    n3->getItem()->setSize(QSizeF{50., 50.});
+    graph.insertEdge(n1, n3);
+
+    graph.setViewportCulling(true);
+    graph.setCullingRect(QRectF{-10., -10., 100., 100.});
+    ASSERT_TRUE(graph.isCulled(n2->getItem()));
+    ASSERT_TRUE(graph.isCulled(n3->getItem()));
+
+    n2->getItem()->setVisible(false);                       // Hidden while culled
+    n1->getItem()->collapseChilds(false);                   // Note: collapseChilds(false) hide childs
+    EXPECT_FALSE(n3->getItem()->isVisible());
+    graph.setCullingRect(QRectF{900., 900., 400., 200.});   // Unculled items stay hidden
+    EXPECT_FALSE(graph.isCulled(n2->getItem()));
+    EXPECT_FALSE(graph.isCulled(n3->getItem()));
+    EXPECT_FALSE(n2->getItem()->isVisible());
+    EXPECT_FALSE(n3->getItem()->isVisible());
+    graph.setViewportCulling(false);
+    EXPECT_FALSE(n2->getItem()->isVisible());
+
+    graph.setViewportCulling(true);                         // Item shown outside culling rect stay culled
+    graph.setCullingRect(QRectF{-10., -10., 100., 100.});
+    n2->getItem()->setVisible(true);
+    EXPECT_TRUE(n2->getItem()->isVisible());
+    EXPECT_TRUE(graph.isCulled(n2->getItem()));
+    EXPECT_TRUE(sceneGraphCulled(n2->getItem()));
+}
+
+TEST(qan_Graph, viewportCullingPooledItems)
+{
+    // Pooled items are unculled, they might be reused for another node inside culling rect
+    qan::test::Graph graph;
+    graph.setDelegatePooling(true);
+    auto n1 = graph.insertNode();
+    ASSERT_TRUE(n1 != nullptr && n1->getItem() != nullptr);
+    n1->getItem()->setPosition(QPointF{1000., 1000.});
+    n1->getItem()->setSize(QSizeF{50., 50.});
+    graph.setViewportCulling(true);
+    graph.setCullingRect(QRectF{-10., -10., 100., 100.});
+    const QPointer<QQuickItem> item = n1->getItem();
+    ASSERT_TRUE(graph.isCulled(item));
+    graph.removeNode(n1);
+    ASSERT_FALSE(item.isNull());
+    EXPECT_FALSE(graph.isCulled(item));
+    EXPECT_FALSE(sceneGraphCulled(item));
+}
+
+TEST(qan_Graph, tableCellItems)
+{
+    qan::test::Graph graph;
+    auto table = graph.insertTable(2, 1);
+    auto n1 = graph.insertNode();
+    ASSERT_TRUE(table != nullptr && n1 != nullptr && n1->getItem() != nullptr);
+    const auto tableItem = qobject_cast<qan::TableGroupItem*>(table->getItem());
+    ASSERT_TRUE(tableItem != nullptr);
+    ASSERT_FALSE(tableItem->getCells().empty());
+    const auto cell = tableItem->getCells().front();
+    ASSERT_TRUE(graph.groupNode(table, n1, cell));
+
+    const auto containerRect = [&graph, n1]() {
+        const auto item = n1->getItem();
+        return item->mapRectToItem(graph.getContainerItem(), QRectF{0., 0., item->width(), item->height()});
+    };
+    EXPECT_EQ(graph.getSpatialIndex().getRect(n1->getItem()), containerRect());
+    cell->setX(cell->x() + 100.);                           // Cell moved by table layout, cell item x/y are unchanged
+    EXPECT_EQ(graph.getSpatialIndex().getRect(n1->getItem()), containerRect());
+    cell->setSize(QSizeF{cell->width() + 50., cell->height() + 50.});   // Item fitted to cell
+    EXPECT_EQ(graph.getSpatialIndex().getRect(n1->getItem()), containerRect());
+}
@@ -0,0 +1,163 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	sugiyama_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./generators.h"
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// qan::SugiyamaLayout tests
+//-----------------------------------------------------------------------------
+
+namespace { // ::
+
+// Return true if two vertices vertically centered in the same layer overlap.
+bool    hasOverlap(const std::vector<QPointF>& positions, const std::vector<QSizeF>& sizes)
+{
+    std::vector<QRectF> rects;
+    for (std::size_t v = 0; v < positions.size(); ++v)
+        rects.emplace_back(positions[v], sizes[v]);
+    std::sort(rects.begin(), rects.end(), [](const auto& a, const auto& b) {
+        return a.center().y() < b.center().y() ||
+               (a.center().y() == b.center().y() && a.left() < b.left());
+    });
+    for (std::size_t r = 1; r < rects.size(); ++r)
+        if (rects[r - 1].center().y() == rects[r].center().y() &&
+            rects[r - 1].right() > rects[r].left())
+            return true;
+    return false;
+}
+
+} // ::
+
+TEST(qan_SugiyamaLayout, empty)
+{
+    qan::SugiyamaLayout layout;
+    EXPECT_TRUE(layout.computeLayout({}, {}).empty());
+    EXPECT_EQ(layout.getLayerCount(), 0);
+}
+
+TEST(qan_SugiyamaLayout, crossingMinimisation)
+{
+    // Input order 0, 1 / 2, 3 with edges 0->3 and 1->2 has one crossing
+    qan::SugiyamaLayout layout;
+    const std::vector<QSizeF> sizes(4, QSizeF{50., 30.});
+    const auto positions = layout.computeLayout(sizes, {{0, 3}, {1, 2}}, 25., 50.);
+    ASSERT_EQ(positions.size(), 4);
+    EXPECT_EQ(layout.getLayerCount(), 2);
+    EXPECT_EQ(layout.getCrossingCount(), 0);
+    EXPECT_DOUBLE_EQ(positions[0].y(), 0.);
+    EXPECT_DOUBLE_EQ(positions[2].y(), 80.);
+    EXPECT_EQ(positions[0].x() < positions[1].x(), positions[3].x() < positions[2].x());
+}
+
+TEST(qan_SugiyamaLayout, cycleAndLongEdges)
+{
+    qan::SugiyamaLayout layout;
+    const std::vector<QSizeF> sizes(5, QSizeF{50., 30.});
+    // 0->1->2->3->0 cycle, 0->3 long edge, 4->4 self loop
+    const auto positions = layout.computeLayout(sizes, {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {0, 3}, {4, 4}});
+    ASSERT_EQ(positions.size(), 5);
+    EXPECT_EQ(layout.getReversedEdgeCount(), 1);
+    EXPECT_EQ(layout.getLayerCount(), 4);
+    EXPECT_EQ(layout.getDummyCount(), 4);   // 0->3 and reversed 3->0 both span 3 layers
+    EXPECT_LT(positions[0].y(), positions[1].y());
+    EXPECT_LT(positions[1].y(), positions[2].y());
+    EXPECT_LT(positions[2].y(), positions[3].y());
+    EXPECT_FALSE(hasOverlap(positions, sizes));
+}
+
+TEST(qan_SugiyamaLayout, deterministicDag)
+{
+    std::vector<QSizeF> sizes;
+    qan::SugiyamaLayout::Edges edges;
+    qan::test::randomDag(1000, sizes, edges);
+    qan::SugiyamaLayout layout;
+    const auto positions = layout.computeLayout(sizes, edges);
+    ASSERT_EQ(positions.size(), sizes.size());
+    EXPECT_EQ(layout.getReversedEdgeCount(), 0);
+    for (const auto& [src, dst] : edges)
+        EXPECT_LT(positions[src].y(), positions[dst].y());
+    EXPECT_FALSE(hasOverlap(positions, sizes));
+
+    qan::SugiyamaLayout otherLayout;
+    EXPECT_EQ(otherLayout.computeLayout(sizes, edges), positions);
+    EXPECT_EQ(otherLayout.getCrossingCount(), layout.getCrossingCount());
+}
+
+TEST(qan_SugiyamaLayout, layoutGraph)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    graph.setContainerItem(&container);
+    std::vector<qan::Node*> nodes;
+    for (int n = 0; n < 4; ++n) {
+        auto node = graph.insertNode();
+        ASSERT_TRUE(node != nullptr);
+        auto item = node->getItem();
+        if (item == nullptr) {
+            item = new qan::NodeItem(&container);
+            item->setGraph(&graph);
+            node->setItem(item);
+        }
+        item->setSize(QSizeF{50., 30.});
+        item->setPosition(QPointF{100. + n * 10., 200.});
+        nodes.push_back(node);
+    }
+    graph.insertEdge(nodes[0], nodes[1]);
+    graph.insertEdge(nodes[0], nodes[2]);
+    graph.insertEdge(nodes[1], nodes[3]);
+    graph.insertEdge(nodes[2], nodes[3]);
+
+    qan::SugiyamaLayout layout;
+    layout.layout(graph, 25., 50.);
+    EXPECT_DOUBLE_EQ(nodes[0]->getItem()->y(), 200.);   // Layout keep nodes bounding rect top left
+    EXPECT_DOUBLE_EQ(nodes[1]->getItem()->y(), 280.);
+    EXPECT_DOUBLE_EQ(nodes[2]->getItem()->y(), 280.);
+    EXPECT_DOUBLE_EQ(nodes[3]->getItem()->y(), 360.);
+    EXPECT_DOUBLE_EQ(std::min(nodes[1]->getItem()->x(), nodes[2]->getItem()->x()), 100.);
+
+    // Layout from a root keep the root in place
+    nodes[1]->getItem()->setPosition(QPointF{0., 0.});
+    layout.layout(*nodes[1], 25., 50.);
+    EXPECT_EQ(nodes[1]->getItem()->position(), QPointF(0., 0.));
+    EXPECT_DOUBLE_EQ(nodes[3]->getItem()->y(), 80.);
+}
@@ -14,8 +14,21 @@
 #include <QGuiApplication>
 #include <QtQml>
 #include <QQuickStyle>
+#include <QQuickWindow>
+#include <QtQml/qqmlextensionplugin.h>
 
 #include <QuickQanava>
+#include "./tests.h"
+
+Q_IMPORT_QML_PLUGIN(QuickQanavaPlugin)
+
+namespace { // ::
+
+QQmlApplicationEngine*  testsEngine = nullptr;
+
+} // ::
+
+QQmlEngine*     qan::test::engine() { return testsEngine; }
 
 int main(int argc, char **argv) {
     ::testing::InitGoogleMock(&argc, argv);
@@ -23,8 +36,12 @@ int main(int argc, char **argv) {
 
     QGuiApplication app(argc, argv);
     QQuickStyle::setStyle("Material");
-    QQmlApplicationEngine* engine = new QQmlApplicationEngine();
-    QuickQanava::initialize(engine);
+    // Note: Windowed tests run offscreen, use the software scene graph backend
+    QQuickWindow::setGraphicsApi(QSGRendererInterface::Software);
+    QQmlApplicationEngine engine;
+    engine.addImportPath(QStringLiteral("qrc:/"));
+    QuickQanava::initialize(&engine);
+    testsEngine = &engine;
 
     return RUN_ALL_TESTS();
 }
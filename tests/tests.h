@@ -0,0 +1,83 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	tests.h
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+#pragma once
+
+// Qt headers
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QQmlEngine>
+#include <QQmlContext>
+
+// QuickQanava headers
+#include <QuickQanava>
+
+namespace qan { // ::qan
+namespace test { // ::qan::test
+
+//! Tests QML engine, initialized with QuickQanava in tests main().
+QQmlEngine* engine();
+
+/*! \brief Graph initialized in tests engine root context like a QML \c Graph{}, node and edge default delegates are available.
+ *
+ * Use instead of a bare qan::Graph when a test need concrete node/edge/group items.
+ */
+class Graph : public qan::Graph
+{
+public:
+    explicit Graph(QQuickItem* parent = nullptr) noexcept :
+        qan::Graph{parent}
+    {
+        QQmlEngine::setContextForObject(this, engine()->rootContext());
+        classBegin();
+        componentComplete();
+    }
+    virtual ~Graph() override = default;
+    Graph(const Graph&) = delete;
+};
+
+//! Process events until predicate is true or timeout expire, return predicate value.
+template <typename Predicate>
+bool    waitFor(Predicate predicate, int timeout = 5000)
+{
+    QElapsedTimer timer;
+    timer.start();
+    while (!predicate() &&
+           timer.elapsed() < timeout)
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+    return predicate();
+}
+
+} // ::qan::test
+} // ::qan
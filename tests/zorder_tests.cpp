@@ -0,0 +1,294 @@
+/*
+ Copyright (c) 2008-2024, Benoit AUTHEMAN All rights reserved.
+
+ Redistribution and use in source and binary forms, with or without
+ modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the author or Destrat.io nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ DISCLAIMED. IN NO EVENT SHALL AUTHOR BE LIABLE FOR ANY
+ DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//-----------------------------------------------------------------------------
+// This file is a part of the QuickQanava software library.
+//
+// \file	zorder_tests.cpp
+// \author	benoit@destrat.io
+// \date	2026 10 16
+//-----------------------------------------------------------------------------
+
+// Std headers
+#include <algorithm>
+#include <random>
+
+// QuickQanava headers
+#include <QuickQanava>
+#include "./tests.h"
+
+// Google Test
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+//-----------------------------------------------------------------------------
+// qan::Graph z ordering tests
+//-----------------------------------------------------------------------------
+
+namespace { // ::
+
+// Create itemCount node items in parent, with z = 0, 1, 2... and track them in graph
+std::vector<qan::NodeItem*> createItems(qan::Graph& graph, QQuickItem& parent, int itemCount)
+{
+    std::vector<qan::NodeItem*> items;
+    for (int i = 0; i < itemCount; ++i) {
+        auto item = new qan::NodeItem(&parent);
+        item->setZ(static_cast<qreal>(i));
+        graph.trackItemZ(item);
+        items.push_back(item);
+    }
+    return items;
+}
+
+// Set group item position and size in graph container CS
+void    setGroupGeometry(qan::Group* group, const QRectF& rect)
+{
+    group->getItem()->setPosition(rect.topLeft());
+    group->getItem()->setSize(rect.size());
+}
+
+// Return true if items sorted by z (with no equal z) match expected bottom to top order
+bool    checkOrder(const std::vector<qan::NodeItem*>& expected)
+{
+    auto items = expected;
+    std::sort(items.begin(), items.end(), [](const auto a, const auto b) { return a->z() < b->z(); });
+    for (std::size_t i = 1; i < items.size(); ++i)
+        if (items[i - 1]->z() == items[i]->z())
+            return false;
+    return items == expected;
+}
+
+} // ::
+
+TEST(qan_Graph, trackedMinMaxZ)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    auto items = createItems(graph, container, 10);
+    EXPECT_EQ(graph.getTrackedZCount(), 10u);
+    graph.updateMinMaxZ();
+    EXPECT_DOUBLE_EQ(graph.getMaxZ(), 9.);
+    EXPECT_DOUBLE_EQ(graph.getMinZ(), 0.);
+
+    items[3]->setZ(42.);
+    items[4]->setZ(-7.);
+    graph.updateMinMaxZ();
+    EXPECT_DOUBLE_EQ(graph.getMaxZ(), 42.);
+    EXPECT_DOUBLE_EQ(graph.getMinZ(), -7.);
+
+    delete items[3];                                        // Destroyed items are untracked
+    graph.updateMinMaxZ();
+    EXPECT_EQ(graph.getTrackedZCount(), 9u);
+    EXPECT_DOUBLE_EQ(graph.getMaxZ(), 9.);
+}
+
+TEST(qan_Graph, renormalizeZ)
+{
+    qan::Graph graph;
+    QQuickItem container;
+    QQuickItem groupContainer;
+    auto items = createItems(graph, container, 4);
+    auto groupItems = createItems(graph, groupContainer, 3);
+    items[0]->setZ(-5000.);
+    items[1]->setZ(70000.);
+    items[2]->setZ(70000.);                                 // Equal z must stay equal
+    items[3]->setZ(90000.);
+    groupItems[0]->setZ(12.);
+    groupItems[1]->setZ(-3.);
+    groupItems[2]->setZ(99999.);
+
+    graph.renormalizeZ();
+    EXPECT_DOUBLE_EQ(items[0]->z(), 0.);
+    EXPECT_DOUBLE_EQ(items[1]->z(), 1.);
+    EXPECT_DOUBLE_EQ(items[2]->z(), 1.);
+    EXPECT_DOUBLE_EQ(items[3]->z(), 2.);
+    EXPECT_DOUBLE_EQ(groupItems[1]->z(), 0.);               // Group level is compacted independently
+    EXPECT_DOUBLE_EQ(groupItems[0]->z(), 1.);
+    EXPECT_DOUBLE_EQ(groupItems[2]->z(), 2.);
+    EXPECT_DOUBLE_EQ(graph.getMaxZ(), 2.);
+    EXPECT_DOUBLE_EQ(graph.getMinZ(), 0.);
+}
+
+TEST(qan_Graph, sendToFrontBackFuzz)
+{
+    // 1M random sendToFront()/sendToBack() on three levels, stacking order must match a reference model,
+    // the large level has more items than zRenormalizationThreshold
+    qan::Graph graph;
+    QQuickItem groupContainer{graph.getContainerItem()};
+    QQuickItem largeContainer{graph.getContainerItem()};
+    auto rootItems = createItems(graph, *graph.getContainerItem(), 48);
+    auto groupItems = createItems(graph, groupContainer, 16);
+    graph.updateMinMaxZ();
+    std::vector<qan::NodeItem*> largeItems;                 // Inserted like graph insert nodes: z = nextMaxZ()
+    static constexpr int largeItemCount = static_cast<int>(qan::Graph::zRenormalizationThreshold) + 50000;
+    for (int i = 0; i < largeItemCount; ++i) {
+        auto item = new qan::NodeItem(&largeContainer);
+        graph.trackItemZ(item);
+        item->setZ(graph.nextMaxZ());
+        largeItems.push_back(item);
+    }
+    ASSERT_TRUE(checkOrder(largeItems));
+    auto rootModel = rootItems;
+    auto groupModel = groupItems;
+    // Large level model: item stacking key, updated in O(1), expected order is items sorted by key
+    std::vector<long long> largeKeys(largeItems.size());
+    for (std::size_t i = 0; i < largeKeys.size(); ++i)
+        largeKeys[i] = static_cast<long long>(i);
+    long long frontKey = static_cast<long long>(largeKeys.size());
+    long long backKey = -1;
+    const auto largeModel = [&largeItems, &largeKeys]() {
+        std::vector<std::size_t> indexes(largeItems.size());
+        for (std::size_t i = 0; i < indexes.size(); ++i)
+            indexes[i] = i;
+        std::sort(indexes.begin(), indexes.end(), [&largeKeys](auto a, auto b) { return largeKeys[a] < largeKeys[b]; });
+        std::vector<qan::NodeItem*> model;
+        model.reserve(indexes.size());
+        for (const auto i : indexes)
+            model.push_back(largeItems[i]);
+        return model;
+    };
+
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> operation{0, 5};
+    std::uniform_int_distribution<std::size_t> rootItem{0, rootItems.size() - 1};
+    std::uniform_int_distribution<std::size_t> groupItem{0, groupItems.size() - 1};
+    std::uniform_int_distribution<std::size_t> largeItem{0, largeItems.size() - 1};
+    const auto sendToFront = [](auto& model, auto item) {
+        model.erase(std::find(model.begin(), model.end(), item));
+        model.push_back(item);
+    };
+    const auto sendToBack = [](auto& model, auto item) {
+        model.erase(std::find(model.begin(), model.end(), item));
+        model.insert(model.begin(), item);
+    };
+
+    static constexpr int operationCount = 1000000;
+    for (int o = 0; o < operationCount; ++o) {
+        const auto op = operation(generator);
+        if (op >= 4) {
+            const auto i = largeItem(generator);
+            if (op == 4) {
+                graph.sendToFront(largeItems[i]);
+                largeKeys[i] = frontKey++;
+            } else {
+                graph.sendToBack(largeItems[i]);
+                largeKeys[i] = backKey--;
+            }
+        } else {
+            auto& items = op < 2 ? rootItems : groupItems;
+            auto& model = op < 2 ? rootModel : groupModel;
+            const auto item = items[op < 2 ? rootItem(generator) : groupItem(generator)];
+            if (op % 2 == 0) {
+                graph.sendToFront(item);
+                sendToFront(model, item);
+            } else {
+                graph.sendToBack(item);
+                sendToBack(model, item);
+            }
+        }
+        ASSERT_LE(graph.getMaxZ(), graph.zRenormalizationLimit() + 1.);
+        ASSERT_GE(graph.getMinZ(), -graph.zRenormalizationLimit() - 1.);
+        if (o % 10000 == 0) {
+            ASSERT_TRUE(checkOrder(rootModel)) << "operation=" << o;
+            ASSERT_TRUE(checkOrder(groupModel)) << "operation=" << o;
+        }
+        if (o % 250000 == 0)
+            ASSERT_TRUE(checkOrder(largeModel())) << "operation=" << o;
+    }
+    EXPECT_TRUE(checkOrder(rootModel));
+    EXPECT_TRUE(checkOrder(groupModel));
+    EXPECT_TRUE(checkOrder(largeModel()));
+}
+
+TEST(qan_Graph, groupAtZOrder)
+{
+    qan::test::Graph graph;
+    auto g1 = graph.insertGroup();
+    auto g2 = graph.insertGroup();                          // Inserted last: on top of g1
+    ASSERT_TRUE(g1 != nullptr && g1->getItem() != nullptr &&
+                g2 != nullptr && g2->getItem() != nullptr);
+    setGroupGeometry(g1, QRectF{0., 0., 400., 400.});
+    setGroupGeometry(g2, QRectF{100., 100., 400., 400.});
+    const QSizeF s{10., 10.};
+    EXPECT_EQ(graph.groupAt(QPointF{150., 150.}, s), g2);
+    EXPECT_EQ(graph.groupAt(QPointF{50., 50.}, s), g1);
+    EXPECT_EQ(graph.groupAt(QPointF{450., 450.}, s), g2);
+    EXPECT_EQ(graph.groupAt(QPointF{150., 150.}, s, g2->getItem()), g1);
+    EXPECT_EQ(graph.groupAt(QPointF{50., 395.}, s), nullptr);  // Not fully contained in g1
+    EXPECT_EQ(graph.groupAt(QPointF{1000., 1000.}, s), nullptr);
+
+    graph.sendToFront(g1->getItem());
+    EXPECT_EQ(graph.groupAt(QPointF{150., 150.}, s), g1);
+    graph.sendToBack(g1->getItem());
+    EXPECT_EQ(graph.groupAt(QPointF{150., 150.}, s), g2);
+    graph.sendToBack(g2->getItem());
+    EXPECT_EQ(graph.groupAt(QPointF{150., 150.}, s), g1);
+
+    g2->getItem()->setPosition(QPointF{1000., 1000.});      // Moved group is found at it's new position
+    EXPECT_EQ(graph.groupAt(QPointF{1050., 1050.}, s), g2);
+    EXPECT_EQ(graph.groupAt(QPointF{450., 450.}, s), nullptr);
+}
+
+TEST(qan_Graph, groupAtNestedGroups)
+{
+    qan::test::Graph graph;
+    auto g1 = graph.insertGroup();
+    auto g2 = graph.insertGroup();
+    auto nested = graph.insertGroup();
+    ASSERT_TRUE(g1 != nullptr && g1->getItem() != nullptr &&
+                g2 != nullptr && g2->getItem() != nullptr &&
+                nested != nullptr && nested->getItem() != nullptr);
+    setGroupGeometry(g1, QRectF{0., 0., 400., 400.});
+    setGroupGeometry(g2, QRectF{600., 0., 400., 400.});
+    setGroupGeometry(nested, QRectF{50., 50., 100., 100.});
+    ASSERT_TRUE(graph.groupNode(g1, nested));               // Nested group is on top of g1 once grouped
+    ASSERT_EQ(nested->getGroup(), g1);
+
+    const QSizeF s{10., 10.};
+    EXPECT_EQ(graph.groupAt(QPointF{100., 100.}, s), nested);
+    EXPECT_EQ(graph.groupAt(QPointF{300., 300.}, s), g1);
+    EXPECT_EQ(graph.groupAt(QPointF{100., 100.}, s, nested->getItem()), g1);
+
+    g1->getItem()->setPosition(QPointF{600., 0.});          // Move g1 (and nested) over g2
+    EXPECT_EQ(graph.groupAt(QPointF{100., 100.}, s), nullptr);
+    graph.sendToFront(g1->getItem());
+    EXPECT_EQ(graph.groupAt(QPointF{700., 100.}, s), nested);
+    EXPECT_EQ(graph.groupAt(QPointF{900., 300.}, s), g1);
+
+    graph.sendToFront(g2->getItem());                       // g2 is on top of g1 and of all g1 content
+    EXPECT_EQ(graph.groupAt(QPointF{700., 100.}, s), g2);
+    EXPECT_EQ(graph.groupAt(QPointF{900., 300.}, s), g2);
+    EXPECT_EQ(graph.groupAt(QPointF{700., 100.}, s, g2->getItem()), nested);
+
+    graph.sendToFront(nested->getItem());                   // Nested group front bring it's host group to front
+    EXPECT_EQ(graph.groupAt(QPointF{700., 100.}, s), nested);
+    EXPECT_EQ(graph.groupAt(QPointF{900., 300.}, s), g1);
+
+    ASSERT_TRUE(graph.ungroupNode(nested));                 // Ungrouped group is sent to max z
+    EXPECT_EQ(graph.groupAt(QPointF{700., 100.}, s), nested);
+    graph.sendToBack(nested->getItem());
+    EXPECT_EQ(graph.groupAt(QPointF{700., 100.}, s), g1);
+}